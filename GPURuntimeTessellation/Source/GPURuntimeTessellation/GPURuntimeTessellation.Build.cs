@@ -29,14 +29,16 @@ public class GPURuntimeTessellation : ModuleRules
 				"RenderCore",
 				"Renderer",
 				"RHI",
-				"RHICore"
+				"RHICore",
+				"PhysicsCore"
 			}
 		);
 			
 		PrivateDependencyModuleNames.AddRange(
 			new string[]
 			{
-				"Projects"
+				"Projects",
+				"ImageCore"
 			}
 		);
 		
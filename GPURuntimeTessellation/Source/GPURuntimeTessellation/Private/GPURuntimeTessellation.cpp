@@ -1,24 +1,133 @@
 // Licensed under the MIT License. See LICENSE file in the project root.
 
 #include "GPURuntimeTessellation.h"
+#include "GPUTessellationStats.h"
+#include "GPUTessellationLog.h"
+#include "GPUTessellationDiskCache.h"
 #include "Interfaces/IPluginManager.h"
 #include "ShaderCore.h"
 #include "Misc/Paths.h"
+#include "Misc/CoreDelegates.h"
+
+#include <atomic>
 
 #define LOCTEXT_NAMESPACE "FGPURuntimeTessellationModule"
 
+DEFINE_LOG_CATEGORY(LogGPUTessellation);
+
+DEFINE_STAT(STAT_GPUTessellation_ReadbackBytes);
+DEFINE_STAT(STAT_GPUTessellation_ReadbackLatency);
+DEFINE_STAT(STAT_GPUTessellation_ReadbacksInFlight);
+DEFINE_STAT(STAT_GPUTessellation_PooledReadbacks);
+DEFINE_STAT(STAT_GPUTessellation_TickLOD);
+DEFINE_STAT(STAT_GPUTessellation_PatchInfo);
+DEFINE_STAT(STAT_GPUTessellation_RDGSetup);
+DEFINE_STAT(STAT_GPUTessellation_RegenerationBatch);
+DEFINE_STAT(STAT_GPUTessellation_WakeCheck);
+DEFINE_STAT(STAT_GPUTessellation_VertexFactoryInit);
+DEFINE_STAT(STAT_GPUTessellation_GetDynamicMeshElements);
+DEFINE_STAT(STAT_GPUTessellation_PatchesGenerated);
+DEFINE_STAT(STAT_GPUTessellation_PatchesCulled);
+DEFINE_STAT(STAT_GPUTessellation_PatchesDrawn);
+DEFINE_STAT(STAT_GPUTessellation_IndirectPatchesVisible);
+DEFINE_STAT(STAT_GPUTessellation_IndirectPatchesCulled);
+DEFINE_STAT(STAT_GPUTessellation_RegenerationGraphs);
+DEFINE_STAT(STAT_GPUTessellation_BatchedRegenerations);
+DEFINE_STAT(STAT_GPUTessellation_SleepingComponents);
+DEFINE_STAT(STAT_GPUTessellation_WokenComponents);
+DEFINE_STAT(STAT_GPUTessellation_MeshCacheHits);
+DEFINE_STAT(STAT_GPUTessellation_MeshCacheMisses);
+DEFINE_STAT(STAT_GPUTessellation_CachedMeshes);
+DEFINE_STAT(STAT_GPUTessellation_SharedMemory);
+DEFINE_STAT(STAT_GPUTessellation_DiskCacheLoad);
+DEFINE_STAT(STAT_GPUTessellation_DiskCacheHits);
+DEFINE_STAT(STAT_GPUTessellation_DiskCacheMisses);
+DEFINE_STAT(STAT_GPUTessellation_DiskCacheStores);
+DEFINE_STAT(STAT_GPUTessellation_InstancedDraws);
+DEFINE_STAT(STAT_GPUTessellation_InstancedProxies);
+DEFINE_STAT(STAT_GPUTessellation_PositionMemory);
+DEFINE_STAT(STAT_GPUTessellation_NormalMemory);
+DEFINE_STAT(STAT_GPUTessellation_UVMemory);
+DEFINE_STAT(STAT_GPUTessellation_TangentMemory);
+DEFINE_STAT(STAT_GPUTessellation_IndexMemory);
+DEFINE_STAT(STAT_GPUTessellation_BudgetVertices);
+DEFINE_STAT(STAT_GPUTessellation_BudgetVertexLimit);
+DEFINE_STAT(STAT_GPUTessellation_BudgetMemory);
+DEFINE_STAT(STAT_GPUTessellation_BudgetMemoryLimit);
+DEFINE_STAT(STAT_GPUTessellation_BudgetPressure);
+DEFINE_STAT(STAT_GPUTessellation_BudgetBiasedComponents);
+
+CSV_DEFINE_CATEGORY_MODULE(GPURUNTIMETESSELLATION_API, GPUTessellation, true);
+
+namespace GPUTessellationStats
+{
+	/** Totals behind GetTotalBufferMemory; the stat system only keeps them when stats are enabled */
+	static std::atomic<int64> PositionBytes(0);
+	static std::atomic<int64> NormalBytes(0);
+	static std::atomic<int64> UVBytes(0);
+	static std::atomic<int64> TangentBytes(0);
+	static std::atomic<int64> IndexBytes(0);
+
+	void UpdateBufferMemory(const FGPUTessellationBufferMemory& OldMemory, const FGPUTessellationBufferMemory& NewMemory)
+	{
+#define GPUTESSELLATION_UPDATE_STREAM(Stream, StatId) \
+		Stream##Bytes.fetch_add((int64)NewMemory.Stream##Bytes - (int64)OldMemory.Stream##Bytes, std::memory_order_relaxed); \
+		DEC_MEMORY_STAT_BY(StatId, OldMemory.Stream##Bytes); \
+		INC_MEMORY_STAT_BY(StatId, NewMemory.Stream##Bytes)
+
+		GPUTESSELLATION_UPDATE_STREAM(Position, STAT_GPUTessellation_PositionMemory);
+		GPUTESSELLATION_UPDATE_STREAM(Normal, STAT_GPUTessellation_NormalMemory);
+		GPUTESSELLATION_UPDATE_STREAM(UV, STAT_GPUTessellation_UVMemory);
+		GPUTESSELLATION_UPDATE_STREAM(Tangent, STAT_GPUTessellation_TangentMemory);
+		GPUTESSELLATION_UPDATE_STREAM(Index, STAT_GPUTessellation_IndexMemory);
+
+#undef GPUTESSELLATION_UPDATE_STREAM
+	}
+
+	FGPUTessellationBufferMemory GetTotalBufferMemory()
+	{
+		FGPUTessellationBufferMemory Memory;
+		Memory.PositionBytes = (uint64)FMath::Max<int64>(PositionBytes.load(std::memory_order_relaxed), 0);
+		Memory.NormalBytes = (uint64)FMath::Max<int64>(NormalBytes.load(std::memory_order_relaxed), 0);
+		Memory.UVBytes = (uint64)FMath::Max<int64>(UVBytes.load(std::memory_order_relaxed), 0);
+		Memory.TangentBytes = (uint64)FMath::Max<int64>(TangentBytes.load(std::memory_order_relaxed), 0);
+		Memory.IndexBytes = (uint64)FMath::Max<int64>(IndexBytes.load(std::memory_order_relaxed), 0);
+		return Memory;
+	}
+
+	/** Memory only changes on regeneration, so the CSV profiler samples it once per frame */
+	static void RecordCsvMemoryStats()
+	{
+#if CSV_PROFILER
+		const FGPUTessellationBufferMemory Memory = GetTotalBufferMemory();
+		const float BytesToMB = 1.0f / (1024.0f * 1024.0f);
+		CSV_CUSTOM_STAT(GPUTessellation, PositionMemoryMB, Memory.PositionBytes * BytesToMB, ECsvCustomStatOp::Set);
+		CSV_CUSTOM_STAT(GPUTessellation, NormalMemoryMB, Memory.NormalBytes * BytesToMB, ECsvCustomStatOp::Set);
+		CSV_CUSTOM_STAT(GPUTessellation, UVMemoryMB, Memory.UVBytes * BytesToMB, ECsvCustomStatOp::Set);
+		CSV_CUSTOM_STAT(GPUTessellation, TangentMemoryMB, Memory.TangentBytes * BytesToMB, ECsvCustomStatOp::Set);
+		CSV_CUSTOM_STAT(GPUTessellation, IndexMemoryMB, Memory.IndexBytes * BytesToMB, ECsvCustomStatOp::Set);
+#endif
+	}
+}
+
 void FGPURuntimeTessellationModule::StartupModule()
 {
 	// Map shader directory for plugin shaders
 	FString PluginShaderDir = FPaths::Combine(IPluginManager::Get().FindPlugin(TEXT("GPURuntimeTessellation"))->GetBaseDir(), TEXT("Shaders"));
 	AddShaderSourceDirectoryMapping(TEXT("/Plugin/GPURuntimeTessellation"), PluginShaderDir);
 	
-	UE_LOG(LogTemp, Log, TEXT("GPURuntimeTessellation: Module started, shader directory mapped to: %s"), *PluginShaderDir);
+	EndFrameHandle = FCoreDelegates::OnEndFrame.AddStatic(&GPUTessellationStats::RecordCsvMemoryStats);
+	EndFrameRTHandle = FCoreDelegates::OnEndFrameRT.AddStatic(&FGPUTessellationDiskCache::PollStores_RenderThread);
+	
+	UE_LOG(LogGPUTessellation, Log, TEXT("GPURuntimeTessellation: Module started, shader directory mapped to: %s"), *PluginShaderDir);
 }
 
 void FGPURuntimeTessellationModule::ShutdownModule()
 {
-	UE_LOG(LogTemp, Log, TEXT("GPURuntimeTessellation: Module shutdown"));
+	FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+	FCoreDelegates::OnEndFrameRT.Remove(EndFrameRTHandle);
+	
+	UE_LOG(LogGPUTessellation, Log, TEXT("GPURuntimeTessellation: Module shutdown"));
 }
 
 #undef LOCTEXT_NAMESPACE
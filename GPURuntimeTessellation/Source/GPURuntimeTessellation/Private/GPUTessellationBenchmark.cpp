@@ -0,0 +1,209 @@
+// Licensed under the MIT License. See LICENSE file in the project root.
+
+#include "GPUTessellationBenchmark.h"
+#include "GPUTessellationComponent.h"
+#include "GPUTessellationMeshBuilder.h"
+#include "GPUTessellationSceneProxy.h"
+#include "GPUTessellationLog.h"
+#include "ConvexVolume.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/Package.h"
+
+namespace GPUTessellationBenchmark
+{
+	/** Timing of one benchmark on one patch grid */
+	struct FResult
+	{
+		const TCHAR* Name;
+		int32 PatchCount;
+		int32 CallsPerIteration;
+		int32 Iterations;
+		double MeanSeconds;
+		double MinSeconds;
+	};
+
+	/**
+	 * Time Body over the given iterations after one warm-up call
+	 * Body returns a value that is folded into Sink so the optimizer cannot drop the work.
+	 */
+	template<typename BodyType>
+	FResult Measure(const TCHAR* Name, int32 PatchCount, int32 CallsPerIteration, int32 Iterations, double& Sink, BodyType&& Body)
+	{
+		Sink += Body();
+
+		double TotalSeconds = 0.0;
+		double MinSeconds = TNumericLimits<double>::Max();
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			const double StartSeconds = FPlatformTime::Seconds();
+			Sink += Body();
+			const double ElapsedSeconds = FPlatformTime::Seconds() - StartSeconds;
+
+			TotalSeconds += ElapsedSeconds;
+			MinSeconds = FMath::Min(MinSeconds, ElapsedSeconds);
+		}
+
+		return { Name, PatchCount, CallsPerIteration, Iterations, TotalSeconds / Iterations, MinSeconds };
+	}
+}
+
+FString FGPUTessellationBenchmark::Run(TConstArrayView<int32> PatchCounts, int32 Iterations)
+{
+	using namespace GPUTessellationBenchmark;
+
+	check(IsInGameThread());
+	Iterations = FMath::Max(Iterations, 1);
+
+	FGPUTessellationMeshBuilder MeshBuilder;
+	TArray<FResult> Results;
+	double Sink = 0.0;
+
+	// A large patch mode plane, rotated and offset so the transforms are not trivial
+	FGPUTessellationSettings Settings;
+	Settings.PlaneSizeX = 100000.0f;
+	Settings.PlaneSizeY = 100000.0f;
+	Settings.bEnablePatchCulling = true;
+
+	const FTransform ComponentTransform(FRotator(0.0f, 30.0f, 0.0f), FVector(1000.0, -2000.0, 500.0), FVector(1.0, 1.0, 1.0));
+	const FMatrix LocalToWorld = ComponentTransform.ToMatrixWithScale();
+	const FVector CameraPosition = ComponentTransform.GetLocation() + FVector(0.0, 0.0, 5000.0);
+
+	// Box around the camera covering roughly half of the plane, so culling keeps some patches and rejects others
+	// Outward facing planes, as in FConvexVolume
+	const double FrustumExtent = Settings.PlaneSizeX * 0.5;
+	TArray<FPlane> FrustumPlanes;
+	FrustumPlanes.Add(FPlane(FVector(1, 0, 0), FrustumExtent + CameraPosition.X));
+	FrustumPlanes.Add(FPlane(FVector(-1, 0, 0), FrustumExtent - CameraPosition.X));
+	FrustumPlanes.Add(FPlane(FVector(0, 1, 0), FrustumExtent + CameraPosition.Y));
+	FrustumPlanes.Add(FPlane(FVector(0, -1, 0), FrustumExtent - CameraPosition.Y));
+	FrustumPlanes.Add(FPlane(FVector(0, 0, 1), FrustumExtent + CameraPosition.Z));
+	FrustumPlanes.Add(FPlane(FVector(0, 0, -1), FrustumExtent - CameraPosition.Z));
+	const FConvexVolume ViewFrustum(FrustumPlanes);
+
+	UGPUTessellationComponent* Component = NewObject<UGPUTessellationComponent>(GetTransientPackage());
+	Component->TessellationSettings = Settings;
+
+	for (const int32 PatchCount : PatchCounts)
+	{
+		if (PatchCount <= 0)
+		{
+			continue;
+		}
+
+		const int32 NumPatches = PatchCount * PatchCount;
+
+		// CalculatePatchInfo: bounds, distance LOD and frustum culling for every patch
+		TArray<FGPUTessellationPatchInfo> PatchInfo;
+		Results.Add(Measure(TEXT("CalculatePatchInfo"), PatchCount, 1, Iterations, Sink, [&]()
+		{
+			MeshBuilder.CalculatePatchInfo(Settings, LocalToWorld, CameraPosition, &ViewFrustum, PatchCount, PatchCount, PatchInfo);
+			return (double)PatchInfo.Num();
+		}));
+
+		// ComputePatchEdgeTransitions: neighbor LOD stitching over the grid
+		Results.Add(Measure(TEXT("ComputePatchEdgeTransitions"), PatchCount, 1, Iterations, Sink, [&]()
+		{
+			MeshBuilder.ComputePatchEdgeTransitions(PatchCount, PatchCount, PatchInfo);
+			return (double)PatchInfo[0].EdgeCollapseFactors.X;
+		}));
+
+		// CalculatePatchTessellationLevel: once per patch, at distances spread over every LOD band
+		const float MaxDistance = Settings.PatchDistances.Num() > 0 ? Settings.PatchDistances.Last() * 1.5f : 50000.0f;
+		Results.Add(Measure(TEXT("CalculatePatchTessellationLevel"), PatchCount, NumPatches, Iterations, Sink, [&]()
+		{
+			int32 LevelSum = 0;
+			for (int32 PatchIndex = 0; PatchIndex < NumPatches; ++PatchIndex)
+			{
+				LevelSum += MeshBuilder.CalculatePatchTessellationLevel(MaxDistance * PatchIndex / NumPatches, Settings);
+			}
+			return (double)LevelSum;
+		}));
+
+		// CalculateResolution: once per patch, over the patch tessellation levels
+		Results.Add(Measure(TEXT("CalculateResolution"), PatchCount, NumPatches, Iterations, Sink, [&]()
+		{
+			int32 VertexSum = 0;
+			for (const FGPUTessellationPatchInfo& Patch : PatchInfo)
+			{
+				const FIntPoint Resolution = FGPUTessellationMeshBuilder::CalculateResolution((float)Patch.TessellationLevel);
+				VertexSum += Resolution.X * Resolution.Y;
+			}
+			return (double)VertexSum;
+		}));
+
+		// CalcBounds: called whenever the transform or settings change; independent of the grid
+		Results.Add(Measure(TEXT("CalcBounds"), PatchCount, 1, Iterations, Sink, [&]()
+		{
+			return Component->CalcBounds(ComponentTransform).SphereRadius;
+		}));
+
+		// PatchPrimitiveBounds: the per visible patch bounds setup of RenderPatches, done on the render thread each frame.
+		// Mesh batch submission needs an RHI and is not included, so this is not the cost of RenderPatches as a whole.
+		Results.Add(Measure(TEXT("PatchPrimitiveBounds"), PatchCount, NumPatches, Iterations, Sink, [&]()
+		{
+			double RadiusSum = 0.0;
+			for (const FGPUTessellationPatchInfo& Patch : PatchInfo)
+			{
+				if (!Patch.bVisible)
+				{
+					continue;
+				}
+
+				FBoxSphereBounds PatchWorldBounds;
+				FBoxSphereBounds PatchLocalBounds;
+				FGPUTessellationSceneProxy::GetPatchPrimitiveBounds(Patch, LocalToWorld, PatchWorldBounds, PatchLocalBounds);
+				RadiusSum += PatchWorldBounds.SphereRadius + PatchLocalBounds.SphereRadius;
+			}
+			return RadiusSum;
+		}));
+	}
+
+	Component->MarkAsGarbage();
+
+	FString Csv = TEXT("Benchmark,PatchCountX,PatchCountY,CallsPerIteration,Iterations,MeanMicroseconds,MinMicroseconds,NanosecondsPerCall\n");
+	for (const FResult& Result : Results)
+	{
+		Csv += FString::Printf(TEXT("%s,%d,%d,%d,%d,%.3f,%.3f,%.2f\n"),
+			Result.Name, Result.PatchCount, Result.PatchCount, Result.CallsPerIteration, Result.Iterations,
+			Result.MeanSeconds * 1.0e6, Result.MinSeconds * 1.0e6,
+			Result.MinSeconds * 1.0e9 / FMath::Max(Result.CallsPerIteration, 1));
+	}
+
+	const FString CsvPath = FPaths::ProfilingDir() / TEXT("GPUTessellation") /
+		FString::Printf(TEXT("Benchmark-%s.csv"), *FDateTime::Now().ToString());
+	if (!FFileHelper::SaveStringToFile(Csv, *CsvPath))
+	{
+		UE_LOG(LogGPUTessellation, Warning, TEXT("GPUTessellation.Benchmark: could not write %s"), *CsvPath);
+		return FString();
+	}
+
+	UE_LOG(LogGPUTessellation, Log, TEXT("GPUTessellation.Benchmark: %d results written to %s (checksum %.3f)"),
+		Results.Num(), *IFileManager::Get().ConvertToAbsolutePathForExternalAppForWrite(*CsvPath), Sink);
+	return CsvPath;
+}
+
+/**
+ * Run the patch benchmarks on grids from 4x4 up to MaxPatchCount x MaxPatchCount, doubling each step
+ */
+static void BenchmarkCommand(const TArray<FString>& Args)
+{
+	const int32 Iterations = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 100;
+	const int32 MaxPatchCount = Args.Num() > 1 ? FMath::Max(4, FCString::Atoi(*Args[1])) : 64;
+
+	TArray<int32> PatchCounts;
+	for (int32 PatchCount = 4; PatchCount <= MaxPatchCount; PatchCount *= 2)
+	{
+		PatchCounts.Add(PatchCount);
+	}
+
+	FGPUTessellationBenchmark::Run(PatchCounts, Iterations);
+}
+
+static FAutoConsoleCommand GBenchmarkCommand(
+	TEXT("GPUTessellation.Benchmark"),
+	TEXT("Time the CPU patch hot paths on growing patch grids and write a CSV to Saved/Profiling/GPUTessellation. Usage: GPUTessellation.Benchmark [Iterations] [MaxPatchCount]"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkCommand));
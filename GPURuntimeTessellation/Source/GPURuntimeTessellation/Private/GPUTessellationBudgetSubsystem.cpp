@@ -0,0 +1,260 @@
+// Licensed under the MIT License. See LICENSE file in the project root.
+
+#include "GPUTessellationBudgetSubsystem.h"
+#include "GPUTessellationComponent.h"
+#include "GPUTessellationStats.h"
+#include "GPUTessellationLog.h"
+#include "GPUTessellationViewSubsystem.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarGPUTessellationBudgetMaxVertices(
+	TEXT("r.GPUTessellation.Budget.MaxVertices"),
+	0,
+	TEXT("Vertices every tessellation component may render together before the least important ones are biased to lower LODs.\n")
+	TEXT(" 0: no vertex budget (default)"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarGPUTessellationBudgetMaxMemoryMB(
+	TEXT("r.GPUTessellation.Budget.MaxMemoryMB"),
+	0,
+	TEXT("GPU buffer memory (MB) every tessellation component may hold together before the least important ones are biased to lower LODs.\n")
+	TEXT(" 0: no memory budget (default)"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarGPUTessellationBudgetMaxLODBias(
+	TEXT("r.GPUTessellation.Budget.MaxLODBias"),
+	4,
+	TEXT("Most LOD bias steps the budget applies to one component; every step halves its tessellation factor."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarGPUTessellationBudgetUpdateInterval(
+	TEXT("r.GPUTessellation.Budget.UpdateInterval"),
+	0.5f,
+	TEXT("Seconds between budget updates. Biased components regenerate, so keep this well above a frame."),
+	ECVF_Default);
+
+namespace GPUTessellationBudget
+{
+	/** Components not rendered for this long are biased before any visible one */
+	static constexpr float RecentlyRenderedSeconds = 1.0f;
+
+	/** Vertices or bytes left after BiasSteps halvings of the tessellation factor */
+	static int64 ScaleForBias(int64 FullDetail, int32 BiasSteps)
+	{
+		return FullDetail >> FMath::Min(2 * BiasSteps, 62);
+	}
+}
+
+void UGPUTessellationBudgetSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	TickHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateUObject(this, &UGPUTessellationBudgetSubsystem::Tick));
+}
+
+void UGPUTessellationBudgetSubsystem::Deinitialize()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+	Entries.Empty();
+
+	Super::Deinitialize();
+}
+
+UGPUTessellationBudgetSubsystem* UGPUTessellationBudgetSubsystem::Get()
+{
+	return GEngine ? GEngine->GetEngineSubsystem<UGPUTessellationBudgetSubsystem>() : nullptr;
+}
+
+void UGPUTessellationBudgetSubsystem::RegisterComponent(UGPUTessellationComponent* Component)
+{
+	check(IsInGameThread());
+
+	if (!Entries.ContainsByPredicate([Component](const FBudgetEntry& Entry) { return Entry.Component == Component; }))
+	{
+		FBudgetEntry& Entry = Entries.AddDefaulted_GetRef();
+		Entry.Component = Component;
+	}
+}
+
+void UGPUTessellationBudgetSubsystem::UnregisterComponent(UGPUTessellationComponent* Component)
+{
+	check(IsInGameThread());
+
+	Entries.RemoveAllSwap([Component](const FBudgetEntry& Entry) { return Entry.Component == Component; });
+	Component->SetBudgetLODBias(0);
+}
+
+bool UGPUTessellationBudgetSubsystem::Tick(float DeltaTime)
+{
+	TimeSinceUpdate += DeltaTime;
+	if (TimeSinceUpdate >= CVarGPUTessellationBudgetUpdateInterval.GetValueOnGameThread())
+	{
+		UpdateBudget();
+	}
+
+	RecordStats();
+	return true;
+}
+
+void UGPUTessellationBudgetSubsystem::UpdateBudget()
+{
+	using namespace GPUTessellationBudget;
+
+	check(IsInGameThread());
+	TimeSinceUpdate = 0.0f;
+
+	Entries.RemoveAllSwap([](const FBudgetEntry& Entry) { return !Entry.Component.IsValid(); });
+
+	const int64 MaxVertices = FMath::Max(CVarGPUTessellationBudgetMaxVertices.GetValueOnGameThread(), 0);
+	const int64 MaxBytes = (int64)FMath::Max(CVarGPUTessellationBudgetMaxMemoryMB.GetValueOnGameThread(), 0) * 1024 * 1024;
+	const int32 MaxLODBias = FMath::Clamp(CVarGPUTessellationBudgetMaxLODBias.GetValueOnGameThread(), 0, 16);
+
+	int64 FullDetailVertices = 0;
+	int64 FullDetailBytes = 0;
+	VertexUsage = 0;
+	MemoryUsageBytes = 0;
+
+	// Every component sharing a cached mesh draws it, but its buffers exist once
+	TSet<const FGPUTessellationCachedMesh*> CountedMeshes;
+
+	for (FBudgetEntry& Entry : Entries)
+	{
+		UGPUTessellationComponent* Component = Entry.Component.Get();
+		const int64 Vertices = Component->GetRenderedVertexCount();
+		int64 Bytes = (int64)Component->GetBufferMemory().GetTotalBytes();
+		uint64 SingleMeshBytes = 0;
+		if (const FGPUTessellationCachedMesh* SingleMesh = Component->GetSingleMeshMemory(SingleMeshBytes))
+		{
+			bool bAlreadyCounted = false;
+			CountedMeshes.Add(SingleMesh, &bAlreadyCounted);
+			if (bAlreadyCounted)
+			{
+				Bytes = FMath::Max<int64>(Bytes - (int64)SingleMeshBytes, 0);
+			}
+		}
+		VertexUsage += Vertices;
+		MemoryUsageBytes += Bytes;
+
+		// Buffers regenerated for a new bias land a frame or more later; keep the old estimate until then
+		// (nothing is rendered right after registration, so an empty estimate is always refreshed)
+		if (!Entry.bBiasChanged || Entry.FullDetailVertices == 0)
+		{
+			const int32 Shift = FMath::Min(2 * Component->GetBudgetLODBias(), 62);
+			Entry.FullDetailVertices = Vertices << Shift;
+			Entry.FullDetailBytes = Bytes << Shift;
+		}
+		Entry.bBiasChanged = false;
+		FullDetailVertices += Entry.FullDetailVertices;
+		FullDetailBytes += Entry.FullDetailBytes;
+
+		// Screen size of the bounds from the nearest view, scaled by the component's priority
+		// Components outside every view frustum go first, like those not rendered recently
+		Entry.Importance = 0.0f;
+		const UWorld* World = Component->GetWorld();
+		const UGPUTessellationViewSubsystem* Views = World ? World->GetSubsystem<UGPUTessellationViewSubsystem>() : nullptr;
+		const FBoxSphereBounds& Bounds = Component->Bounds;
+		if (Views && Component->WasRecentlyRendered(RecentlyRenderedSeconds) && Views->IsInAnyView(Bounds))
+		{
+			const FGPUTessellationView* View = Views->FindNearestView(Bounds.Origin);
+			const double Distance = View ? FMath::Max(FVector::Dist(View->Location, Bounds.Origin) - Bounds.SphereRadius, 1.0) : 1.0;
+			Entry.Importance = Component->BudgetPriority * (float)FMath::Min(Bounds.SphereRadius / Distance, 1.0);
+		}
+	}
+
+	BudgetPressure = 0.0f;
+	if (MaxVertices > 0)
+	{
+		BudgetPressure = FMath::Max(BudgetPressure, (float)((double)FullDetailVertices / MaxVertices));
+	}
+	if (MaxBytes > 0)
+	{
+		BudgetPressure = FMath::Max(BudgetPressure, (float)((double)FullDetailBytes / MaxBytes));
+	}
+
+	// Least important first; each component is biased as far as needed before the next one is touched
+	Entries.StableSort([](const FBudgetEntry& A, const FBudgetEntry& B) { return A.Importance < B.Importance; });
+
+	int64 BudgetedVertices = FullDetailVertices;
+	int64 BudgetedBytes = FullDetailBytes;
+	auto IsOverBudget = [&]()
+	{
+		return (MaxVertices > 0 && BudgetedVertices > MaxVertices) || (MaxBytes > 0 && BudgetedBytes > MaxBytes);
+	};
+
+	BiasedComponentCount = 0;
+	for (FBudgetEntry& Entry : Entries)
+	{
+		int32 LODBias = 0;
+		while (LODBias < MaxLODBias && IsOverBudget())
+		{
+			BudgetedVertices -= ScaleForBias(Entry.FullDetailVertices, LODBias) - ScaleForBias(Entry.FullDetailVertices, LODBias + 1);
+			BudgetedBytes -= ScaleForBias(Entry.FullDetailBytes, LODBias) - ScaleForBias(Entry.FullDetailBytes, LODBias + 1);
+			++LODBias;
+		}
+
+		UGPUTessellationComponent* Component = Entry.Component.Get();
+		if (LODBias != Component->GetBudgetLODBias())
+		{
+			UE_LOG(LogGPUTessellation, Verbose, TEXT("GPUTessellation Budget: %s LOD bias %d -> %d (importance %.4f, pressure %.2f)"),
+				*Component->GetPathName(), Component->GetBudgetLODBias(), LODBias, Entry.Importance, BudgetPressure);
+			Component->SetBudgetLODBias(LODBias);
+			Entry.bBiasChanged = true;
+		}
+		BiasedComponentCount += LODBias > 0 ? 1 : 0;
+	}
+}
+
+void UGPUTessellationBudgetSubsystem::RecordStats() const
+{
+	const double BytesToMB = 1.0 / (1024.0 * 1024.0);
+	const int32 MaxVertices = CVarGPUTessellationBudgetMaxVertices.GetValueOnGameThread();
+	const int32 MaxMemoryMB = CVarGPUTessellationBudgetMaxMemoryMB.GetValueOnGameThread();
+
+	SET_DWORD_STAT(STAT_GPUTessellation_BudgetVertices, (uint32)FMath::Min<int64>(VertexUsage, MAX_uint32));
+	SET_DWORD_STAT(STAT_GPUTessellation_BudgetVertexLimit, MaxVertices);
+	SET_FLOAT_STAT(STAT_GPUTessellation_BudgetMemory, MemoryUsageBytes * BytesToMB);
+	SET_FLOAT_STAT(STAT_GPUTessellation_BudgetMemoryLimit, MaxMemoryMB);
+	SET_FLOAT_STAT(STAT_GPUTessellation_BudgetPressure, BudgetPressure);
+	SET_DWORD_STAT(STAT_GPUTessellation_BudgetBiasedComponents, BiasedComponentCount);
+
+	CSV_CUSTOM_STAT(GPUTessellation, BudgetVertices, (int32)FMath::Min<int64>(VertexUsage, MAX_int32), ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(GPUTessellation, BudgetMemoryMB, (float)(MemoryUsageBytes * BytesToMB), ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(GPUTessellation, BudgetPressure, BudgetPressure, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(GPUTessellation, BudgetBiasedComponents, BiasedComponentCount, ECsvCustomStatOp::Set);
+}
+
+void UGPUTessellationBudgetSubsystem::LogReport() const
+{
+	const double BytesToKB = 1.0 / 1024.0;
+	UE_LOG(LogGPUTessellation, Log, TEXT("GPUTessellation.BudgetReport: %d components, %lld vertices, %.1f MB, pressure %.2f, %d biased (least important first)"),
+		Entries.Num(), VertexUsage, MemoryUsageBytes * BytesToKB / 1024.0, BudgetPressure, BiasedComponentCount);
+	UE_LOG(LogGPUTessellation, Log, TEXT("  %10s %4s %12s %12s %14s  Component"), TEXT("Importance"), TEXT("Bias"), TEXT("Vertices"), TEXT("KB"), TEXT("Full detail KB"));
+	for (const FBudgetEntry& Entry : Entries)
+	{
+		if (const UGPUTessellationComponent* Component = Entry.Component.Get())
+		{
+			UE_LOG(LogGPUTessellation, Log, TEXT("  %10.4f %4d %12lld %12.1f %14.1f  %s"),
+				Entry.Importance, Component->GetBudgetLODBias(), Component->GetRenderedVertexCount(),
+				Component->GetBufferMemory().GetTotalBytes() * BytesToKB, Entry.FullDetailBytes * BytesToKB, *Component->GetPathName());
+		}
+	}
+}
+
+/**
+ * Log the budget state of every registered tessellation component
+ */
+static void BudgetReportCommand()
+{
+	if (const UGPUTessellationBudgetSubsystem* Budget = UGPUTessellationBudgetSubsystem::Get())
+	{
+		Budget->LogReport();
+	}
+}
+
+static FAutoConsoleCommand GBudgetReportCommand(
+	TEXT("GPUTessellation.BudgetReport"),
+	TEXT("Log every tessellation component's budget importance, usage and LOD bias, least important first"),
+	FConsoleCommandDelegate::CreateStatic(&BudgetReportCommand));
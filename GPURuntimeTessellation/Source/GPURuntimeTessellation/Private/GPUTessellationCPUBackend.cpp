@@ -0,0 +1,480 @@
+// Licensed under the MIT License. See LICENSE file in the project root.
+
+#include "GPUTessellationCPUBackend.h"
+#include "GPUTessellationCPUReference.h"
+#include "GPUTessellationLog.h"
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
+#include "Math/VectorRegister.h"
+#include "Misc/App.h"
+
+static TAutoConsoleVariable<int32> CVarGPUTessellationCPUBackend(
+	TEXT("r.GPUTessellation.CPUBackend"),
+	0,
+	TEXT("Generate extracted meshes (GenerateMeshAsync, GenerateMeshSync) on the CPU.\n")
+	TEXT(" 0: only when rendering is unavailable - dedicated servers, commandlets, -nullrhi (default)\n")
+	TEXT(" 1: always"),
+	ECVF_Default);
+
+bool FGPUTessellationCPUTextures::Build(const FGPUTessellationSettings& Settings, UTexture* DisplacementTexture, UTexture* SubtractTexture, UTexture* NormalMapTexture)
+{
+	for (FGPUTessellationHeightTexture& Channel : NormalMap)
+	{
+		Channel = FGPUTessellationHeightTexture();
+	}
+
+	// Sine wave displacement never samples the textures, so an unreadable texture does not matter
+	if (Settings.bUseSineWaveDisplacement)
+	{
+		HeightSampler.SetTextures(FGPUTessellationHeightTexture(), FGPUTessellationHeightTexture());
+	}
+	else if (!HeightSampler.Build(DisplacementTexture, SubtractTexture))
+	{
+		return false;
+	}
+
+	if (Settings.NormalCalculationMethod == EGPUTessellationNormalMethod::FromNormalMap && NormalMapTexture)
+	{
+		for (int32 Channel = 0; Channel < 3; ++Channel)
+		{
+			if (!FGPUTessellationHeightTexture::ReadTexture(NormalMapTexture, NormalMap[Channel], Channel))
+			{
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+FVector3f FGPUTessellationCPUTextures::SampleNormalMap(const FVector2f& UV) const
+{
+	return FVector3f(
+		NormalMap[0].IsValid() ? NormalMap[0].Sample(UV) : 1.0f,
+		NormalMap[1].IsValid() ? NormalMap[1].Sample(UV) : 1.0f,
+		NormalMap[2].IsValid() ? NormalMap[2].Sample(UV) : 1.0f);
+}
+
+bool FGPUTessellationCPUBackend::IsActive()
+{
+	return !FApp::CanEverRender() || CVarGPUTessellationCPUBackend.GetValueOnAnyThread() != 0;
+}
+
+void FGPUTessellationCPUBackend::ExecuteTessellationPipeline(
+	const FGPUTessellationSettings& Settings,
+	const FGPUTessellationCPUTextures& Textures,
+	FGPUTessellatedMeshData& OutMeshData,
+	EGPUTessellationReadbackContent Content)
+{
+	const FIntPoint Resolution = FGPUTessellationMeshBuilder::CalculateResolution(Settings.TessellationFactor);
+
+	OutMeshData.Reset();
+
+	// Step 1: Generate vertices
+	GenerateVertices(Settings, Resolution, OutMeshData);
+
+	// Step 2: Apply displacement
+	ApplyDisplacement(Settings, Textures.HeightSampler, OutMeshData);
+
+	if (Content == EGPUTessellationReadbackContent::PositionsOnly)
+	{
+		// Same content as a positions-only readback
+		OutMeshData.Normals.Empty();
+		OutMeshData.UVs.Empty();
+		return;
+	}
+
+	// Step 3: Calculate normals (if enabled)
+	if (Settings.NormalCalculationMethod != EGPUTessellationNormalMethod::Disabled)
+	{
+		CalculateNormals(Settings, Textures, OutMeshData);
+	}
+
+	// Step 4: Generate indices (no edge collapsing needed for single mesh)
+	GenerateIndices(Resolution, FIntVector4(1, 1, 1, 1), OutMeshData.Indices);
+}
+
+void FGPUTessellationCPUBackend::GenerateVertices(const FGPUTessellationSettings& Settings, FIntPoint Resolution, FGPUTessellatedMeshData& MeshData)
+{
+	const int32 VertexCount = Resolution.X * Resolution.Y;
+	MeshData.Vertices.SetNumUninitialized(VertexCount);
+	MeshData.Normals.SetNumUninitialized(VertexCount);
+	MeshData.UVs.SetNumUninitialized(VertexCount);
+	MeshData.ResolutionX = Resolution.X;
+	MeshData.ResolutionY = Resolution.Y;
+
+	const float DivisorX = FMath::Max(1.0f, (float)(Resolution.X - 1));
+	const float DivisorY = FMath::Max(1.0f, (float)(Resolution.Y - 1));
+
+	ParallelFor(Resolution.Y, [&](int32 Y)
+	{
+		const float V = FMath::Clamp((float)Y / DivisorY, 0.0f, 1.0f);
+		const int32 RowStart = Y * Resolution.X;
+
+		for (int32 X = 0; X < Resolution.X; ++X)
+		{
+			const float U = FMath::Clamp((float)X / DivisorX, 0.0f, 1.0f);
+			const FVector2f PatchUV = FVector2f(U, V) * Settings.UVScale + Settings.UVOffset;
+
+			MeshData.Vertices[RowStart + X] = FVector3f((PatchUV.X - 0.5f) * Settings.PlaneSizeX, (PatchUV.Y - 0.5f) * Settings.PlaneSizeY, 0.0f);
+			MeshData.Normals[RowStart + X] = FVector3f(0.0f, 0.0f, 1.0f);
+			MeshData.UVs[RowStart + X] = PatchUV;
+		}
+	});
+}
+
+void FGPUTessellationCPUBackend::ApplyDisplacement(const FGPUTessellationSettings& Settings, const FGPUTessellationHeightSampler& HeightSampler, FGPUTessellatedMeshData& MeshData)
+{
+	const int32 ResolutionX = MeshData.ResolutionX;
+
+	ParallelFor(MeshData.ResolutionY, [&](int32 Y)
+	{
+		const int32 RowStart = Y * ResolutionX;
+
+		// UVs of a row are contiguous, so the whole row goes through the SIMD batch
+		TArray<float, TInlineAllocator<1024>> Heights;
+		Heights.SetNumUninitialized(ResolutionX);
+		HeightSampler.SampleHeightBatch(Settings, TConstArrayView<FVector2f>(MeshData.UVs.GetData() + RowStart, ResolutionX), Heights);
+
+		for (int32 X = 0; X < ResolutionX; ++X)
+		{
+			MeshData.Vertices[RowStart + X] += MeshData.Normals[RowStart + X] * Heights[X];
+		}
+	});
+}
+
+/**
+ * Geometry-based normal from the (up to four) grid quads around a vertex
+ * Port of CalculateNormalFromGrid, including its per-quad triangle orders
+ */
+static FVector3f CalculateNormalFromGrid(const TArray<FVector3f>& Positions, int32 ResolutionX, int32 ResolutionY, int32 X, int32 Y)
+{
+	const int32 VertexIndex = Y * ResolutionX + X;
+	const FVector3f& P0 = Positions[VertexIndex];
+	FVector3f NormalSum = FVector3f::ZeroVector;
+	float WeightSum = 0.0f;
+
+	// Quad to the lower-left
+	if (X > 0 && Y > 0)
+	{
+		const FVector3f& P1 = Positions[(Y - 1) * ResolutionX + X];
+		const FVector3f& P2 = Positions[(Y - 1) * ResolutionX + (X - 1)];
+		const FVector3f& P3 = Positions[Y * ResolutionX + (X - 1)];
+		NormalSum += FVector3f::CrossProduct(P1 - P0, P3 - P0) + FVector3f::CrossProduct(P3 - P0, P2 - P0);
+		WeightSum += 2.0f;
+	}
+
+	// Quad to the lower-right
+	if (X < ResolutionX - 1 && Y > 0)
+	{
+		const FVector3f& P1 = Positions[(Y - 1) * ResolutionX + (X + 1)];
+		const FVector3f& P2 = Positions[(Y - 1) * ResolutionX + X];
+		NormalSum += FVector3f::CrossProduct(P2 - P0, P1 - P0);
+		WeightSum += 1.0f;
+	}
+
+	// Quad to the upper-right
+	if (X < ResolutionX - 1 && Y < ResolutionY - 1)
+	{
+		const FVector3f& P1 = Positions[Y * ResolutionX + (X + 1)];
+		const FVector3f& P2 = Positions[(Y + 1) * ResolutionX + (X + 1)];
+		const FVector3f& P3 = Positions[(Y + 1) * ResolutionX + X];
+		NormalSum += FVector3f::CrossProduct(P1 - P0, P2 - P0) + FVector3f::CrossProduct(P2 - P0, P3 - P0);
+		WeightSum += 2.0f;
+	}
+
+	// Quad to the upper-left
+	if (X > 0 && Y < ResolutionY - 1)
+	{
+		const FVector3f& P1 = Positions[(Y + 1) * ResolutionX + X];
+		const FVector3f& P2 = Positions[(Y + 1) * ResolutionX + (X - 1)];
+		NormalSum += FVector3f::CrossProduct(P1 - P0, P2 - P0);
+		WeightSum += 1.0f;
+	}
+
+	return WeightSum > 0.0f ? (NormalSum / WeightSum).GetSafeNormal() : FVector3f(0.0f, 0.0f, 1.0f);
+}
+
+void FGPUTessellationCPUBackend::CalculateNormals(const FGPUTessellationSettings& Settings, const FGPUTessellationCPUTextures& Textures, FGPUTessellatedMeshData& MeshData)
+{
+	const int32 ResolutionX = MeshData.ResolutionX;
+	const int32 ResolutionY = MeshData.ResolutionY;
+	const float InvertSign = Settings.bInvertNormals ? -1.0f : 1.0f;
+
+	if (Settings.NormalCalculationMethod == EGPUTessellationNormalMethod::FromNormalMap)
+	{
+		ParallelFor(ResolutionY, [&](int32 Y)
+		{
+			for (int32 VertexIndex = Y * ResolutionX; VertexIndex < (Y + 1) * ResolutionX; ++VertexIndex)
+			{
+				const FVector3f TangentNormal = Textures.SampleNormalMap(MeshData.UVs[VertexIndex]) * 2.0f - FVector3f(1.0f);
+				MeshData.Normals[VertexIndex] = (TangentNormal.GetSafeNormal() * InvertSign).GetSafeNormal();
+			}
+		});
+		return;
+	}
+
+	// Heights scaled by intensity with a one vertex halo, like the shader's groupshared tile
+	// Inside the grid they come from the displaced positions, the halo samples the extrapolated UV
+	const int32 TileWidth = ResolutionX + 2;
+	const int32 TileHeight = ResolutionY + 2;
+	TArray<float> HeightTile;
+	HeightTile.SetNumUninitialized(TileWidth * TileHeight);
+
+	const FVector2f GridDivisor(FMath::Max(ResolutionX - 1, 1), FMath::Max(ResolutionY - 1, 1));
+	ParallelFor(TileHeight, [&](int32 TileY)
+	{
+		const int32 Y = TileY - 1;
+		for (int32 TileX = 0; TileX < TileWidth; ++TileX)
+		{
+			const int32 X = TileX - 1;
+			float& Height = HeightTile[TileY * TileWidth + TileX];
+			if (X >= 0 && Y >= 0 && X < ResolutionX && Y < ResolutionY)
+			{
+				Height = MeshData.Vertices[Y * ResolutionX + X].Z - Settings.DisplacementOffset;
+			}
+			else
+			{
+				const FVector2f UV = FVector2f((float)X, (float)Y) / GridDivisor * Settings.UVScale + Settings.UVOffset;
+				Height = Textures.HeightSampler.SampleHeight(Settings, UV) - Settings.DisplacementOffset;
+			}
+		}
+	});
+
+	const FVector2f GridStep = FGPUTessellationMeshBuilder::CalculateGridStep(Settings, FIntPoint(ResolutionX, ResolutionY));
+	const bool bGeometryBlend = Settings.NormalSmoothingFactor > 0.001f;
+
+	ParallelFor(ResolutionY, [&](int32 Y)
+	{
+		const float* CenterRow = &HeightTile[(Y + 1) * TileWidth + 1];
+		FVector3f* Normals = &MeshData.Normals[Y * ResolutionX];
+
+		// cross((2 * StepX, 0, hR - hL), (0, 2 * StepY, hU - hD)), four vertices at a time
+		const VectorRegister4Float TwoStepX = VectorSetFloat1(2.0f * GridStep.X);
+		const VectorRegister4Float TwoStepY = VectorSetFloat1(2.0f * GridStep.Y);
+		const VectorRegister4Float NormalZ = VectorSetFloat1(4.0f * GridStep.X * GridStep.Y);
+		const VectorRegister4Float Sign = VectorSetFloat1(bGeometryBlend ? 1.0f : InvertSign);
+
+		const int32 NumVectorized = ResolutionX & ~3;
+		for (int32 X = 0; X < NumVectorized; X += 4)
+		{
+			const float* Center = CenterRow + X;
+			const VectorRegister4Float SlopeX = VectorSubtract(VectorLoad(Center + 1), VectorLoad(Center - 1));
+			const VectorRegister4Float SlopeY = VectorSubtract(VectorLoad(Center + TileWidth), VectorLoad(Center - TileWidth));
+
+			const VectorRegister4Float NormalX = VectorNegate(VectorMultiply(SlopeX, TwoStepY));
+			const VectorRegister4Float NormalY = VectorNegate(VectorMultiply(TwoStepX, SlopeY));
+			const VectorRegister4Float LengthSquared = VectorMultiplyAdd(NormalX, NormalX, VectorMultiplyAdd(NormalY, NormalY, VectorMultiply(NormalZ, NormalZ)));
+			const VectorRegister4Float Scale = VectorMultiply(VectorReciprocalSqrt(LengthSquared), Sign);
+
+			alignas(16) float OutX[4];
+			alignas(16) float OutY[4];
+			alignas(16) float OutZ[4];
+			VectorStoreAligned(VectorMultiply(NormalX, Scale), OutX);
+			VectorStoreAligned(VectorMultiply(NormalY, Scale), OutY);
+			VectorStoreAligned(VectorMultiply(NormalZ, Scale), OutZ);
+			for (int32 Lane = 0; Lane < 4; ++Lane)
+			{
+				Normals[X + Lane] = FVector3f(OutX[Lane], OutY[Lane], OutZ[Lane]);
+			}
+		}
+
+		for (int32 X = NumVectorized; X < ResolutionX; ++X)
+		{
+			const float* Center = CenterRow + X;
+			const FVector3f TangentX(2.0f * GridStep.X, 0.0f, Center[1] - Center[-1]);
+			const FVector3f TangentY(0.0f, 2.0f * GridStep.Y, Center[TileWidth] - Center[-TileWidth]);
+			Normals[X] = FVector3f::CrossProduct(TangentX, TangentY).GetSafeNormal() * (bGeometryBlend ? 1.0f : InvertSign);
+		}
+
+		if (bGeometryBlend)
+		{
+			// Lerp between sharp (finite difference) and smooth (geometry based), then invert
+			for (int32 X = 0; X < ResolutionX; ++X)
+			{
+				const FVector3f GeometryNormal = CalculateNormalFromGrid(MeshData.Vertices, ResolutionX, ResolutionY, X, Y);
+				const FVector3f Normal = FMath::Lerp(Normals[X], GeometryNormal, Settings.NormalSmoothingFactor);
+				Normals[X] = (Normal * InvertSign).GetSafeNormal();
+			}
+		}
+	});
+}
+
+void FGPUTessellationCPUBackend::CalculateTangents(const FGPUTessellatedMeshData& MeshData, TArray<FVector4f>& OutTangents)
+{
+	const int32 ResolutionX = MeshData.ResolutionX;
+	const int32 ResolutionY = MeshData.ResolutionY;
+	OutTangents.SetNumUninitialized(MeshData.Vertices.Num());
+
+	ParallelFor(ResolutionY, [&](int32 Y)
+	{
+		for (int32 X = 0; X < ResolutionX; ++X)
+		{
+			const int32 VertexIndex = Y * ResolutionX + X;
+			const FVector3f Normal = MeshData.Normals[VertexIndex].GetSafeNormal();
+
+			FVector3f Tangent;
+			FVector3f Binormal;
+			if (X > 0 && X < ResolutionX - 1 && Y > 0 && Y < ResolutionY - 1)
+			{
+				// Position derivative along U; the shader's dPdV only feeds the binormal it then replaces
+				const int32 Right = VertexIndex + 1;
+				const int32 Left = VertexIndex - 1;
+				const FVector3f DPDU = (MeshData.Vertices[Right] - MeshData.Vertices[Left]) / (MeshData.UVs[Right].X - MeshData.UVs[Left].X + 0.0001f);
+
+				// Gram-Schmidt against the normal
+				Tangent = DPDU.GetSafeNormal();
+				Tangent = (Tangent - Normal * FVector3f::DotProduct(Normal, Tangent)).GetSafeNormal();
+				Binormal = FVector3f::CrossProduct(Normal, Tangent);
+			}
+			else
+			{
+				// Edge vertices - tangent along X
+				Tangent = FMath::Abs(Normal.Z) < 0.999f
+					? FVector3f::CrossProduct(FVector3f(0.0f, 0.0f, 1.0f), Normal).GetSafeNormal()
+					: FVector3f::CrossProduct(FVector3f(1.0f, 0.0f, 0.0f), Normal).GetSafeNormal();
+				Binormal = FVector3f::CrossProduct(Normal, Tangent);
+			}
+
+			// UE expects Binormal = Cross(Normal, Tangent) * TangentW
+			const float BinormalSign = FVector3f::DotProduct(Binormal, FVector3f::CrossProduct(Normal, Tangent)) >= 0.0f ? 1.0f : -1.0f;
+			OutTangents[VertexIndex] = FVector4f(Tangent, BinormalSign);
+		}
+	});
+}
+
+/**
+ * Snap a vertex on an edge that abuts a lower-LOD neighbor onto the coarser vertex grid
+ * Port of ApplyEdgeCollapse in GPUTessellationPatchCommon.ush
+ */
+static uint32 ApplyEdgeCollapse(FIntPoint Resolution, const FIntVector4& EdgeCollapseFactors, uint32 VertexIndex, uint32 VertexX, uint32 VertexY)
+{
+	const uint32 LastX = Resolution.X > 0 ? Resolution.X - 1 : 0;
+	const uint32 LastY = Resolution.Y > 0 ? Resolution.Y - 1 : 0;
+
+	auto ClampStride = [](int32 Stride, uint32 AxisSegments)
+	{
+		return FMath::Min(FMath::Max(1u, (uint32)FMath::Max(Stride, 1)), FMath::Max(1u, AxisSegments));
+	};
+
+	if (EdgeCollapseFactors.X > 1 && VertexX == 0 && VertexY != LastY)
+	{
+		const uint32 Stride = ClampStride(EdgeCollapseFactors.X, LastY);
+		VertexIndex = (VertexY / Stride) * Stride * Resolution.X + VertexX;
+	}
+	if (EdgeCollapseFactors.Y > 1 && VertexX == LastX && VertexY != LastY)
+	{
+		const uint32 Stride = ClampStride(EdgeCollapseFactors.Y, LastY);
+		VertexIndex = (VertexY / Stride) * Stride * Resolution.X + VertexX;
+	}
+	if (EdgeCollapseFactors.Z > 1 && VertexY == 0 && VertexX != LastX)
+	{
+		const uint32 Stride = ClampStride(EdgeCollapseFactors.Z, LastX);
+		VertexIndex = VertexY * Resolution.X + (VertexX / Stride) * Stride;
+	}
+	if (EdgeCollapseFactors.W > 1 && VertexY == LastY && VertexX != LastX)
+	{
+		const uint32 Stride = ClampStride(EdgeCollapseFactors.W, LastX);
+		VertexIndex = VertexY * Resolution.X + (VertexX / Stride) * Stride;
+	}
+
+	return VertexIndex;
+}
+
+void FGPUTessellationCPUBackend::GenerateIndices(FIntPoint Resolution, const FIntVector4& EdgeCollapseFactors, TArray<uint32>& OutIndices)
+{
+	const int32 QuadsX = FMath::Max(Resolution.X - 1, 0);
+	const int32 QuadsY = FMath::Max(Resolution.Y - 1, 0);
+	OutIndices.SetNumUninitialized(QuadsX * QuadsY * 6);
+
+	const bool bCollapseEdges = EdgeCollapseFactors.X > 1 || EdgeCollapseFactors.Y > 1 || EdgeCollapseFactors.Z > 1 || EdgeCollapseFactors.W > 1;
+
+	ParallelFor(QuadsY, [&](int32 Y)
+	{
+		uint32* Indices = &OutIndices[Y * QuadsX * 6];
+		for (int32 X = 0; X < QuadsX; ++X)
+		{
+			// v2 -- v3
+			// |  \   |
+			// v0 -- v1
+			uint32 V0 = Y * Resolution.X + X;
+			uint32 V1 = V0 + 1;
+			uint32 V2 = V0 + Resolution.X;
+			uint32 V3 = V2 + 1;
+
+			if (bCollapseEdges)
+			{
+				V0 = ApplyEdgeCollapse(Resolution, EdgeCollapseFactors, V0, X, Y);
+				V1 = ApplyEdgeCollapse(Resolution, EdgeCollapseFactors, V1, X + 1, Y);
+				V2 = ApplyEdgeCollapse(Resolution, EdgeCollapseFactors, V2, X, Y + 1);
+				V3 = ApplyEdgeCollapse(Resolution, EdgeCollapseFactors, V3, X + 1, Y + 1);
+			}
+
+			// Counter-clockwise when viewed from +Z: v0 -> v2 -> v1, v1 -> v2 -> v3
+			Indices[X * 6 + 0] = V0;
+			Indices[X * 6 + 1] = V2;
+			Indices[X * 6 + 2] = V1;
+			Indices[X * 6 + 3] = V1;
+			Indices[X * 6 + 4] = V2;
+			Indices[X * 6 + 5] = V3;
+		}
+	});
+}
+
+/**
+ * Compare the CPU backend against the GPU pipeline on the procedural sine wave
+ */
+static void ValidateCPUBackendCommand(const TArray<FString>& Args)
+{
+	if (FGPUTessellationCPUBackend::IsActive())
+	{
+		UE_LOG(LogGPUTessellation, Warning, TEXT("GPUTessellation.ValidateCPUBackend: needs rendering and r.GPUTessellation.CPUBackend 0"));
+		return;
+	}
+
+	FGPUTessellationSettings Settings;
+	Settings.TessellationFactor = Args.Num() > 0 ? FCString::Atof(*Args[0]) : 16.0f;
+	Settings.NormalSmoothingFactor = Args.Num() > 1 ? FCString::Atof(*Args[1]) : 0.0f;
+	Settings.bUseSineWaveDisplacement = true;
+	Settings.NormalCalculationMethod = EGPUTessellationNormalMethod::FiniteDifference;
+
+	FGPUTessellationCPUTextures Textures;
+	Textures.Build(Settings, nullptr, nullptr, nullptr);
+
+	FGPUTessellatedMeshData CPUMeshData;
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	FGPUTessellationCPUBackend::ExecuteTessellationPipeline(Settings, Textures, CPUMeshData);
+	const double CPUMilliseconds = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+
+	FGPUTessellationMeshBuilder::GenerateMeshAsync(Settings, FMatrix::Identity, nullptr, nullptr, nullptr,
+		FOnGPUTessellationMeshExtracted::CreateLambda([CPUMeshData = MoveTemp(CPUMeshData), CPUMilliseconds](const FGPUTessellatedMeshData& GPUMeshData)
+		{
+			if (!GPUMeshData.IsValid() || GPUMeshData.Vertices.Num() != CPUMeshData.Vertices.Num() || GPUMeshData.Indices.Num() != CPUMeshData.Indices.Num())
+			{
+				UE_LOG(LogGPUTessellation, Error, TEXT("GPUTessellation.ValidateCPUBackend: GPU readback failed or sizes differ"));
+				return;
+			}
+
+			float MaxPositionError = 0.0f;
+			float MaxUVError = 0.0f;
+			for (int32 Index = 0; Index < GPUMeshData.Vertices.Num(); ++Index)
+			{
+				MaxPositionError = FMath::Max(MaxPositionError, FVector3f::Distance(GPUMeshData.Vertices[Index], CPUMeshData.Vertices[Index]));
+				MaxUVError = FMath::Max(MaxUVError, FVector2f::Distance(GPUMeshData.UVs[Index], CPUMeshData.UVs[Index]));
+			}
+
+			int32 IndexMismatches = 0;
+			for (int32 Index = 0; Index < GPUMeshData.Indices.Num(); ++Index)
+			{
+				IndexMismatches += GPUMeshData.Indices[Index] != CPUMeshData.Indices[Index] ? 1 : 0;
+			}
+
+			const float MaxNormalError = FGPUTessellationCPUReference::MaxNormalAngleError(GPUMeshData.Normals, CPUMeshData.Normals);
+			UE_LOG(LogGPUTessellation, Log, TEXT("GPUTessellation.ValidateCPUBackend: %dx%d, CPU %.2f ms, max position error %g, max UV error %g, max normal error %.4f deg, %d index mismatches"),
+				GPUMeshData.ResolutionX, GPUMeshData.ResolutionY, CPUMilliseconds, MaxPositionError, MaxUVError, MaxNormalError, IndexMismatches);
+		}));
+}
+
+static FAutoConsoleCommand GValidateCPUBackendCommand(
+	TEXT("GPUTessellation.ValidateCPUBackend"),
+	TEXT("Compare the CPU tessellation backend with the GPU pipeline. Usage: GPUTessellation.ValidateCPUBackend [TessellationFactor] [NormalSmoothingFactor]"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&ValidateCPUBackendCommand));
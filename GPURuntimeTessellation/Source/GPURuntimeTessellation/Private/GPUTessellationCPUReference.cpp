@@ -0,0 +1,354 @@
+// Licensed under the MIT License. See LICENSE file in the project root.
+
+#include "GPUTessellationCPUReference.h"
+#include "GPUTessellationMeshBuilder.h"
+
+float FGPUTessellationCPUReference::SineWaveHeight(const FVector2f& UV)
+{
+	return FMath::Sin(UV.X * 10.0f) * FMath::Sin(UV.Y * 10.0f) * 0.5f + 0.5f;
+}
+
+void FGPUTessellationCPUReference::CalculateFiniteDifferenceNormals(
+	const FGPUTessellationSettings& Settings,
+	FIntPoint Resolution,
+	FHeightFunction HeightFunction,
+	TArray<FVector3f>& OutNormals)
+{
+	const int32 VertexCount = Resolution.X * Resolution.Y;
+	OutNormals.SetNumUninitialized(VertexCount);
+
+	const FVector2f GridStep = FGPUTessellationMeshBuilder::CalculateGridStep(Settings, Resolution);
+	const FVector2f GridDivisor(FMath::Max(Resolution.X - 1, 1), FMath::Max(Resolution.Y - 1, 1));
+
+	// Same UV mapping as GPUVertexGeneration.usf, extrapolated past the edges for the halo
+	auto GridHeight = [&](int32 X, int32 Y)
+	{
+		const FVector2f GridUV = FVector2f((float)X, (float)Y) / GridDivisor;
+		const FVector2f UV = GridUV * Settings.UVScale + Settings.UVOffset;
+		return HeightFunction(UV) * Settings.DisplacementIntensity;
+	};
+
+	for (int32 Y = 0; Y < Resolution.Y; ++Y)
+	{
+		for (int32 X = 0; X < Resolution.X; ++X)
+		{
+			const float HeightL = GridHeight(X - 1, Y);
+			const float HeightR = GridHeight(X + 1, Y);
+			const float HeightD = GridHeight(X, Y - 1);
+			const float HeightU = GridHeight(X, Y + 1);
+
+			const FVector3f TangentX(2.0f * GridStep.X, 0.0f, HeightR - HeightL);
+			const FVector3f TangentY(0.0f, 2.0f * GridStep.Y, HeightU - HeightD);
+			FVector3f Normal = FVector3f::CrossProduct(TangentX, TangentY).GetSafeNormal();
+
+			if (Settings.bInvertNormals)
+			{
+				Normal = -Normal;
+			}
+
+			OutNormals[Y * Resolution.X + X] = Normal;
+		}
+	}
+}
+
+void FGPUTessellationCPUReference::GenerateVertices(const FGPUTessellationSettings& Settings, FIntPoint Resolution, FGPUTessellatedMeshData& OutMeshData)
+{
+	OutMeshData.Reset();
+	OutMeshData.ResolutionX = Resolution.X;
+	OutMeshData.ResolutionY = Resolution.Y;
+
+	for (int32 Y = 0; Y < Resolution.Y; ++Y)
+	{
+		for (int32 X = 0; X < Resolution.X; ++X)
+		{
+			const float U = FMath::Clamp((float)X / FMath::Max(1.0f, (float)(Resolution.X - 1)), 0.0f, 1.0f);
+			const float V = FMath::Clamp((float)Y / FMath::Max(1.0f, (float)(Resolution.Y - 1)), 0.0f, 1.0f);
+			const FVector2f PatchUV = FVector2f(U, V) * Settings.UVScale + Settings.UVOffset;
+
+			OutMeshData.Vertices.Add(FVector3f((PatchUV.X - 0.5f) * Settings.PlaneSizeX, (PatchUV.Y - 0.5f) * Settings.PlaneSizeY, 0.0f));
+			OutMeshData.Normals.Add(FVector3f(0.0f, 0.0f, 1.0f));
+			OutMeshData.UVs.Add(PatchUV);
+		}
+	}
+}
+
+void FGPUTessellationCPUReference::ApplyDisplacement(const FGPUTessellationSettings& Settings, FHeightFunction HeightFunction, FGPUTessellatedMeshData& MeshData)
+{
+	for (int32 VertexIndex = 0; VertexIndex < MeshData.Vertices.Num(); ++VertexIndex)
+	{
+		const float Displacement = HeightFunction(MeshData.UVs[VertexIndex]) * Settings.DisplacementIntensity + Settings.DisplacementOffset;
+		MeshData.Vertices[VertexIndex] += MeshData.Normals[VertexIndex] * Displacement;
+	}
+}
+
+void FGPUTessellationCPUReference::CalculateNormals(
+	const FGPUTessellationSettings& Settings,
+	FHeightFunction HeightFunction,
+	FNormalMapFunction NormalMapFunction,
+	FGPUTessellatedMeshData& MeshData)
+{
+	const int32 ResolutionX = MeshData.ResolutionX;
+	const int32 ResolutionY = MeshData.ResolutionY;
+	const FVector2f GridStep = FGPUTessellationMeshBuilder::CalculateGridStep(Settings, FIntPoint(ResolutionX, ResolutionY));
+	const FVector2f GridDivisor(FMath::Max(ResolutionX - 1, 1), FMath::Max(ResolutionY - 1, 1));
+
+	auto Position = [&](int32 X, int32 Y) { return MeshData.Vertices[Y * ResolutionX + X]; };
+
+	// LoadGridHeight: displaced positions inside the grid, extrapolated UVs in the halo
+	auto GridHeight = [&](int32 X, int32 Y)
+	{
+		if (X >= 0 && Y >= 0 && X < ResolutionX && Y < ResolutionY)
+		{
+			return Position(X, Y).Z - Settings.DisplacementOffset;
+		}
+		const FVector2f UV = FVector2f((float)X, (float)Y) / GridDivisor * Settings.UVScale + Settings.UVOffset;
+		return HeightFunction(UV) * Settings.DisplacementIntensity;
+	};
+
+	// CalculateNormalFromGrid: unnormalized triangle normals of the up to four adjacent quads
+	auto GeometryNormal = [&](int32 X, int32 Y)
+	{
+		const FVector3f P0 = Position(X, Y);
+		FVector3f NormalSum = FVector3f::ZeroVector;
+		float WeightSum = 0.0f;
+		if (X > 0 && Y > 0)
+		{
+			NormalSum += FVector3f::CrossProduct(Position(X, Y - 1) - P0, Position(X - 1, Y) - P0);
+			NormalSum += FVector3f::CrossProduct(Position(X - 1, Y) - P0, Position(X - 1, Y - 1) - P0);
+			WeightSum += 2.0f;
+		}
+		if (X < ResolutionX - 1 && Y > 0)
+		{
+			NormalSum += FVector3f::CrossProduct(Position(X, Y - 1) - P0, Position(X + 1, Y - 1) - P0);
+			WeightSum += 1.0f;
+		}
+		if (X < ResolutionX - 1 && Y < ResolutionY - 1)
+		{
+			NormalSum += FVector3f::CrossProduct(Position(X + 1, Y) - P0, Position(X + 1, Y + 1) - P0);
+			NormalSum += FVector3f::CrossProduct(Position(X + 1, Y + 1) - P0, Position(X, Y + 1) - P0);
+			WeightSum += 2.0f;
+		}
+		if (X > 0 && Y < ResolutionY - 1)
+		{
+			NormalSum += FVector3f::CrossProduct(Position(X, Y + 1) - P0, Position(X - 1, Y + 1) - P0);
+			WeightSum += 1.0f;
+		}
+		return WeightSum > 0.0f ? (NormalSum / WeightSum).GetSafeNormal() : FVector3f(0.0f, 0.0f, 1.0f);
+	};
+
+	for (int32 Y = 0; Y < ResolutionY; ++Y)
+	{
+		for (int32 X = 0; X < ResolutionX; ++X)
+		{
+			const int32 VertexIndex = Y * ResolutionX + X;
+			FVector3f Normal;
+
+			if (Settings.NormalCalculationMethod == EGPUTessellationNormalMethod::FromNormalMap)
+			{
+				Normal = (NormalMapFunction(MeshData.UVs[VertexIndex]) * 2.0f - FVector3f(1.0f)).GetSafeNormal();
+			}
+			else
+			{
+				const FVector3f TangentX(2.0f * GridStep.X, 0.0f, GridHeight(X + 1, Y) - GridHeight(X - 1, Y));
+				const FVector3f TangentY(0.0f, 2.0f * GridStep.Y, GridHeight(X, Y + 1) - GridHeight(X, Y - 1));
+				Normal = FVector3f::CrossProduct(TangentX, TangentY).GetSafeNormal();
+
+				if (Settings.NormalSmoothingFactor > 0.001f)
+				{
+					Normal = FMath::Lerp(Normal, GeometryNormal(X, Y), Settings.NormalSmoothingFactor);
+				}
+			}
+
+			if (Settings.bInvertNormals)
+			{
+				Normal = -Normal;
+			}
+
+			MeshData.Normals[VertexIndex] = Normal.GetSafeNormal();
+		}
+	}
+}
+
+void FGPUTessellationCPUReference::CalculateTangents(const FGPUTessellatedMeshData& MeshData, TArray<FVector4f>& OutTangents)
+{
+	const int32 ResolutionX = MeshData.ResolutionX;
+	const int32 ResolutionY = MeshData.ResolutionY;
+	OutTangents.SetNumUninitialized(MeshData.Vertices.Num());
+
+	for (int32 VertexIndex = 0; VertexIndex < MeshData.Vertices.Num(); ++VertexIndex)
+	{
+		const int32 X = VertexIndex % ResolutionX;
+		const int32 Y = VertexIndex / ResolutionX;
+		const FVector3f Normal = MeshData.Normals[VertexIndex].GetSafeNormal();
+
+		FVector3f Tangent(1.0f, 0.0f, 0.0f);
+		FVector3f Binormal(0.0f, 1.0f, 0.0f);
+
+		if (X > 0 && X < ResolutionX - 1 && Y > 0 && Y < ResolutionY - 1)
+		{
+			const int32 Right = VertexIndex + 1;
+			const int32 Left = VertexIndex - 1;
+			const int32 Up = VertexIndex + ResolutionX;
+			const int32 Down = VertexIndex - ResolutionX;
+
+			const FVector3f DPDU = (MeshData.Vertices[Right] - MeshData.Vertices[Left]) / (MeshData.UVs[Right].X - MeshData.UVs[Left].X + 0.0001f);
+			const FVector3f DPDV = (MeshData.Vertices[Up] - MeshData.Vertices[Down]) / (MeshData.UVs[Up].Y - MeshData.UVs[Down].Y + 0.0001f);
+
+			Tangent = DPDU.GetSafeNormal();
+			Binormal = DPDV.GetSafeNormal();
+			Tangent = (Tangent - Normal * FVector3f::DotProduct(Normal, Tangent)).GetSafeNormal();
+			Binormal = FVector3f::CrossProduct(Normal, Tangent);
+		}
+		else
+		{
+			const FVector3f Axis = FMath::Abs(Normal.Z) < 0.999f ? FVector3f(0.0f, 0.0f, 1.0f) : FVector3f(1.0f, 0.0f, 0.0f);
+			Tangent = FVector3f::CrossProduct(Axis, Normal).GetSafeNormal();
+			Binormal = FVector3f::CrossProduct(Normal, Tangent);
+		}
+
+		const FVector3f ExpectedBinormal = FVector3f::CrossProduct(Normal, Tangent);
+		OutTangents[VertexIndex] = FVector4f(Tangent, FVector3f::DotProduct(Binormal, ExpectedBinormal) >= 0.0f ? 1.0f : -1.0f);
+	}
+}
+
+void FGPUTessellationCPUReference::GenerateIndices(FIntPoint Resolution, const FIntVector4& EdgeCollapseFactors, TArray<uint32>& OutIndices)
+{
+	const uint32 LastX = Resolution.X > 0 ? Resolution.X - 1 : 0;
+	const uint32 LastY = Resolution.Y > 0 ? Resolution.Y - 1 : 0;
+
+	auto ClampStride = [](int32 Stride, uint32 AxisSegments)
+	{
+		return FMath::Min((uint32)FMath::Max(Stride, 1), FMath::Max(AxisSegments, 1u));
+	};
+
+	// ApplyEdgeCollapse in GPUTessellationPatchCommon.ush; later edges win at the corners
+	auto CollapseVertex = [&](uint32 VertexX, uint32 VertexY)
+	{
+		uint32 VertexIndex = VertexY * Resolution.X + VertexX;
+		if (EdgeCollapseFactors.X > 1 && VertexX == 0 && VertexY != LastY)
+		{
+			const uint32 Stride = ClampStride(EdgeCollapseFactors.X, LastY);
+			VertexIndex = (VertexY / Stride) * Stride * Resolution.X + VertexX;
+		}
+		if (EdgeCollapseFactors.Y > 1 && VertexX == LastX && VertexY != LastY)
+		{
+			const uint32 Stride = ClampStride(EdgeCollapseFactors.Y, LastY);
+			VertexIndex = (VertexY / Stride) * Stride * Resolution.X + VertexX;
+		}
+		if (EdgeCollapseFactors.Z > 1 && VertexY == 0 && VertexX != LastX)
+		{
+			const uint32 Stride = ClampStride(EdgeCollapseFactors.Z, LastX);
+			VertexIndex = VertexY * Resolution.X + (VertexX / Stride) * Stride;
+		}
+		if (EdgeCollapseFactors.W > 1 && VertexY == LastY && VertexX != LastX)
+		{
+			const uint32 Stride = ClampStride(EdgeCollapseFactors.W, LastX);
+			VertexIndex = VertexY * Resolution.X + (VertexX / Stride) * Stride;
+		}
+		return VertexIndex;
+	};
+
+	OutIndices.Reset();
+	for (int32 Y = 0; Y < Resolution.Y - 1; ++Y)
+	{
+		for (int32 X = 0; X < Resolution.X - 1; ++X)
+		{
+			const uint32 V0 = CollapseVertex(X, Y);
+			const uint32 V1 = CollapseVertex(X + 1, Y);
+			const uint32 V2 = CollapseVertex(X, Y + 1);
+			const uint32 V3 = CollapseVertex(X + 1, Y + 1);
+
+			OutIndices.Append({ V0, V2, V1, V1, V2, V3 });
+		}
+	}
+}
+
+void FGPUTessellationCPUReference::CalculateTessellationFactors(
+	const TArray<FVector3f>& Vertices,
+	const TArray<uint32>& Indices,
+	const FMatrix& LocalToWorld,
+	const FVector& CameraPosition,
+	float MaxTessellationDistance,
+	float MinTessellationFactor,
+	float MaxTessellationFactor,
+	TArray<float>& OutFactors)
+{
+	// The shader works in single precision throughout
+	const FMatrix44f LocalToWorld44f(LocalToWorld);
+	const FVector3f Camera(CameraPosition);
+
+	OutFactors.SetNumUninitialized(Indices.Num() / 3);
+	for (int32 TriangleIndex = 0; TriangleIndex < OutFactors.Num(); ++TriangleIndex)
+	{
+		const FVector3f WorldV0 = LocalToWorld44f.TransformPosition(Vertices[Indices[TriangleIndex * 3 + 0]]);
+		const FVector3f WorldV1 = LocalToWorld44f.TransformPosition(Vertices[Indices[TriangleIndex * 3 + 1]]);
+		const FVector3f WorldV2 = LocalToWorld44f.TransformPosition(Vertices[Indices[TriangleIndex * 3 + 2]]);
+		const FVector3f Center = (WorldV0 + WorldV1 + WorldV2) / 3.0f;
+
+		const float DistanceScale = FMath::Clamp((Center - Camera).Size() / MaxTessellationDistance, 0.0f, 1.0f);
+		OutFactors[TriangleIndex] = FMath::Max(FMath::Lerp(MaxTessellationFactor, MinTessellationFactor, DistanceScale), 1.0f);
+	}
+}
+
+float FGPUTessellationCPUReference::MaxNormalAngleError(const TArray<FVector3f>& A, const TArray<FVector3f>& B)
+{
+	if (A.Num() != B.Num())
+	{
+		return -1.0f;
+	}
+
+	float MaxError = 0.0f;
+	for (int32 Index = 0; Index < A.Num(); ++Index)
+	{
+		const float CosAngle = FMath::Clamp(FVector3f::DotProduct(A[Index].GetSafeNormal(), B[Index].GetSafeNormal()), -1.0f, 1.0f);
+		MaxError = FMath::Max(MaxError, FMath::RadiansToDegrees(FMath::Acos(CosAngle)));
+	}
+	return MaxError;
+}
+
+void FGPUTessellationCPUReference::BuildIndirectDrawArgs(
+	const TArray<FGPUTessellationPatchCullData>& PatchCullData,
+	const TArray<FUintVector4>& LODIndexRanges,
+	const TArray<FPlane>& FrustumPlanes,
+	TArray<FRHIDrawIndexedIndirectParameters>& OutArgs,
+	TArray<TArray<uint32>>& OutVisiblePatches)
+{
+	OutArgs.SetNumZeroed(LODIndexRanges.Num());
+	OutVisiblePatches.Reset();
+	OutVisiblePatches.SetNum(LODIndexRanges.Num());
+
+	for (int32 LODIndex = 0; LODIndex < LODIndexRanges.Num(); ++LODIndex)
+	{
+		OutArgs[LODIndex].IndexCountPerInstance = LODIndexRanges[LODIndex].X;
+		OutArgs[LODIndex].StartIndexLocation = LODIndexRanges[LODIndex].Y;
+	}
+
+	for (int32 PatchIndex = 0; PatchIndex < PatchCullData.Num(); ++PatchIndex)
+	{
+		const FGPUTessellationPatchCullData& Patch = PatchCullData[PatchIndex];
+		if (Patch.LODIndex >= (uint32)LODIndexRanges.Num())
+		{
+			continue;
+		}
+
+		// Same test as FConvexVolume::IntersectBox (and IsPatchInFrustum on the GPU)
+		bool bVisible = true;
+		for (const FPlane& Plane : FrustumPlanes)
+		{
+			const FVector3f Normal(Plane.X, Plane.Y, Plane.Z);
+			const float Distance = FVector3f::DotProduct(Normal, Patch.BoundsCenter) - (float)Plane.W;
+			const float PushOut = FVector3f::DotProduct(Normal.GetAbs(), Patch.BoundsExtent);
+			if (Distance > PushOut)
+			{
+				bVisible = false;
+				break;
+			}
+		}
+
+		if (bVisible)
+		{
+			OutArgs[Patch.LODIndex].InstanceCount++;
+			OutVisiblePatches[Patch.LODIndex].Add(PatchIndex);
+		}
+	}
+}
@@ -3,19 +3,35 @@
 #include "GPUTessellationComponent.h"
 #include "GPUTessellationSceneProxy.h"
 #include "GPUTessellationMeshBuilder.h"
+#include "GPUTessellationContentChecksum.h"
+#include "GPUTessellationHeightSampler.h"
+#include "GPUTessellationTrace.h"
+#include "GPUTessellationLog.h"
+#include "GPUTessellationBudgetSubsystem.h"
+#include "GPUTessellationViewSubsystem.h"
+#include "GPUTessellationTickSubsystem.h"
+#include "GPUTessellationRegenerationSubsystem.h"
+#include "GPUTessellationMeshCache.h"
 #include "Materials/MaterialInterface.h"
 #include "Engine/Texture2D.h"
 #include "Engine/TextureRenderTarget.h"
 #include "PrimitiveSceneProxy.h"
 #include "RenderingThread.h"
-#include "GameFramework/PlayerController.h"
-#include "Camera/PlayerCameraManager.h"
 #include "Engine/World.h"
+#include "Engine/CollisionProfile.h"
+#include "PhysicsEngine/BodySetup.h"
+#include "Interface_CollisionDataProviderCore.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/UObjectIterator.h"
 
-#if WITH_EDITOR
-#include "Editor.h"
-#include "EditorViewportClient.h"
-#endif
+static TAutoConsoleVariable<int32> CVarGPUTessellationInPlaceRefresh(
+	TEXT("r.GPUTessellation.InPlaceRefresh"),
+	1,
+	TEXT("Rerun the compute pipeline into the existing scene proxy's buffers when settings or textures change\n")
+	TEXT("without changing the grid resolution or patch count.\n")
+	TEXT(" 0: always recreate the scene proxy\n")
+	TEXT(" 1: refresh in place when possible (default)"),
+	ECVF_Default);
 
 UGPUTessellationComponent::UGPUTessellationComponent(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -24,6 +40,9 @@ UGPUTessellationComponent::UGPUTessellationComponent(const FObjectInitializer& O
 	, LastCameraPosition(FVector::ZeroVector)
 	, CurrentResolution(32, 32)
 	, LastLogTime(0.0)
+	, LastNoCameraWarningTime(0.0)
+	, bLODInitialized(false)
+	, PendingRegenerationTrigger(EGPUTessellationRegenerationTrigger::ProxyRecreated)
 {
 	PrimaryComponentTick.bCanEverTick = true;
 	PrimaryComponentTick.bStartWithTickEnabled = true;
@@ -53,12 +72,43 @@ void UGPUTessellationComponent::OnRegister()
 	// Initial mesh generation
 	if (bAutoUpdate)
 	{
-		UpdateTessellatedMesh();
+		RequestRegeneration(EGPUTessellationRegenerationTrigger::ProxyRecreated);
+	}
+	
+	RebuildCollision();
+	
+	if (UGPUTessellationBudgetSubsystem* Budget = UGPUTessellationBudgetSubsystem::Get())
+	{
+		Budget->RegisterComponent(this);
 	}
 }
 
 void UGPUTessellationComponent::OnUnregister()
 {
+	if (UGPUTessellationBudgetSubsystem* Budget = UGPUTessellationBudgetSubsystem::Get())
+	{
+		Budget->UnregisterComponent(this);
+	}
+	
+	if (bTickSleepRegistered)
+	{
+		if (UGPUTessellationTickSubsystem* TickSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UGPUTessellationTickSubsystem>() : nullptr)
+		{
+			TickSubsystem->RemoveSleepingComponent(this);
+		}
+		bTickSleepRegistered = false;
+	}
+	
+	// The checksum's readback must be released on the render thread
+	if (ContentChecksum.IsValid())
+	{
+		ENQUEUE_RENDER_COMMAND(ReleaseGPUTessellationContentChecksum)(
+			[Checksum = MoveTemp(ContentChecksum)](FRHICommandListImmediate& RHICmdList) mutable
+			{
+				Checksum.Reset();
+			});
+	}
+	
 	Super::OnUnregister();
 }
 
@@ -66,112 +116,296 @@ void UGPUTessellationComponent::TickComponent(float DeltaTime, enum ELevelTick T
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 	
+	// The LOD update below says how far the view may move before it needs another tick
+	bLODViewDependent = bAutoUpdate && TessellationSettings.LODMode != EGPUTessellationLODMode::Disabled;
+	bLODHasView = false;
+	LODWakeRadius = 0.0f;
+	
+	// Explicit displacement edits apply even without automatic updates
+	if (PendingDirtyUVRegions.Num() > 0)
+	{
+		FlushDirtyDisplacementRegions();
+	}
+	
+	UpdateCollision();
+	
 	if (!bAutoUpdate)
 	{
+		UpdateTickSleep();
 		return;
 	}
 	
 	// Update LOD based on selected mode
-	switch (TessellationSettings.LODMode)
 	{
-		case EGPUTessellationLODMode::DistanceBased:
+		GPUTESSELLATION_SCOPE_CYCLE_COUNTER(STAT_GPUTessellation_TickLOD, TickLOD);
+		switch (TessellationSettings.LODMode)
 		{
-			// Initialize LOD system on first update
-			static bool bInitialized = false;
-			if (!bInitialized)
+			case EGPUTessellationLODMode::DistanceBased:
 			{
-				// Initialize from MaxTessellationFactor (LOD range max)
-				CurrentLODLevel = (float)TessellationSettings.MaxTessellationFactor;
-				LastAppliedTessFactor = TessellationSettings.MaxTessellationFactor;
-				bInitialized = true;
-				
-				if (bEnableDebugLogging)
+				// Initialize LOD system on first update
+				if (!bLODInitialized)
 				{
-					UE_LOG(LogTemp, Warning, TEXT("GPUTessellation: LOD Initialized - Max Factor: %d, Min Factor: %d"), 
-						TessellationSettings.MaxTessellationFactor, TessellationSettings.MinTessellationFactor);
+					// Initialize from MaxTessellationFactor (LOD range max)
+					CurrentLODLevel = (float)TessellationSettings.MaxTessellationFactor;
+					LastAppliedTessFactor = TessellationSettings.MaxTessellationFactor;
+					bLODInitialized = true;
+				
+					if (bEnableDebugLogging)
+					{
+						UE_LOG(LogGPUTessellation, Log, TEXT("GPUTessellation: LOD Initialized - Max Factor: %d, Min Factor: %d"), 
+							TessellationSettings.MaxTessellationFactor, TessellationSettings.MinTessellationFactor);
+					}
 				}
+				UpdateDistanceBasedLOD(DeltaTime);
+				break;
+			}
+		
+			case EGPUTessellationLODMode::DistanceBasedDiscrete:
+			{
+				UpdateDiscreteLOD(DeltaTime);
+				break;
 			}
-			UpdateDistanceBasedLOD(DeltaTime);
-			break;
-		}
 		
-		case EGPUTessellationLODMode::DistanceBasedDiscrete:
+			case EGPUTessellationLODMode::DistanceBasedPatches:
+			{
+				UpdatePatchBasedLOD(DeltaTime);
+				break;
+			}
+			
+			case EGPUTessellationLODMode::DensityTexture:
+				UpdateDensityBasedLOD(DeltaTime);
+				break;
+			
+			case EGPUTessellationLODMode::Disabled:
+			default:
+				// No LOD - use TessellationFactor directly via CalculateGridResolution()
+				break;
+		}
+	}
+	
+	// Regenerate when render target contents change (or on every interval in Continuous mode)
+	if (bAutoUpdateRenderTargets || bDisplacementChangeNotified)
+	{
+		UpdateRenderTargetChanges();
+	}
+	
+	UpdateTickSleep();
+}
+
+bool UGPUTessellationComponent::HasPendingTickWork() const
+{
+	if (PendingDirtyUVRegions.Num() > 0)
+	{
+		return true;
+	}
+	
+	// A finished collision build wakes the tick itself
+	if (!bCollisionBuildInFlight && (bGenerateCollision ? bCollisionDirty : CollisionBodySetup != nullptr))
+	{
+		return true;
+	}
+	
+	if (!bAutoUpdate)
+	{
+		return false;
+	}
+	
+	// Continuous and checksum modes have to look at the render targets every tick
+	if (bDisplacementChangeNotified)
+	{
+		return true;
+	}
+	if (bAutoUpdateRenderTargets && RenderTargetUpdateMode != EGPUTessellationRenderTargetUpdateMode::OnNotify)
+	{
+		for (const UTexture* Texture : { DisplacementTexture.Get(), SubtractTexture.Get(), NormalMapTexture.Get() })
 		{
-			UpdateDiscreteLOD(DeltaTime);
-			break;
+			if (Texture && Texture->IsA<UTextureRenderTarget>())
+			{
+				return true;
+			}
 		}
-		
-		case EGPUTessellationLODMode::DistanceBasedPatches:
+	}
+	
+	// Batched patch fills advance themselves; unbatched ones are advanced by the tick
+	if (TessellationSettings.LODMode == EGPUTessellationLODMode::DistanceBasedPatches && SceneProxy)
+	{
+		const FGPUTessellationSceneProxy* TessSceneProxy = static_cast<const FGPUTessellationSceneProxy*>(SceneProxy);
+		if (!FGPUTessellationRegenerationBatch::IsEnabled_GameThread() || TessSceneProxy->IsPatchRegenerationPending())
 		{
-			UpdatePatchBasedLOD(DeltaTime);
-			break;
+			return true;
 		}
-			
-		case EGPUTessellationLODMode::DensityTexture:
-			UpdateDensityBasedLOD(DeltaTime);
-			break;
-			
-		case EGPUTessellationLODMode::Disabled:
-		default:
-			// No LOD - use TessellationFactor directly via CalculateGridResolution()
-			break;
 	}
 	
-	// Check if any textures are render targets (dynamic textures that update every frame)
-	// If so, force mesh regeneration every frame to reflect the changes (with optional FPS limiting)
-	if (bAutoUpdateRenderTargets)
+	return false;
+}
+
+void UGPUTessellationComponent::UpdateTickSleep()
+{
+	if (!UGPUTessellationTickSubsystem::IsSleepEnabled() || HasPendingTickWork())
 	{
-		bool bHasRenderTarget = false;
+		return;
+	}
+	
+	if (bLODViewDependent)
+	{
+		// Still converging (smooth LOD) or sitting on a band edge
+		if (bLODHasView && LODWakeRadius <= 0.0f)
+		{
+			return;
+		}
 		
-		if (DisplacementTexture && DisplacementTexture->IsA<UTextureRenderTarget>())
+		UGPUTessellationTickSubsystem* TickSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UGPUTessellationTickSubsystem>() : nullptr;
+		if (!TickSubsystem)
 		{
-			bHasRenderTarget = true;
+			return;
 		}
-		if (SubtractTexture && SubtractTexture->IsA<UTextureRenderTarget>())
+		TickSubsystem->AddSleepingComponent(this, LODWakeLocation, LODWakeRadius, bLODHasView);
+	}
+	
+	SetComponentTickEnabled(false);
+	
+	if (bEnableDebugLogging)
+	{
+		UE_LOG(LogGPUTessellation, Log, TEXT("GPUTessellation: Tick sleeping - ViewDependent:%d HasView:%d WakeRadius:%.1f"),
+			bLODViewDependent, bLODHasView, LODWakeRadius);
+	}
+}
+
+void UGPUTessellationComponent::WakeTick()
+{
+	if (bTickSleepRegistered)
+	{
+		if (UGPUTessellationTickSubsystem* TickSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UGPUTessellationTickSubsystem>() : nullptr)
 		{
-			bHasRenderTarget = true;
+			TickSubsystem->RemoveSleepingComponent(this);
 		}
-		if (NormalMapTexture && NormalMapTexture->IsA<UTextureRenderTarget>())
+		bTickSleepRegistered = false;
+	}
+	
+	if (!IsComponentTickEnabled())
+	{
+		SetComponentTickEnabled(true);
+	}
+}
+
+void UGPUTessellationComponent::OnUpdateTransform(EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+	Super::OnUpdateTransform(UpdateTransformFlags, Teleport);
+	
+	// The distance to every view changed
+	WakeTick();
+}
+
+void UGPUTessellationComponent::UpdateRenderTargetChanges()
+{
+	TArray<UTexture*, TInlineAllocator<3>> RenderTargets;
+	for (UTexture* Texture : { DisplacementTexture.Get(), SubtractTexture.Get(), NormalMapTexture.Get() })
+	{
+		if (Texture && Texture->IsA<UTextureRenderTarget>())
 		{
-			bHasRenderTarget = true;
+			RenderTargets.Add(Texture);
 		}
-		
-		// Force update when using render targets, with optional FPS limiting
-		if (bHasRenderTarget)
+	}
+	
+	bool bContentChanged = bDisplacementChangeNotified;
+	if (bAutoUpdateRenderTargets && RenderTargets.Num() > 0)
+	{
+		switch (RenderTargetUpdateMode)
 		{
-			bool bShouldUpdate = true;
-			
-			// Apply FPS limiting if specified (0 = unlimited)
-			if (RenderTargetUpdateFPS > 0)
-			{
-				double CurrentTime = FPlatformTime::Seconds();
-				double MinTimeBetweenUpdates = 1.0 / static_cast<double>(RenderTargetUpdateFPS);
+			case EGPUTessellationRenderTargetUpdateMode::Continuous:
+				bContentChanged = true;
+				break;
 				
-				if (CurrentTime - LastRenderTargetUpdateTime < MinTimeBetweenUpdates)
-				{
-					bShouldUpdate = false;
-				}
-				else
+			case EGPUTessellationRenderTargetUpdateMode::ContentChecksum:
+			{
+				// Checksum results arrive a frame or two late; a change stays pending until consumed
+				if (!ContentChecksum.IsValid())
 				{
-					LastRenderTargetUpdateTime = CurrentTime;
+					ContentChecksum = MakeShared<FGPUTessellationContentChecksum, ESPMode::ThreadSafe>();
 				}
+				ContentChecksum->Update(RenderTargets);
+				bContentChanged |= ContentChecksum->ConsumeChange();
+				break;
 			}
 			
-			if (bShouldUpdate)
-			{
-				MarkRenderStateDirty();
-			}
+			case EGPUTessellationRenderTargetUpdateMode::OnNotify:
+			default:
+				break;
 		}
 	}
+	
+	if (!bContentChanged)
+	{
+		return;
+	}
+	
+	// Apply FPS limiting if specified (0 = unlimited)
+	if (RenderTargetUpdateFPS > 0)
+	{
+		double CurrentTime = FPlatformTime::Seconds();
+		double MinTimeBetweenUpdates = 1.0 / static_cast<double>(RenderTargetUpdateFPS);
+		
+		if (CurrentTime - LastRenderTargetUpdateTime < MinTimeBetweenUpdates)
+		{
+			// A consumed checksum change is kept as a notification until the interval allows an update
+			bDisplacementChangeNotified = true;
+			return;
+		}
+		LastRenderTargetUpdateTime = CurrentTime;
+	}
+	
+	bDisplacementChangeNotified = false;
+	RequestRegeneration(EGPUTessellationRegenerationTrigger::RenderTarget);
+	RebuildCollision();
+}
+
+void UGPUTessellationComponent::NotifyDisplacementChanged()
+{
+	bDisplacementChangeNotified = true;
+	WakeTick();
+}
+
+void UGPUTessellationComponent::MarkDisplacementRegionDirty(const FBox2D& UVRegion)
+{
+	if (!UVRegion.bIsValid)
+	{
+		return;
+	}
+	
+	// Each region costs its own dispatches; past a handful their bounding box is cheaper
+	const int32 MaxDirtyRegions = 8;
+	FBox2f Region(UVRegion);
+	if (PendingDirtyUVRegions.Num() >= MaxDirtyRegions)
+	{
+		for (const FBox2f& PendingRegion : PendingDirtyUVRegions)
+		{
+			Region += PendingRegion;
+		}
+		PendingDirtyUVRegions.Reset();
+	}
+	PendingDirtyUVRegions.Add(Region);
+	
+	RebuildCollision();
+	WakeTick();
+}
+
+void UGPUTessellationComponent::FlushDirtyDisplacementRegions()
+{
+	RequestRegeneration(EGPUTessellationRegenerationTrigger::DisplacementRegion, PendingDirtyUVRegions);
+	PendingDirtyUVRegions.Reset();
 }
 
 FPrimitiveSceneProxy* UGPUTessellationComponent::CreateSceneProxy()
 {
+	FPrimitiveSceneProxy* Proxy = nullptr;
 	if (TessellationSettings.TessellationFactor > 0.0f)
 	{
-		return new FGPUTessellationSceneProxy(this);
+		Proxy = new FGPUTessellationSceneProxy(this);
 	}
-	return nullptr;
+	
+	// Recreations nobody asked for (visibility, streaming, transform) are the engine's
+	PendingRegenerationTrigger = EGPUTessellationRegenerationTrigger::ProxyRecreated;
+	return Proxy;
 }
 
 FBoxSphereBounds UGPUTessellationComponent::CalcBounds(const FTransform& LocalToWorld) const
@@ -191,7 +425,7 @@ FBoxSphereBounds UGPUTessellationComponent::CalcBounds(const FTransform& LocalTo
 		// This is an error condition - always log as Warning
 		if (bEnableDebugLogging)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("GPUTessellation: CalcBounds - ZERO OR NEAR-ZERO SCALE DETECTED: %s - Using identity scale"), 
+			UE_LOG(LogGPUTessellation, Warning, TEXT("GPUTessellation: CalcBounds - ZERO OR NEAR-ZERO SCALE DETECTED: %s - Using identity scale"), 
 				*Scale3D.ToString());
 		}
 		// Use a transform with identity scale
@@ -220,7 +454,7 @@ FBoxSphereBounds UGPUTessellationComponent::CalcBounds(const FTransform& LocalTo
 		if (CurrentTime - LastLogTime >= 2.0)
 		{
 			LastLogTime = CurrentTime;
-			UE_LOG(LogTemp, Log, TEXT("GPUTessellation: CalcBounds - PlaneSizeX:%.1f PlaneSizeZ:%.1f MaxDisp:%.1f Scale:%s Result:%s"), 
+			UE_LOG(LogGPUTessellation, Log, TEXT("GPUTessellation: CalcBounds - PlaneSizeX:%.1f PlaneSizeZ:%.1f MaxDisp:%.1f Scale:%s Result:%s"), 
 				TessellationSettings.PlaneSizeX, TessellationSettings.PlaneSizeY, MaxDisplacement, 
 				*Scale3D.ToString(), *Result.ToString());
 		}
@@ -247,40 +481,345 @@ UMaterialInterface* UGPUTessellationComponent::GetMaterial(int32 ElementIndex) c
 	return (ElementIndex == 0) ? Material : nullptr;
 }
 
+UBodySetup* UGPUTessellationComponent::GetBodySetup()
+{
+	return CollisionBodySetup;
+}
+
+bool UGPUTessellationComponent::GetPhysicsTriMeshData(FTriMeshCollisionData* CollisionData, bool InUseAllTriData)
+{
+	// Called on the cooking thread - CollisionVertices does not change while a cook is in flight
+	if (CollisionResolution.X < 2 || CollisionResolution.Y < 2 || CollisionVertices.Num() != CollisionResolution.X * CollisionResolution.Y)
+	{
+		return false;
+	}
+	
+	CollisionData->Vertices = CollisionVertices;
+	CollisionData->Indices.Reset((CollisionResolution.X - 1) * (CollisionResolution.Y - 1) * 2);
+	
+	// Same grid topology as GPUIndexGeneration.usf
+	for (int32 Y = 0; Y < CollisionResolution.Y - 1; ++Y)
+	{
+		for (int32 X = 0; X < CollisionResolution.X - 1; ++X)
+		{
+			const int32 V0 = Y * CollisionResolution.X + X;
+			const int32 V1 = V0 + 1;
+			const int32 V2 = V0 + CollisionResolution.X;
+			const int32 V3 = V2 + 1;
+			
+			FTriIndices& Triangle0 = CollisionData->Indices.AddDefaulted_GetRef();
+			Triangle0.v0 = V0;
+			Triangle0.v1 = V2;
+			Triangle0.v2 = V1;
+			
+			FTriIndices& Triangle1 = CollisionData->Indices.AddDefaulted_GetRef();
+			Triangle1.v0 = V1;
+			Triangle1.v1 = V2;
+			Triangle1.v2 = V3;
+		}
+	}
+	
+	CollisionData->bFlipNormals = true;
+	CollisionData->bDeformableMesh = true;
+	CollisionData->bFastCook = true;
+	return true;
+}
+
+bool UGPUTessellationComponent::ContainsPhysicsTriMeshData(bool InUseAllTriData) const
+{
+	return CollisionVertices.Num() > 0;
+}
+
+const FGPUTessellationHeightSampler* UGPUTessellationComponent::GetHeightSampler()
+{
+	if (!HeightSampler.IsValid() || !HeightSampler->IsBuiltFrom(DisplacementTexture, SubtractTexture))
+	{
+		HeightSampler = MakeShared<FGPUTessellationHeightSampler>();
+		if (!HeightSampler->Build(DisplacementTexture, SubtractTexture))
+		{
+			UE_LOG(LogGPUTessellation, Warning, TEXT("GPUTessellation: %s - displacement or subtract texture is not CPU readable, SampleHeight is unavailable"), *GetName());
+		}
+	}
+	return HeightSampler->IsValid() ? HeightSampler.Get() : nullptr;
+}
+
+FVector2f UGPUTessellationComponent::WorldToSurfaceUV(const FVector& WorldLocation, FVector& OutLocalLocation) const
+{
+	// Inverse of the vertex generation mapping: LocalPos.xy = (UV - 0.5) * PlaneSize
+	OutLocalLocation = GetComponentTransform().InverseTransformPosition(WorldLocation);
+	return FVector2f(
+		OutLocalLocation.X / FMath::Max(TessellationSettings.PlaneSizeX, UE_SMALL_NUMBER) + 0.5f,
+		OutLocalLocation.Y / FMath::Max(TessellationSettings.PlaneSizeY, UE_SMALL_NUMBER) + 0.5f);
+}
+
+bool UGPUTessellationComponent::IsOnSurface(const FVector2f& UV) const
+{
+	const FVector2f UVMin = FVector2f::Min(TessellationSettings.UVOffset, TessellationSettings.UVOffset + TessellationSettings.UVScale);
+	const FVector2f UVMax = FVector2f::Max(TessellationSettings.UVOffset, TessellationSettings.UVOffset + TessellationSettings.UVScale);
+	return UV.X >= UVMin.X && UV.Y >= UVMin.Y && UV.X <= UVMax.X && UV.Y <= UVMax.Y;
+}
+
+bool UGPUTessellationComponent::SampleHeight(const FVector& WorldLocation, float& OutHeight)
+{
+	const FGPUTessellationHeightSampler* Sampler = GetHeightSampler();
+	if (!Sampler)
+	{
+		return false;
+	}
+	
+	FVector LocalLocation;
+	const FVector2f UV = WorldToSurfaceUV(WorldLocation, LocalLocation);
+	if (!IsOnSurface(UV))
+	{
+		return false;
+	}
+	
+	// Displacement runs along the local up axis
+	LocalLocation.Z = Sampler->SampleHeight(TessellationSettings, UV);
+	OutHeight = GetComponentTransform().TransformPosition(LocalLocation).Z;
+	return true;
+}
+
+bool UGPUTessellationComponent::SampleHeightBatch(const TArray<FVector>& WorldLocations, TArray<float>& OutHeights, TArray<bool>& OutValid)
+{
+	OutHeights.Reset();
+	OutValid.Reset();
+	const FGPUTessellationHeightSampler* Sampler = GetHeightSampler();
+	if (!Sampler)
+	{
+		return false;
+	}
+	
+	TArray<FVector> LocalLocations;
+	TArray<FVector2f> UVs;
+	LocalLocations.SetNumUninitialized(WorldLocations.Num());
+	UVs.SetNumUninitialized(WorldLocations.Num());
+	OutValid.SetNumUninitialized(WorldLocations.Num());
+	for (int32 Index = 0; Index < WorldLocations.Num(); ++Index)
+	{
+		UVs[Index] = WorldToSurfaceUV(WorldLocations[Index], LocalLocations[Index]);
+		OutValid[Index] = IsOnSurface(UVs[Index]);
+	}
+	
+	// Points off the plane still go through the SIMD lanes; the sampler clamps their UVs
+	OutHeights.SetNumUninitialized(WorldLocations.Num());
+	Sampler->SampleHeightBatch(TessellationSettings, UVs, OutHeights);
+	
+	const FTransform& ComponentTransform = GetComponentTransform();
+	for (int32 Index = 0; Index < WorldLocations.Num(); ++Index)
+	{
+		if (!OutValid[Index])
+		{
+			OutHeights[Index] = 0.0f;
+			continue;
+		}
+		
+		FVector& LocalLocation = LocalLocations[Index];
+		LocalLocation.Z = OutHeights[Index];
+		OutHeights[Index] = ComponentTransform.TransformPosition(LocalLocation).Z;
+	}
+	return true;
+}
+
+void UGPUTessellationComponent::RebuildCollision()
+{
+	bCollisionDirty = true;
+	CollisionDirtyTime = FPlatformTime::Seconds();
+	WakeTick();
+}
+
+void UGPUTessellationComponent::UpdateCollision()
+{
+	if (!bGenerateCollision)
+	{
+		if (CollisionBodySetup && !bCollisionBuildInFlight)
+		{
+			ClearCollision();
+		}
+		return;
+	}
+	
+	// One build at a time; changes meanwhile start another once it finishes
+	if (!bCollisionDirty || bCollisionBuildInFlight || FPlatformTime::Seconds() - CollisionDirtyTime < CollisionRebuildDelay)
+	{
+		return;
+	}
+	bCollisionDirty = false;
+	bCollisionBuildInFlight = true;
+	
+	FGPUTessellationSettings CollisionSettings = TessellationSettings;
+	CollisionSettings.TessellationFactor = CollisionTessellationFactor;
+	
+	FGPUTessellationMeshBuilder::GenerateMeshAsync(CollisionSettings, GetComponentTransform().ToMatrixWithScale(),
+		DisplacementTexture.Get(), SubtractTexture.Get(), nullptr, EGPUTessellationReadbackContent::PositionsOnly).Then(
+		[WeakThis = TWeakObjectPtr<UGPUTessellationComponent>(this)](TFuture<FGPUTessellatedMeshData> Future)
+		{
+			if (UGPUTessellationComponent* Component = WeakThis.Get())
+			{
+				Component->OnCollisionPositionsExtracted(Future.Get());
+			}
+		});
+}
+
+void UGPUTessellationComponent::OnCollisionPositionsExtracted(const FGPUTessellatedMeshData& MeshData)
+{
+	if (!bGenerateCollision || !IsRegistered() || MeshData.Vertices.Num() == 0)
+	{
+		bCollisionBuildInFlight = false;
+		WakeTick();
+		return;
+	}
+	
+	CollisionVertices = MeshData.Vertices;
+	CollisionResolution = FIntPoint(MeshData.ResolutionX, MeshData.ResolutionY);
+	
+	CookingBodySetup = NewObject<UBodySetup>(this, NAME_None, IsTemplate() ? RF_Public | RF_ArchetypeObject : RF_NoFlags);
+	CookingBodySetup->BodySetupGuid = FGuid::NewGuid();
+	CookingBodySetup->bGenerateMirroredCollision = false;
+	CookingBodySetup->bDoubleSidedGeometry = true;
+	CookingBodySetup->CollisionTraceFlag = CTF_UseComplexAsSimple;
+	CookingBodySetup->CreatePhysicsMeshesAsync(
+		FOnAsyncPhysicsCookFinished::CreateUObject(this, &UGPUTessellationComponent::FinishPhysicsAsyncCook, CookingBodySetup.Get()));
+}
+
+void UGPUTessellationComponent::FinishPhysicsAsyncCook(bool bSuccess, UBodySetup* FinishedBodySetup)
+{
+	if (FinishedBodySetup != CookingBodySetup)
+	{
+		return;
+	}
+	CookingBodySetup = nullptr;
+	bCollisionBuildInFlight = false;
+	
+	// Changes made during the build, or collision switched off meanwhile
+	WakeTick();
+	
+	if (bSuccess && bGenerateCollision)
+	{
+		CollisionBodySetup = FinishedBodySetup;
+		ApplyGeneratedCollisionProfile();
+		RecreatePhysicsState();
+	}
+}
+
+void UGPUTessellationComponent::ClearCollision()
+{
+	CollisionVertices.Empty();
+	CollisionResolution = FIntPoint::ZeroValue;
+	CollisionBodySetup = nullptr;
+	RecreatePhysicsState();
+}
+
+void UGPUTessellationComponent::ApplyGeneratedCollisionProfile()
+{
+	// Components without collision keep the inherited profile, so existing assets serialize no new delta
+	if (GetCollisionProfileName() == GetDefault<UGPUTessellationComponent>()->GetCollisionProfileName())
+	{
+		SetCollisionProfileName(UCollisionProfile::BlockAll_ProfileName);
+	}
+}
+
 #if WITH_EDITOR
 void UGPUTessellationComponent::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
 {
 	Super::PostEditChangeProperty(PropertyChangedEvent);
 	
+	// Turning collision on in the details panel shows the profile it will use right away
+	if (PropertyChangedEvent.GetPropertyName() == GET_MEMBER_NAME_CHECKED(UGPUTessellationComponent, bGenerateCollision) && bGenerateCollision)
+	{
+		ApplyGeneratedCollisionProfile();
+	}
+	
 	// Update mesh when properties change
 	if (PropertyChangedEvent.Property)
 	{
+		PendingRegenerationTrigger = EGPUTessellationRegenerationTrigger::PropertyEdit;
 		MarkRenderStateDirty();
+		RebuildCollision();
+		WakeTick();
 	}
 }
 #endif
 
 void UGPUTessellationComponent::UpdateTessellatedMesh()
 {
-	MarkRenderStateDirty();
+	RequestRegeneration(EGPUTessellationRegenerationTrigger::Explicit);
+	WakeTick();
+}
+
+void UGPUTessellationComponent::RequestRegeneration(EGPUTessellationRegenerationTrigger Trigger, TConstArrayView<FBox2f> DirtyUVRegions)
+{
+	if (!RefreshSceneProxyBuffers(Trigger, DirtyUVRegions))
+	{
+		PendingRegenerationTrigger = Trigger;
+		MarkRenderStateDirty();
+	}
+}
+
+bool UGPUTessellationComponent::RefreshSceneProxyBuffers(EGPUTessellationRegenerationTrigger Trigger, TConstArrayView<FBox2f> DirtyUVRegions)
+{
+	// A pending recreate will pick up the new state anyway
+	if (!SceneProxy || !IsRenderStateCreated() || IsRenderStateDirty() || CVarGPUTessellationInPlaceRefresh.GetValueOnGameThread() == 0)
+	{
+		return false;
+	}
+	
+	// CreateSceneProxy returns no proxy for these settings
+	if (TessellationSettings.TessellationFactor <= 0.0f)
+	{
+		return false;
+	}
+	
+	// New resolution or patch count means new buffers, indices and vertex factories
+	FGPUTessellationSceneProxy* TessSceneProxy = static_cast<FGPUTessellationSceneProxy*>(SceneProxy);
+	const FGPUTessellationSettings RenderSettings = GetRenderSettings();
+	if (TessSceneProxy->GetLayout() != FGPUTessellationProxyLayout::Make(RenderSettings, GetLODTessellationFactor()))
+	{
+		return false;
+	}
+	
+	// Plane size and displacement drive the bounds (a region refresh changes neither)
+	if (DirtyUVRegions.Num() == 0)
+	{
+		MarkRenderTransformDirty();
+	}
+	
+	// Same default as the scene proxy when no camera has been seen yet
+	const FVector CameraPosition = LastCameraPosition.IsZero() ? GetComponentLocation() + FVector(0, 0, 2000.0f) : LastCameraPosition;
+	
+	ENQUEUE_RENDER_COMMAND(RefreshGPUTessellationBuffers)(
+		[TessSceneProxy, Settings = RenderSettings, LODTessellationFactor = GetLODTessellationFactor(),
+		 LocalToWorld = GetComponentTransform().ToMatrixWithScale(), CameraPosition,
+		 DisplacementTexture = DisplacementTexture.Get(), SubtractTexture = SubtractTexture.Get(), NormalMapTexture = NormalMapTexture.Get(),
+		 Trigger, DirtyUVRegions = TArray<FBox2f>(DirtyUVRegions)]
+		(FRHICommandListImmediate& RHICmdList)
+		{
+			TessSceneProxy->RefreshMeshBuffers_RenderThread(RHICmdList, Settings, LODTessellationFactor, LocalToWorld, CameraPosition,
+				DisplacementTexture, SubtractTexture, NormalMapTexture, Trigger, DirtyUVRegions);
+		});
+	
+	return true;
 }
 
 void UGPUTessellationComponent::SetDisplacementTexture(UTexture* InTexture)
 {
 	DisplacementTexture = InTexture;
-	UpdateTessellatedMesh();
+	RequestRegeneration(EGPUTessellationRegenerationTrigger::SettingsChanged);
+	RebuildCollision();
 }
 
 void UGPUTessellationComponent::SetSubtractTexture(UTexture* InTexture)
 {
 	SubtractTexture = InTexture;
-	UpdateTessellatedMesh();
+	RequestRegeneration(EGPUTessellationRegenerationTrigger::SettingsChanged);
+	RebuildCollision();
 }
 
 void UGPUTessellationComponent::SetNormalMapTexture(UTexture* InTexture)
 {
 	NormalMapTexture = InTexture;
-	UpdateTessellatedMesh();
+	RequestRegeneration(EGPUTessellationRegenerationTrigger::SettingsChanged);
+	WakeTick();
 }
 
 void UGPUTessellationComponent::SetMaterial(int32 ElementIndex, UMaterialInterface* InMaterial)
@@ -288,6 +827,7 @@ void UGPUTessellationComponent::SetMaterial(int32 ElementIndex, UMaterialInterfa
 	if (ElementIndex == 0)
 	{
 		Material = InMaterial;
+		PendingRegenerationTrigger = EGPUTessellationRegenerationTrigger::MaterialChanged;
 		MarkRenderStateDirty();
 	}
 }
@@ -295,7 +835,9 @@ void UGPUTessellationComponent::SetMaterial(int32 ElementIndex, UMaterialInterfa
 void UGPUTessellationComponent::UpdateSettings(const FGPUTessellationSettings& NewSettings)
 {
 	TessellationSettings = NewSettings;
-	UpdateTessellatedMesh();
+	RequestRegeneration(EGPUTessellationRegenerationTrigger::SettingsChanged);
+	RebuildCollision();
+	WakeTick();
 }
 
 FIntPoint UGPUTessellationComponent::GetTessellationResolution() const
@@ -315,6 +857,115 @@ int32 UGPUTessellationComponent::GetTriangleCount() const
 	return (Res.X - 1) * (Res.Y - 1) * 2;
 }
 
+FGPUTessellationBufferMemory UGPUTessellationComponent::GetBufferMemory() const
+{
+	// The proxy outlives SceneProxy being cleared, so reading through it here is safe
+	return SceneProxy ? static_cast<const FGPUTessellationSceneProxy*>(SceneProxy)->GetBufferMemory() : FGPUTessellationBufferMemory();
+}
+
+int64 UGPUTessellationComponent::GetRenderedVertexCount() const
+{
+	return SceneProxy ? static_cast<const FGPUTessellationSceneProxy*>(SceneProxy)->GetRenderedVertexCount() : 0;
+}
+
+const FGPUTessellationCachedMesh* UGPUTessellationComponent::GetSingleMeshMemory(uint64& OutBytes) const
+{
+	OutBytes = 0;
+	return SceneProxy ? static_cast<const FGPUTessellationSceneProxy*>(SceneProxy)->GetSingleMeshMemory(OutBytes) : nullptr;
+}
+
+void UGPUTessellationComponent::SetBudgetLODBias(int32 InBias)
+{
+	InBias = FMath::Max(InBias, 0);
+	if (InBias == BudgetLODBias)
+	{
+		return;
+	}
+	
+	BudgetLODBias = InBias;
+	if (IsRegistered())
+	{
+		RequestRegeneration(EGPUTessellationRegenerationTrigger::Budget);
+	}
+}
+
+FGPUTessellationSettings UGPUTessellationComponent::GetRenderSettings() const
+{
+	FGPUTessellationSettings RenderSettings = TessellationSettings;
+	if (BudgetLODBias == 0)
+	{
+		return RenderSettings;
+	}
+	
+	RenderSettings.TessellationFactor = ApplyBudgetLODBias(TessellationSettings.TessellationFactor);
+	
+	// Spatial patches: every distance band uses the level of the band BudgetLODBias steps further out
+	const TArray<EGPUTessellationPatchLevel>& Levels = TessellationSettings.PatchLevels;
+	for (int32 Index = 0; Index < Levels.Num(); ++Index)
+	{
+		RenderSettings.PatchLevels[Index] = Levels[FMath::Min(Index + BudgetLODBias, Levels.Num() - 1)];
+	}
+	return RenderSettings;
+}
+
+void UGPUTessellationComponent::GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize)
+{
+	Super::GetResourceSizeEx(CumulativeResourceSize);
+	CumulativeResourceSize.AddDedicatedVideoMemoryBytes(GetBufferMemory().GetTotalBytes());
+}
+
+/**
+ * Log the GPU buffer memory of every tessellation component, largest first
+ */
+static void MemoryReportCommand()
+{
+	TArray<TPair<const UGPUTessellationComponent*, FGPUTessellationBufferMemory>> Components;
+	for (TObjectIterator<UGPUTessellationComponent> It; It; ++It)
+	{
+		if (!It->IsTemplate())
+		{
+			Components.Emplace(*It, It->GetBufferMemory());
+		}
+	}
+	Components.Sort([](const auto& A, const auto& B) { return A.Value.GetTotalBytes() > B.Value.GetTotalBytes(); });
+	
+	const double BytesToKB = 1.0 / 1024.0;
+	UE_LOG(LogGPUTessellation, Log, TEXT("GPUTessellation.MemoryReport: %d components (KB)"), Components.Num());
+	UE_LOG(LogGPUTessellation, Log, TEXT("  %10s %10s %10s %10s %10s %10s  Component"), TEXT("Total"), TEXT("Position"), TEXT("Normal"), TEXT("UV"), TEXT("Tangent"), TEXT("Index"));
+	for (const auto& Entry : Components)
+	{
+		const FGPUTessellationBufferMemory& Memory = Entry.Value;
+		UE_LOG(LogGPUTessellation, Log, TEXT("  %10.1f %10.1f %10.1f %10.1f %10.1f %10.1f  %s"),
+			Memory.GetTotalBytes() * BytesToKB, Memory.PositionBytes * BytesToKB, Memory.NormalBytes * BytesToKB,
+			Memory.UVBytes * BytesToKB, Memory.TangentBytes * BytesToKB, Memory.IndexBytes * BytesToKB, *Entry.Key->GetFullName());
+	}
+	
+	const FGPUTessellationBufferMemory Total = GPUTessellationStats::GetTotalBufferMemory();
+	UE_LOG(LogGPUTessellation, Log, TEXT("  %10.1f %10.1f %10.1f %10.1f %10.1f %10.1f  (all scene proxies)"),
+		Total.GetTotalBytes() * BytesToKB, Total.PositionBytes * BytesToKB, Total.NormalBytes * BytesToKB,
+		Total.UVBytes * BytesToKB, Total.TangentBytes * BytesToKB, Total.IndexBytes * BytesToKB);
+	UE_LOG(LogGPUTessellation, Log, TEXT("  %10.1f  (counted more than once above: shared through the mesh cache)"),
+		FGPUTessellationMeshCache::GetSharedBytes() * BytesToKB);
+}
+
+static FAutoConsoleCommand GMemoryReportCommand(
+	TEXT("GPUTessellation.MemoryReport"),
+	TEXT("Log the GPU buffer memory of every tessellation component by stream"),
+	FConsoleCommandDelegate::CreateStatic(&MemoryReportCommand));
+
+TFuture<FGPUTessellatedMeshData> UGPUTessellationComponent::ExtractMeshAsync() const
+{
+	// Same factor the scene proxy renders with
+	FGPUTessellationSettings EffectiveSettings = GetRenderSettings();
+	if (TessellationSettings.LODMode != EGPUTessellationLODMode::Disabled)
+	{
+		EffectiveSettings.TessellationFactor = GetLODTessellationFactor();
+	}
+	
+	return FGPUTessellationMeshBuilder::GenerateMeshAsync(EffectiveSettings, GetComponentTransform().ToMatrixWithScale(),
+		DisplacementTexture.Get(), SubtractTexture.Get(), NormalMapTexture.Get());
+}
+
 void UGPUTessellationComponent::MarkRenderStateDirty()
 {
 	Super::MarkRenderStateDirty();
@@ -325,8 +976,8 @@ FIntPoint UGPUTessellationComponent::CalculateGridResolution() const
 	// Calculate resolution based on tessellation factor
 	// When LOD is enabled, use the calculated LOD factor; otherwise use user's TessellationFactor
 	int32 EffectiveTessellationFactor = (TessellationSettings.LODMode != EGPUTessellationLODMode::Disabled) 
-		? LastAppliedTessFactor 
-		: TessellationSettings.TessellationFactor;
+		? GetLODTessellationFactor()
+		: ApplyBudgetLODBias(TessellationSettings.TessellationFactor);
 	
 	int32 Resolution = EffectiveTessellationFactor * 4;
 	Resolution = FMath::Clamp(Resolution, 4, 1024);  // Max 1024 to support tessellation up to 256
@@ -341,43 +992,12 @@ FIntPoint UGPUTessellationComponent::CalculateGridResolution() const
 void UGPUTessellationComponent::UpdateDistanceBasedLOD(float DeltaTime)
 {
 	// Get camera position - works in both editor and game mode
-	UWorld* World = GetWorld();
-	if (!World)
-	{
-		return;
-	}
-	
 	FVector CameraPos = FVector::ZeroVector;
-	bool bFoundCamera = false;
-	
-	// Try to get camera from player controller (game mode)
-	if (APlayerController* PC = World->GetFirstPlayerController())
-	{
-		FVector ViewLocation;
-		FRotator ViewRotation;
-		PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
-		CameraPos = ViewLocation;
-		bFoundCamera = true;
-	}
-#if WITH_EDITOR
-	// In editor, use editor viewport camera
-	else if (GEditor && GEditor->GetActiveViewport())
-	{
-		FViewport* Viewport = GEditor->GetActiveViewport();
-		FEditorViewportClient* ViewportClient = static_cast<FEditorViewportClient*>(Viewport->GetClient());
-		if (ViewportClient)
-		{
-			CameraPos = ViewportClient->GetViewLocation();
-			bFoundCamera = true;
-		}
-	}
-#endif
-	
-	if (!bFoundCamera)
+	if (!GetLODViewLocation(CameraPos))
 	{
 		if (bEnableDebugLogging)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("GPUTessellation LOD: NO CAMERA FOUND!"));
+			UE_LOG(LogGPUTessellation, Log, TEXT("GPUTessellation LOD: NO CAMERA FOUND!"));
 		}
 		return;
 	}
@@ -430,19 +1050,19 @@ void UGPUTessellationComponent::UpdateDistanceBasedLOD(float DeltaTime)
 				DistanceZone = FString::Printf(TEXT("TRANSITION (%.1f%% through range)"), Percentage);
 			}
 			
-			UE_LOG(LogTemp, Warning, TEXT("GPUTessellation LOD Status:"));
-			UE_LOG(LogTemp, Warning, TEXT("  Camera: %s (moved %.1f since last frame)"), *CameraPos.ToString(), CameraMovement);
-			UE_LOG(LogTemp, Warning, TEXT("  Component: %s, Scale: %.2f (max component)"), *ComponentPos.ToString(), MaxScale);
-			UE_LOG(LogTemp, Warning, TEXT("  Distance: %.1f units (%.1f meters) - %s"), Distance, Distance / 100.0f, *DistanceZone);
-			UE_LOG(LogTemp, Warning, TEXT("  Distance Range (scaled): %.1f to %.1f (base: %.1f to %.1f, scale: %.2fx)"), 
+			UE_LOG(LogGPUTessellation, Log, TEXT("GPUTessellation LOD Status:"));
+			UE_LOG(LogGPUTessellation, Log, TEXT("  Camera: %s (moved %.1f since last frame)"), *CameraPos.ToString(), CameraMovement);
+			UE_LOG(LogGPUTessellation, Log, TEXT("  Component: %s, Scale: %.2f (max component)"), *ComponentPos.ToString(), MaxScale);
+			UE_LOG(LogGPUTessellation, Log, TEXT("  Distance: %.1f units (%.1f meters) - %s"), Distance, Distance / 100.0f, *DistanceZone);
+			UE_LOG(LogGPUTessellation, Log, TEXT("  Distance Range (scaled): %.1f to %.1f (base: %.1f to %.1f, scale: %.2fx)"), 
 				ScaledMinDistance, ScaledMaxDistance,
 				TessellationSettings.MinTessellationDistance, TessellationSettings.MaxTessellationDistance,
 				MaxScale);
-			UE_LOG(LogTemp, Warning, TEXT("  Target LOD: %d, Current: %.1f, Applied: %d"), TargetTessFactor, CurrentLODLevel, LastAppliedTessFactor);
-			UE_LOG(LogTemp, Warning, TEXT("  Factor Range: %d (max) to %d (min)"), TessellationSettings.MaxTessellationFactor, TessellationSettings.MinTessellationFactor);
-			UE_LOG(LogTemp, Warning, TEXT("  User TessellationFactor: %d (NOT modified by LOD)"), TessellationSettings.TessellationFactor);
-			UE_LOG(LogTemp, Warning, TEXT("  Mode: %s, DeltaTime: %.4f"), 
-				World->WorldType == EWorldType::Editor ? TEXT("Editor") : TEXT("Game"), DeltaTime);
+			UE_LOG(LogGPUTessellation, Log, TEXT("  Target LOD: %d, Current: %.1f, Applied: %d"), TargetTessFactor, CurrentLODLevel, LastAppliedTessFactor);
+			UE_LOG(LogGPUTessellation, Log, TEXT("  Factor Range: %d (max) to %d (min)"), TessellationSettings.MaxTessellationFactor, TessellationSettings.MinTessellationFactor);
+			UE_LOG(LogGPUTessellation, Log, TEXT("  User TessellationFactor: %d (NOT modified by LOD)"), TessellationSettings.TessellationFactor);
+			UE_LOG(LogGPUTessellation, Log, TEXT("  Mode: %s, DeltaTime: %.4f"), 
+				GetWorld()->WorldType == EWorldType::Editor ? TEXT("Editor") : TEXT("Game"), DeltaTime);
 		}
 	}
 	
@@ -469,21 +1089,52 @@ void UGPUTessellationComponent::UpdateDistanceBasedLOD(float DeltaTime)
 		// LOD changed significantly - apply it (store for grid resolution calculation)
 		if (bEnableDebugLogging)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━"));
-			UE_LOG(LogTemp, Warning, TEXT("GPUTessellation: LOD TRANSITION"));
-			UE_LOG(LogTemp, Warning, TEXT("  Change: %d -> %d (diff: %d, hysteresis: %d)"),
+			UE_LOG(LogGPUTessellation, Log, TEXT("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━"));
+			UE_LOG(LogGPUTessellation, Log, TEXT("GPUTessellation: LOD TRANSITION"));
+			UE_LOG(LogGPUTessellation, Log, TEXT("  Change: %d -> %d (diff: %d, hysteresis: %d)"),
 				LastAppliedTessFactor, NewTessFactor, FMath::Abs(NewTessFactor - LastAppliedTessFactor), TessellationSettings.LODHysteresis);
-			UE_LOG(LogTemp, Warning, TEXT("  Distance: %.1f units (%.1f meters)"), Distance, Distance / 100.0f);
-			UE_LOG(LogTemp, Warning, TEXT("  Camera: %s"), *CameraPos.ToString());
-			UE_LOG(LogTemp, Warning, TEXT("  Component: %s"), *ComponentPos.ToString());
-			UE_LOG(LogTemp, Warning, TEXT("  TessellationFactor preserved: %d"), TessellationSettings.TessellationFactor);
-			UE_LOG(LogTemp, Warning, TEXT("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━"));
+			UE_LOG(LogGPUTessellation, Log, TEXT("  Distance: %.1f units (%.1f meters)"), Distance, Distance / 100.0f);
+			UE_LOG(LogGPUTessellation, Log, TEXT("  Camera: %s"), *CameraPos.ToString());
+			UE_LOG(LogGPUTessellation, Log, TEXT("  Component: %s"), *ComponentPos.ToString());
+			UE_LOG(LogGPUTessellation, Log, TEXT("  TessellationFactor preserved: %d"), TessellationSettings.TessellationFactor);
+			UE_LOG(LogGPUTessellation, Log, TEXT("━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━"));
 		}
 		
 		// CRITICAL: Store LOD factor separately - DO NOT modify user's TessellationFactor!
 		LastAppliedTessFactor = NewTessFactor;
-		MarkRenderStateDirty();
+		RequestRegeneration(EGPUTessellationRegenerationTrigger::LODChanged);
 	}
+	
+	// Sleep once the smoothed level has caught up with the target
+	const bool bConverged = FMath::Abs(CurrentLODLevel - (float)TargetTessFactor) <= 0.5f;
+	SetLODWakeSphere(CameraPos, bConverged ? CalculateDistanceLODWakeRadius(Distance, ScaledMinDistance, ScaledMaxDistance, TargetTessFactor) : 0.0f);
+}
+
+float UGPUTessellationComponent::CalculateDistanceLODWakeRadius(float Distance, float ScaledMinDistance, float ScaledMaxDistance, int32 TargetTessFactor) const
+{
+	// Same failsafe as CalculateLODFactorScaled
+	float MinDist = ScaledMinDistance;
+	float MaxDist = ScaledMinDistance >= ScaledMaxDistance ? ScaledMinDistance + 1000.0f : ScaledMaxDistance;
+	
+	// The distance to the view changes no faster than the view moves, and the factor only changes inside the
+	// transition range, at most 1.5x the average slope there (smoothstep)
+	const float DistanceToTransition = FMath::Max3(MinDist - Distance, Distance - MaxDist, 0.0f);
+	const float MaxSlope = 1.5f * FMath::Abs((float)(TessellationSettings.MaxTessellationFactor - TessellationSettings.MinTessellationFactor)) / (MaxDist - MinDist);
+	if (MaxSlope <= UE_KINDA_SMALL_NUMBER)
+	{
+		return UE_BIG_NUMBER;
+	}
+	
+	// The unrounded target is within 0.5 of TargetTessFactor; the applied factor changes once it rounds past the hysteresis
+	const float FactorSlack = (float)(TessellationSettings.LODHysteresis - FMath::Abs(TargetTessFactor - LastAppliedTessFactor));
+	return DistanceToTransition + FMath::Max(FactorSlack, 0.0f) / MaxSlope;
+}
+
+void UGPUTessellationComponent::SetLODWakeSphere(const FVector& ViewLocation, float WakeRadius)
+{
+	bLODHasView = true;
+	LODWakeLocation = ViewLocation;
+	LODWakeRadius = WakeRadius;
 }
 
 void UGPUTessellationComponent::UpdateDensityBasedLOD(float DeltaTime)
@@ -494,6 +1145,17 @@ void UGPUTessellationComponent::UpdateDensityBasedLOD(float DeltaTime)
 	UpdateDistanceBasedLOD(DeltaTime);
 }
 
+bool UGPUTessellationComponent::GetLODViewLocation(FVector& OutLocation) const
+{
+	// Views are resolved once per frame and shared by every component in the world
+	if (const FGPUTessellationView* View = UGPUTessellationViewSubsystem::FindNearestView(GetWorld(), Bounds.Origin))
+	{
+		OutLocation = View->Location;
+		return true;
+	}
+	return false;
+}
+
 float UGPUTessellationComponent::CalculateDistanceToCamera(const FVector& CameraPos, FVector& OutComponentPos) const
 {
 	OutComponentPos = GetComponentLocation();
@@ -531,39 +1193,8 @@ float UGPUTessellationComponent::CalculateDistanceToCamera(const FVector& Camera
 void UGPUTessellationComponent::UpdateDiscreteLOD(float DeltaTime)
 {
 	// Get camera position
-	UWorld* World = GetWorld();
-	if (!World)
-	{
-		return;
-	}
-	
 	FVector CameraPos = FVector::ZeroVector;
-	bool bFoundCamera = false;
-	
-	// Try to get camera from player controller (game mode)
-	if (APlayerController* PC = World->GetFirstPlayerController())
-	{
-		FVector ViewLocation;
-		FRotator ViewRotation;
-		PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
-		CameraPos = ViewLocation;
-		bFoundCamera = true;
-	}
-#if WITH_EDITOR
-	// In editor, use editor viewport camera
-	else if (GEditor && GEditor->GetActiveViewport())
-	{
-		FViewport* Viewport = GEditor->GetActiveViewport();
-		FEditorViewportClient* ViewportClient = static_cast<FEditorViewportClient*>(Viewport->GetClient());
-		if (ViewportClient)
-		{
-			CameraPos = ViewportClient->GetViewLocation();
-			bFoundCamera = true;
-		}
-	}
-#endif
-	
-	if (!bFoundCamera)
+	if (!GetLODViewLocation(CameraPos))
 	{
 		return;
 	}
@@ -617,17 +1248,25 @@ void UGPUTessellationComponent::UpdateDiscreteLOD(float DeltaTime)
 		default: TargetTessFactor = 16; break;
 	}
 	
+	// Nothing changes until the scaled distance crosses a threshold
+	float WakeRadius = UE_BIG_NUMBER;
+	for (int32 i = 0; i < TessellationSettings.DiscreteLODDistances.Num() && i < TessellationSettings.DiscreteLODLevels.Num(); ++i)
+	{
+		WakeRadius = FMath::Min(WakeRadius, FMath::Abs(ScaledDistance - TessellationSettings.DiscreteLODDistances[i]) * MaxScale);
+	}
+	SetLODWakeSphere(CameraPos, WakeRadius);
+	
 	// Apply hysteresis to prevent oscillation
 	int32 Difference = FMath::Abs(TargetTessFactor - LastAppliedTessFactor);
 	if (Difference >= TessellationSettings.LODHysteresis)
 	{
 		LastAppliedTessFactor = TargetTessFactor;
 		CurrentLODLevel = static_cast<float>(TargetTessFactor);
-		MarkRenderStateDirty();
+		RequestRegeneration(EGPUTessellationRegenerationTrigger::LODChanged);
 		
 		if (bEnableDebugLogging)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("GPUTessellation Discrete LOD: Distance=%.1f (scaled=%.1f), Level=%d"), 
+			UE_LOG(LogGPUTessellation, Log, TEXT("GPUTessellation Discrete LOD: Distance=%.1f (scaled=%.1f), Level=%d"), 
 				Distance, ScaledDistance, TargetTessFactor);
 		}
 	}
@@ -638,46 +1277,31 @@ void UGPUTessellationComponent::UpdatePatchBasedLOD(float DeltaTime)
 	// Spatial patch system generates patches with per-patch LOD based on camera distance
 	// Track camera position and send updates to scene proxy when camera moves significantly
 	
-	// Get camera position (same logic as other LOD modes)
-	FVector CameraPos = FVector::ZeroVector;
-	bool bFoundCamera = false;
-	
-	if (UWorld* World = GetWorld())
-	{
-		if (APlayerController* PC = World->GetFirstPlayerController())
-		{
-			FVector ViewLocation;
-			FRotator ViewRotation;
-			PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
-			CameraPos = ViewLocation;
-			bFoundCamera = true;
-		}
-	}
-	
-#if WITH_EDITOR
-	// In editor, use editor viewport camera
-	if (!bFoundCamera && GEditor && GEditor->GetActiveViewport())
+	// Keep filling the proxy's back patch set while a regeneration spans several frames
+	if (SceneProxy)
 	{
-		FViewport* Viewport = GEditor->GetActiveViewport();
-		FEditorViewportClient* ViewportClient = static_cast<FEditorViewportClient*>(Viewport->GetClient());
-		if (ViewportClient)
+		FGPUTessellationSceneProxy* TessSceneProxy = static_cast<FGPUTessellationSceneProxy*>(SceneProxy);
+		if (TessSceneProxy->IsPatchRegenerationPending())
 		{
-			CameraPos = ViewportClient->GetViewLocation();
-			bFoundCamera = true;
+			ENQUEUE_RENDER_COMMAND(AdvanceGPUTessellationPatches)(
+				[TessSceneProxy](FRHICommandListImmediate& RHICmdList)
+				{
+					TessSceneProxy->AdvancePatchRegeneration_RenderThread(RHICmdList);
+				});
 		}
 	}
-#endif
 	
-	if (!bFoundCamera)
+	// Get camera position (same logic as other LOD modes)
+	FVector CameraPos = FVector::ZeroVector;
+	if (!GetLODViewLocation(CameraPos))
 	{
 		if (bEnableDebugLogging)
 		{
-			static double LastWarningTime = 0.0;
 			double CurrentTime = FPlatformTime::Seconds();
-			if (CurrentTime - LastWarningTime >= 5.0)
+			if (CurrentTime - LastNoCameraWarningTime >= 5.0)
 			{
-				LastWarningTime = CurrentTime;
-				UE_LOG(LogTemp, Warning, TEXT("GPUTessellation Patch LOD: NO CAMERA FOUND!"));
+				LastNoCameraWarningTime = CurrentTime;
+				UE_LOG(LogGPUTessellation, Log, TEXT("GPUTessellation Patch LOD: NO CAMERA FOUND!"));
 			}
 		}
 		return;
@@ -706,10 +1330,13 @@ void UGPUTessellationComponent::UpdatePatchBasedLOD(float DeltaTime)
 		
 		if (bEnableDebugLogging)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("GPUTessellation Patch LOD: Camera moved %.1f units (threshold %.1f) - Updating patches with camera at: %s"), 
+			UE_LOG(LogGPUTessellation, Log, TEXT("GPUTessellation Patch LOD: Camera moved %.1f units (threshold %.1f) - Updating patches with camera at: %s"), 
 				CameraMovement, ScaledThreshold, *CameraPos.ToString());
 		}
 	}
+	
+	// Patches were built for LastCameraPosition; the next update is due once the view leaves the threshold
+	SetLODWakeSphere(LastCameraPosition, ScaledThreshold);
 }
 
 void UGPUTessellationComponent::SendRenderDynamicData_Concurrent()
@@ -729,7 +1356,7 @@ void UGPUTessellationComponent::SendRenderDynamicData_Concurrent()
 		ENQUEUE_RENDER_COMMAND(SendGPUTessellationDynamicData)(
 			[TessSceneProxy, DynamicData](FRHICommandListImmediate& RHICmdList)
 			{
-				TessSceneProxy->UpdateDynamicData_RenderThread(DynamicData);
+				TessSceneProxy->UpdateDynamicData_RenderThread(RHICmdList, DynamicData);
 			});
 	}
 }
@@ -8,4 +8,8 @@ IMPLEMENT_GLOBAL_SHADER(FGPUTessellationFactorCS, "/Plugin/GPURuntimeTessellatio
 IMPLEMENT_GLOBAL_SHADER(FGPUVertexGenerationCS, "/Plugin/GPURuntimeTessellation/Private/GPUVertexGeneration.usf", "GenerateVertices", SF_Compute);
 IMPLEMENT_GLOBAL_SHADER(FGPUDisplacementCS, "/Plugin/GPURuntimeTessellation/Private/GPUDisplacement.usf", "ApplyDisplacement", SF_Compute);
 IMPLEMENT_GLOBAL_SHADER(FGPUNormalCalculationCS, "/Plugin/GPURuntimeTessellation/Private/GPUNormalCalculation.usf", "CalculateNormals", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FGPUTangentCalculationCS, "/Plugin/GPURuntimeTessellation/Private/GPUTangentCalculation.usf", "CalculateTangentsCS", SF_Compute);
 IMPLEMENT_GLOBAL_SHADER(FGPUIndexGenerationCS, "/Plugin/GPURuntimeTessellation/Private/GPUIndexGeneration.usf", "GenerateIndices", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FGPUPatchIndirectArgsCS, "/Plugin/GPURuntimeTessellation/Private/GPUPatchIndirectArgs.usf", "BuildIndirectArgs", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FGPUContentChecksumCS, "/Plugin/GPURuntimeTessellation/Private/GPUContentChecksum.usf", "ComputeChecksum", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FGPUReadbackPackCS, "/Plugin/GPURuntimeTessellation/Private/GPUReadbackPack.usf", "PackVertices", SF_Compute);
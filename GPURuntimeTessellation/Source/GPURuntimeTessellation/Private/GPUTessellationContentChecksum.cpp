@@ -0,0 +1,137 @@
+// Licensed under the MIT License. See LICENSE file in the project root.
+
+#include "GPUTessellationContentChecksum.h"
+#include "GPUTessellationComputeShaders.h"
+#include "Engine/TextureRenderTarget2D.h"
+#include "RenderGraphBuilder.h"
+#include "RenderGraphUtils.h"
+#include "RenderingThread.h"
+#include "RHIGPUReadback.h"
+#include "TextureResource.h"
+
+FGPUTessellationContentChecksum::FGPUTessellationContentChecksum()
+	: bReadbackInFlight(false)
+	, bChanged(false)
+{
+}
+
+FGPUTessellationContentChecksum::~FGPUTessellationContentChecksum()
+{
+}
+
+void FGPUTessellationContentChecksum::Update(TConstArrayView<UTexture*> Textures)
+{
+	check(IsInGameThread());
+
+	FTextureResourceArray TextureResources;
+	for (UTexture* Texture : Textures)
+	{
+		// Only 2D render targets change behind our back; other textures go through Set*Texture
+		if (Texture && Texture->IsA<UTextureRenderTarget2D>() && Texture->GetResource() && TextureResources.Num() < MaxTextures)
+		{
+			TextureResources.Add(Texture->GetResource());
+		}
+	}
+
+	ENQUEUE_RENDER_COMMAND(GPUTessellationContentChecksum)(
+		[Checksum = AsShared(), TextureResources](FRHICommandListImmediate& RHICmdList)
+		{
+			Checksum->Update_RenderThread(RHICmdList, TextureResources);
+		});
+}
+
+bool FGPUTessellationContentChecksum::ConsumeChange()
+{
+	return bChanged.exchange(false, std::memory_order_relaxed);
+}
+
+void FGPUTessellationContentChecksum::Update_RenderThread(FRHICommandListImmediate& RHICmdList, const FTextureResourceArray& TextureResources)
+{
+	check(IsInRenderingThread());
+
+	// Collect the previous result once the GPU is done with it (never blocks)
+	if (bReadbackInFlight)
+	{
+		if (!Readback->IsReady())
+		{
+			return;
+		}
+
+		const int32 NumValues = InFlightResources.Num() * 2;
+		TArray<uint32, TFixedAllocator<MaxTextures * 2>> Checksum;
+		Checksum.SetNumZeroed(NumValues);
+		if (const void* Data = Readback->Lock(NumValues * sizeof(uint32)))
+		{
+			FMemory::Memcpy(Checksum.GetData(), Data, NumValues * sizeof(uint32));
+			Readback->Unlock();
+		}
+		bReadbackInFlight = false;
+
+		// Same textures as the baseline: a different checksum means new content
+		if (InFlightResources == BaselineResources && Checksum != BaselineChecksum)
+		{
+			bChanged.store(true, std::memory_order_relaxed);
+		}
+		BaselineResources = InFlightResources;
+		BaselineChecksum = Checksum;
+	}
+
+	if (TextureResources.Num() == 0)
+	{
+		BaselineResources.Reset();
+		BaselineChecksum.Reset();
+		return;
+	}
+
+	FRDGBuilder GraphBuilder(RHICmdList);
+
+	FRDGBufferRef ChecksumBuffer = GraphBuilder.CreateBuffer(
+		FRDGBufferDesc::CreateBufferDesc(sizeof(uint32), TextureResources.Num() * 2),
+		TEXT("GPUTessellation.ContentChecksum"));
+	FRDGBufferUAVRef ChecksumUAV = GraphBuilder.CreateUAV(FRDGBufferUAVDesc(ChecksumBuffer, PF_R32_UINT));
+	AddClearUAVPass(GraphBuilder, ChecksumUAV, 0u);
+
+	TShaderMapRef<FGPUContentChecksumCS> ComputeShader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
+
+	for (int32 Slot = 0; Slot < TextureResources.Num(); ++Slot)
+	{
+		FRHITexture* RHITexture = TextureResources[Slot]->TextureRHI;
+		if (!RHITexture)
+		{
+			continue;
+		}
+
+		const FIntVector TextureSize = RHITexture->GetSizeXYZ();
+
+		FGPUContentChecksumCS::FParameters* PassParameters = GraphBuilder.AllocParameters<FGPUContentChecksumCS::FParameters>();
+		PassParameters->TextureSize = FUintVector2(TextureSize.X, TextureSize.Y);
+		PassParameters->ChecksumSlot = Slot;
+		PassParameters->SourceTexture = GraphBuilder.RegisterExternalTexture(CreateRenderTarget(RHITexture, TEXT("GPUTessellation.ChecksumSource")));
+		PassParameters->OutChecksum = ChecksumUAV;
+
+		FIntVector GroupCount(
+			FMath::DivideAndRoundUp(TextureSize.X, 8),
+			FMath::DivideAndRoundUp(TextureSize.Y, 8),
+			1);
+
+		GraphBuilder.AddPass(
+			RDG_EVENT_NAME("GPUTessellation.ContentChecksum"),
+			PassParameters,
+			ERDGPassFlags::Compute,
+			[PassParameters, ComputeShader, GroupCount](FRHIComputeCommandList& RHICmdList)
+			{
+				FComputeShaderUtils::Dispatch(RHICmdList, ComputeShader, *PassParameters, GroupCount);
+			});
+	}
+
+	if (!Readback)
+	{
+		Readback = MakeUnique<FRHIGPUBufferReadback>(TEXT("GPUTessellation.ContentChecksumReadback"));
+	}
+	AddEnqueueCopyPass(GraphBuilder, Readback.Get(), ChecksumBuffer, TextureResources.Num() * 2 * sizeof(uint32));
+
+	GraphBuilder.Execute();
+
+	InFlightResources = TextureResources;
+	bReadbackInFlight = true;
+}
@@ -0,0 +1,636 @@
+// Licensed under the MIT License. See LICENSE file in the project root.
+
+#include "GPUTessellationDiskCache.h"
+#include "GPUTessellationCPUBackend.h"
+#include "GPUTessellationStats.h"
+#include "GPUTessellationLog.h"
+#include "Engine/Texture.h"
+#include "Engine/TextureRenderTarget.h"
+#include "TextureResource.h"
+#include "Async/Async.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/App.h"
+#include "Misc/Compression.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "RenderingThread.h"
+#include "RenderResource.h"
+#include "UObject/Package.h"
+
+static TAutoConsoleVariable<int32> CVarGPUTessellationDiskCache(
+	TEXT("r.GPUTessellation.DiskCache"),
+	0,
+	TEXT("Keep generated single meshes on disk (Saved/GPUTessellation/MeshCache) so repeat loads skip the generation passes.\n")
+	TEXT(" 0: off (default)\n")
+	TEXT(" 1: read entries and write new ones\n")
+	TEXT(" 2: read entries only"),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<int32> CVarGPUTessellationDiskCacheMaxLoadWaitFrames(
+	TEXT("r.GPUTessellation.DiskCache.MaxLoadWaitFrames"),
+	4,
+	TEXT("Frames a regeneration waits for its disk cache entry to be read on a worker thread before generating the mesh instead.\n")
+	TEXT("The proxy keeps drawing its current mesh, if it has one, while it waits."),
+	ECVF_RenderThreadSafe);
+
+namespace GPUTessellationDiskCache
+{
+	/** "GTMC" */
+	static constexpr uint32 Magic = 0x434D5447;
+
+	/** Bump when the entry layout or what the generation passes compute changes */
+	static constexpr uint32 FormatVersion = 1;
+
+	/** Values per vertex in the payload: height, octahedral normal X and Y */
+	static constexpr int32 ValuesPerVertex = 3;
+
+	/**
+	 * What precedes the compressed payload of an entry
+	 */
+	struct FEntryHeader
+	{
+		uint32 Magic = 0;
+		uint32 Version = 0;
+		int32 ResolutionX = 0;
+		int32 ResolutionY = 0;
+
+		/** Height of quantized step 0, and the height of one step */
+		float HeightMin = 0.0f;
+		float HeightStep = 0.0f;
+
+		int32 UncompressedSize = 0;
+		int32 CompressedSize = 0;
+
+		friend FArchive& operator<<(FArchive& Ar, FEntryHeader& Header)
+		{
+			Ar << Header.Magic << Header.Version << Header.ResolutionX << Header.ResolutionY;
+			Ar << Header.HeightMin << Header.HeightStep << Header.UncompressedSize << Header.CompressedSize;
+			return Ar;
+		}
+	};
+
+	/**
+	 * Stored mesh waiting for its readback (render thread)
+	 */
+	struct FPendingStore
+	{
+		FGPUTessellationDiskCacheKey Key;
+		FGPUTessellationSettings Settings;
+		FGPUTessellationMeshReadback Readback;
+	};
+
+	/** Keys being read back or written, so a mesh is stored once however many proxies generate it */
+	static FCriticalSection PendingKeysLock;
+	static TSet<FSHAHash> PendingKeys;
+
+	static bool BeginStore(const FSHAHash& Hash)
+	{
+		FScopeLock Lock(&PendingKeysLock);
+		bool bAlreadyPending = false;
+		PendingKeys.Add(Hash, &bAlreadyPending);
+		return !bAlreadyPending;
+	}
+
+	static void EndStore(const FSHAHash& Hash)
+	{
+		FScopeLock Lock(&PendingKeysLock);
+		PendingKeys.Remove(Hash);
+	}
+
+	/**
+	 * Readbacks of stored meshes; released with the RHI like the readback pool they draw from
+	 */
+	class FPendingStores : public FRenderResource
+	{
+	public:
+		TArray<TUniquePtr<FPendingStore>> Stores;
+
+		//~ Begin FRenderResource Interface
+		virtual void ReleaseRHI() override
+		{
+			// Dropped stores end here, so their keys can be stored again after the RHI comes back
+			for (const TUniquePtr<FPendingStore>& PendingStore : Stores)
+			{
+				EndStore(PendingStore->Key.Hash);
+			}
+			Stores.Empty();
+		}
+		//~ End FRenderResource Interface
+	};
+
+	static TGlobalResource<FPendingStores> GPendingStores;
+
+	static bool IsWriteEnabled()
+	{
+		return CVarGPUTessellationDiskCache.GetValueOnAnyThread() == 1;
+	}
+
+	static FString GetEntryPath(const FSHAHash& Hash)
+	{
+		return FGPUTessellationDiskCache::GetCacheDirectory() / Hash.ToString() + TEXT(".gtmesh");
+	}
+
+	template<typename ValueType>
+	static void UpdateHash(FSHA1& Sha, const ValueType& Value)
+	{
+		Sha.Update(reinterpret_cast<const uint8*>(&Value), sizeof(Value));
+	}
+
+	/** Hash what identifies a texture's texels across runs; false if nothing does */
+	static bool UpdateTextureHash(FSHA1& Sha, UTexture* Texture)
+	{
+		if (!Texture)
+		{
+			UpdateHash(Sha, FGuid());
+			return true;
+		}
+
+		// Render targets change contents without changing identity; transient textures are rebuilt every run
+		if (Texture->IsA<UTextureRenderTarget>() || Texture->HasAnyFlags(RF_Transient) || Texture->GetPackage() == GetTransientPackage())
+		{
+			return false;
+		}
+
+#if WITH_EDITORONLY_DATA
+		const FGuid Id = Texture->Source.IsValid() ? Texture->Source.GetId() : FGuid();
+#else
+		const FGuid Id = Texture->GetLightingGuid();
+#endif
+		if (!Id.IsValid())
+		{
+			return false;
+		}
+
+		// Settings that change the sampled texels without touching the source
+		UpdateHash(Sha, Id);
+		UpdateHash(Sha, (uint8)Texture->SRGB);
+		UpdateHash(Sha, (uint8)Texture->CompressionSettings.GetValue());
+		UpdateHash(Sha, Texture->LODBias);
+		return true;
+	}
+
+	/** Are all of a texture's mips resident, so the pipeline sampled its full resolution? */
+	static bool IsTextureResident(UTexture* Texture)
+	{
+		if (!Texture)
+		{
+			return true;
+		}
+
+		if (IsInGameThread())
+		{
+			return Texture->IsFullyStreamedIn();
+		}
+
+		// The render thread owns the streaming state of the resource
+		FTextureResource* Resource = Texture->GetResource();
+		if (!Resource)
+		{
+			return false;
+		}
+		const FStreamableTextureResource* StreamableResource = Resource->GetStreamableTextureResource();
+		return !StreamableResource || StreamableResource->GetState().NumResidentLODs >= StreamableResource->GetState().NumNonOptionalLODs;
+	}
+
+	static uint16 QuantizeSnorm(float Value)
+	{
+		return (uint16)(int16)FMath::RoundToInt(FMath::Clamp(Value, -1.0f, 1.0f) * 32767.0f);
+	}
+
+	static float DequantizeSnorm(uint16 Value)
+	{
+		return FMath::Max((float)(int16)Value / 32767.0f, -1.0f);
+	}
+
+	static float SignNotZero(float Value)
+	{
+		return Value >= 0.0f ? 1.0f : -1.0f;
+	}
+
+	/** Unit vector folded onto the octahedron's upper half and flattened to two coordinates */
+	static void EncodeOctahedral(const FVector3f& Normal, uint16& OutX, uint16& OutY)
+	{
+		const float L1Norm = FMath::Abs(Normal.X) + FMath::Abs(Normal.Y) + FMath::Abs(Normal.Z);
+		if (L1Norm <= 0.0f)
+		{
+			OutX = OutY = 0;
+			return;
+		}
+
+		FVector2f Octahedral(Normal.X / L1Norm, Normal.Y / L1Norm);
+		if (Normal.Z < 0.0f)
+		{
+			Octahedral = FVector2f(
+				(1.0f - FMath::Abs(Octahedral.Y)) * SignNotZero(Octahedral.X),
+				(1.0f - FMath::Abs(Octahedral.X)) * SignNotZero(Octahedral.Y));
+		}
+		OutX = QuantizeSnorm(Octahedral.X);
+		OutY = QuantizeSnorm(Octahedral.Y);
+	}
+
+	static FVector3f DecodeOctahedral(uint16 X, uint16 Y)
+	{
+		const FVector2f Octahedral(DequantizeSnorm(X), DequantizeSnorm(Y));
+		FVector3f Normal(Octahedral.X, Octahedral.Y, 1.0f - FMath::Abs(Octahedral.X) - FMath::Abs(Octahedral.Y));
+		if (Normal.Z < 0.0f)
+		{
+			Normal.X = (1.0f - FMath::Abs(Octahedral.Y)) * SignNotZero(Octahedral.X);
+			Normal.Y = (1.0f - FMath::Abs(Octahedral.X)) * SignNotZero(Octahedral.Y);
+		}
+		return Normal.GetSafeNormal();
+	}
+
+	/** Replace every value by its difference to the previous one; smooth fields turn into runs of small values */
+	static void DeltaEncode(TArrayView<uint16> Values)
+	{
+		uint16 Previous = 0;
+		for (uint16& Value : Values)
+		{
+			const uint16 Current = Value;
+			Value = (uint16)(Current - Previous);
+			Previous = Current;
+		}
+	}
+
+	static void DeltaDecode(TArrayView<uint16> Values)
+	{
+		uint16 Previous = 0;
+		for (uint16& Value : Values)
+		{
+			Value = (uint16)(Value + Previous);
+			Previous = Value;
+		}
+	}
+
+	/**
+	 * Quantize and compress a mesh
+	 * @return false unless the mesh is the settings' grid displaced along its up normals
+	 */
+	static bool EncodeEntry(const FGPUTessellationSettings& Settings, const FGPUTessellatedMeshData& MeshData, TArray<uint8>& OutEntry)
+	{
+		const FIntPoint Resolution = FGPUTessellationMeshBuilder::CalculateResolution(Settings.TessellationFactor);
+		const int32 VertexCount = Resolution.X * Resolution.Y;
+		if (MeshData.ResolutionX != Resolution.X || MeshData.ResolutionY != Resolution.Y
+			|| MeshData.Vertices.Num() != VertexCount || MeshData.Normals.Num() != VertexCount || MeshData.UVs.Num() != VertexCount)
+		{
+			return false;
+		}
+
+		// Only heights are stored, so everything else must be the flat grid rebuilt on load
+		FGPUTessellatedMeshData FlatGrid;
+		FGPUTessellationCPUBackend::GenerateVertices(Settings, Resolution, FlatGrid);
+
+		const float PositionTolerance = KINDA_SMALL_NUMBER * FMath::Max3(Settings.PlaneSizeX, Settings.PlaneSizeY, 1.0f);
+		float HeightMin = MAX_flt;
+		float HeightMax = -MAX_flt;
+		for (int32 VertexIndex = 0; VertexIndex < VertexCount; ++VertexIndex)
+		{
+			const FVector3f Offset = MeshData.Vertices[VertexIndex] - FlatGrid.Vertices[VertexIndex];
+			if (FMath::Abs(Offset.X) > PositionTolerance || FMath::Abs(Offset.Y) > PositionTolerance
+				|| !MeshData.UVs[VertexIndex].Equals(FlatGrid.UVs[VertexIndex], KINDA_SMALL_NUMBER))
+			{
+				return false;
+			}
+			HeightMin = FMath::Min(HeightMin, Offset.Z);
+			HeightMax = FMath::Max(HeightMax, Offset.Z);
+		}
+		if (!FMath::IsFinite(HeightMin) || !FMath::IsFinite(HeightMax))
+		{
+			return false;
+		}
+
+		// Planar layout: all heights, then all normal X, then all normal Y
+		FEntryHeader Header;
+		Header.Magic = Magic;
+		Header.Version = FormatVersion;
+		Header.ResolutionX = Resolution.X;
+		Header.ResolutionY = Resolution.Y;
+		Header.HeightMin = HeightMin;
+		Header.HeightStep = (HeightMax - HeightMin) / 65535.0f;
+
+		TArray<uint16> Payload;
+		Payload.SetNumUninitialized(VertexCount * ValuesPerVertex);
+		const TArrayView<uint16> Heights(Payload.GetData(), VertexCount);
+		const TArrayView<uint16> NormalsX(Payload.GetData() + VertexCount, VertexCount);
+		const TArrayView<uint16> NormalsY(Payload.GetData() + VertexCount * 2, VertexCount);
+		for (int32 VertexIndex = 0; VertexIndex < VertexCount; ++VertexIndex)
+		{
+			const float Height = MeshData.Vertices[VertexIndex].Z - FlatGrid.Vertices[VertexIndex].Z;
+			Heights[VertexIndex] = Header.HeightStep > 0.0f ? (uint16)FMath::Clamp(FMath::RoundToInt((Height - HeightMin) / Header.HeightStep), 0, 65535) : 0;
+			EncodeOctahedral(MeshData.Normals[VertexIndex], NormalsX[VertexIndex], NormalsY[VertexIndex]);
+		}
+		DeltaEncode(Heights);
+		DeltaEncode(NormalsX);
+		DeltaEncode(NormalsY);
+
+		Header.UncompressedSize = Payload.Num() * sizeof(uint16);
+		int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Oodle, Header.UncompressedSize);
+		TArray<uint8> Compressed;
+		Compressed.SetNumUninitialized(CompressedSize);
+		if (!FCompression::CompressMemory(NAME_Oodle, Compressed.GetData(), CompressedSize, Payload.GetData(), Header.UncompressedSize))
+		{
+			return false;
+		}
+		Header.CompressedSize = CompressedSize;
+
+		OutEntry.Reset();
+		FMemoryWriter Writer(OutEntry);
+		Writer << Header;
+		Writer.Serialize(Compressed.GetData(), CompressedSize);
+		return true;
+	}
+
+	/** Rebuild the vertices of an entry; indices are left to the caller */
+	static bool DecodeEntry(TConstArrayView<uint8> Entry, const FGPUTessellationSettings& Settings, FGPUTessellatedMeshData& OutMeshData)
+	{
+		FMemoryReaderView Reader(Entry);
+		FEntryHeader Header;
+		Reader << Header;
+
+		const FIntPoint Resolution = FGPUTessellationMeshBuilder::CalculateResolution(Settings.TessellationFactor);
+		const int32 VertexCount = Resolution.X * Resolution.Y;
+		if (Reader.IsError() || Header.Magic != Magic || Header.Version != FormatVersion
+			|| Header.ResolutionX != Resolution.X || Header.ResolutionY != Resolution.Y
+			|| Header.UncompressedSize != VertexCount * ValuesPerVertex * (int32)sizeof(uint16)
+			|| Header.CompressedSize <= 0 || Header.CompressedSize > Entry.Num() - Reader.Tell())
+		{
+			return false;
+		}
+
+		TArray<uint16> Payload;
+		Payload.SetNumUninitialized(VertexCount * ValuesPerVertex);
+		if (!FCompression::UncompressMemory(NAME_Oodle, Payload.GetData(), Header.UncompressedSize, Entry.GetData() + Reader.Tell(), Header.CompressedSize))
+		{
+			return false;
+		}
+
+		const TArrayView<uint16> Heights(Payload.GetData(), VertexCount);
+		const TArrayView<uint16> NormalsX(Payload.GetData() + VertexCount, VertexCount);
+		const TArrayView<uint16> NormalsY(Payload.GetData() + VertexCount * 2, VertexCount);
+		DeltaDecode(Heights);
+		DeltaDecode(NormalsX);
+		DeltaDecode(NormalsY);
+
+		OutMeshData.Reset();
+		FGPUTessellationCPUBackend::GenerateVertices(Settings, Resolution, OutMeshData);
+		for (int32 VertexIndex = 0; VertexIndex < VertexCount; ++VertexIndex)
+		{
+			OutMeshData.Vertices[VertexIndex].Z += Header.HeightMin + Heights[VertexIndex] * Header.HeightStep;
+			OutMeshData.Normals[VertexIndex] = DecodeOctahedral(NormalsX[VertexIndex], NormalsY[VertexIndex]);
+		}
+		return true;
+	}
+
+	/** Map or read the entry of a key and rebuild its vertices, counted as a hit or miss */
+	static bool ReadEntry(const FGPUTessellationDiskCacheKey& Key, const FGPUTessellationSettings& Settings, FGPUTessellatedMeshData& OutMeshData)
+	{
+		GPUTESSELLATION_SCOPE_CYCLE_COUNTER(STAT_GPUTessellation_DiskCacheLoad, DiskCacheLoad);
+
+		const FString Path = GetEntryPath(Key.Hash);
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+		bool bLoaded = false;
+		if (PlatformFile.FileExists(*Path))
+		{
+			// Mapped entries decompress straight from the page cache; platforms without mapping read the file
+			TUniquePtr<IMappedFileHandle> MappedFile(PlatformFile.OpenMapped(*Path));
+			TUniquePtr<IMappedFileRegion> MappedRegion(MappedFile ? MappedFile->MapRegion() : nullptr);
+			if (MappedRegion && MappedRegion->GetMappedSize() < MAX_int32)
+			{
+				bLoaded = DecodeEntry(TConstArrayView<uint8>(MappedRegion->GetMappedPtr(), (int32)MappedRegion->GetMappedSize()), Settings, OutMeshData);
+			}
+			else
+			{
+				TArray<uint8> Entry;
+				bLoaded = FFileHelper::LoadFileToArray(Entry, *Path, FILEREAD_Silent) && DecodeEntry(Entry, Settings, OutMeshData);
+			}
+
+			if (!bLoaded)
+			{
+				// Written by another format version, or damaged; deleted so the next store replaces it
+				UE_LOG(LogGPUTessellation, Verbose, TEXT("GPUTessellation: Ignoring unreadable disk cache entry %s"), *Path);
+				OutMeshData.Reset();
+				MappedRegion.Reset();
+				MappedFile.Reset();
+				if (IsWriteEnabled())
+				{
+					IFileManager::Get().Delete(*Path, false, false, true);
+				}
+			}
+		}
+
+		if (bLoaded)
+		{
+			GPUTESSELLATION_INC_COUNTER(STAT_GPUTessellation_DiskCacheHits, DiskCacheHits, 1);
+		}
+		else
+		{
+			GPUTESSELLATION_INC_COUNTER(STAT_GPUTessellation_DiskCacheMisses, DiskCacheMisses, 1);
+		}
+		return bLoaded;
+	}
+
+	/** Encode and write an entry next to its final path, then move it into place so readers never see a partial file */
+	static void WriteEntry(const FGPUTessellationDiskCacheKey& Key, const FGPUTessellationSettings& Settings, const FGPUTessellatedMeshData& MeshData)
+	{
+		const FString Path = GetEntryPath(Key.Hash);
+		if (IFileManager::Get().FileExists(*Path))
+		{
+			// Stored by an earlier run while this mesh was generated, or by a proxy that did not wait for its load
+			return;
+		}
+
+		TArray<uint8> Entry;
+		if (!EncodeEntry(Settings, MeshData, Entry))
+		{
+			UE_LOG(LogGPUTessellation, Verbose, TEXT("GPUTessellation: Not storing %s, the mesh is not a displaced grid of its settings"), *Path);
+			return;
+		}
+
+		const FString TempPath = Path + TEXT(".tmp");
+		if (FFileHelper::SaveArrayToFile(Entry, *TempPath) && IFileManager::Get().Move(*Path, *TempPath, true, true, false, true))
+		{
+			GPUTESSELLATION_INC_COUNTER(STAT_GPUTessellation_DiskCacheStores, DiskCacheStores, 1);
+			UE_LOG(LogGPUTessellation, Verbose, TEXT("GPUTessellation: Stored %s (%d vertices, %.1f KB)"), *Path, MeshData.Vertices.Num(), Entry.Num() / 1024.0f);
+		}
+		else
+		{
+			IFileManager::Get().Delete(*TempPath, false, false, true);
+			UE_LOG(LogGPUTessellation, Warning, TEXT("GPUTessellation: Could not write disk cache entry %s"), *Path);
+		}
+	}
+}
+
+bool FGPUTessellationDiskCache::MakeKey(const FGPUTessellationSettings& EffectiveSettings, UTexture* DisplacementTexture, UTexture* SubtractTexture,
+	UTexture* NormalMapTexture, FGPUTessellationDiskCacheKey& OutKey)
+{
+	using namespace GPUTessellationDiskCache;
+
+	if (CVarGPUTessellationDiskCache.GetValueOnAnyThread() == 0)
+	{
+		return false;
+	}
+
+	// The settings the single mesh pipeline reads (see FGPUTessellationMeshKey)
+	FSHA1 Sha;
+	UpdateHash(Sha, FormatVersion);
+	UpdateHash(Sha, EffectiveSettings.TessellationFactor);
+	UpdateHash(Sha, EffectiveSettings.PlaneSizeX);
+	UpdateHash(Sha, EffectiveSettings.PlaneSizeY);
+	UpdateHash(Sha, EffectiveSettings.DisplacementIntensity);
+	UpdateHash(Sha, EffectiveSettings.DisplacementOffset);
+	UpdateHash(Sha, EffectiveSettings.bUseSineWaveDisplacement);
+	UpdateHash(Sha, EffectiveSettings.NormalCalculationMethod);
+	UpdateHash(Sha, EffectiveSettings.bInvertNormals);
+	UpdateHash(Sha, EffectiveSettings.NormalSmoothingFactor);
+	UpdateHash(Sha, EffectiveSettings.UVOffset);
+	UpdateHash(Sha, EffectiveSettings.UVScale);
+
+#if !WITH_EDITORONLY_DATA
+	// Cooked textures keep their lighting GUID when their contents change; a new build starts over
+	const FString BuildVersion(FApp::GetBuildVersion());
+	Sha.UpdateWithString(*BuildVersion, BuildVersion.Len());
+#endif
+
+	for (UTexture* Texture : { DisplacementTexture, SubtractTexture, NormalMapTexture })
+	{
+		if (!UpdateTextureHash(Sha, Texture))
+		{
+			return false;
+		}
+	}
+
+	Sha.Final();
+	Sha.GetHash(OutKey.Hash.Hash);
+	OutKey.bTexturesResident = IsTextureResident(DisplacementTexture) && IsTextureResident(SubtractTexture) && IsTextureResident(NormalMapTexture);
+	return true;
+}
+
+bool FGPUTessellationDiskCache::LoadMesh(const FGPUTessellationDiskCacheKey& Key, const FGPUTessellationSettings& EffectiveSettings, FGPUTessellatedMeshData& OutMeshData)
+{
+	if (!GPUTessellationDiskCache::ReadEntry(Key, EffectiveSettings, OutMeshData))
+	{
+		return false;
+	}
+
+	FGPUTessellationCPUBackend::GenerateIndices(FIntPoint(OutMeshData.ResolutionX, OutMeshData.ResolutionY), FIntVector4(1, 1, 1, 1), OutMeshData.Indices);
+	return true;
+}
+
+bool FGPUTessellationDiskCacheLoad::IsOverdue() const
+{
+	check(IsInRenderingThread());
+	return GFrameCounterRenderThread - StartFrame > (uint64)FMath::Max(CVarGPUTessellationDiskCacheMaxLoadWaitFrames.GetValueOnRenderThread(), 0);
+}
+
+TSharedRef<FGPUTessellationDiskCacheLoad, ESPMode::ThreadSafe> FGPUTessellationDiskCache::BeginLoad(const FGPUTessellationDiskCacheKey& Key,
+	const FGPUTessellationSettings& EffectiveSettings)
+{
+	check(IsInRenderingThread());
+
+	TSharedRef<FGPUTessellationDiskCacheLoad, ESPMode::ThreadSafe> Load = MakeShared<FGPUTessellationDiskCacheLoad, ESPMode::ThreadSafe>();
+	Load->Key = Key;
+	Load->StartFrame = GFrameCounterRenderThread;
+
+	// The load holds itself, so a proxy released meanwhile leaves the worker nothing dangling
+	Async(EAsyncExecution::ThreadPool, [Load, EffectiveSettings]()
+	{
+		Load->bHit = GPUTessellationDiskCache::ReadEntry(Load->Key, EffectiveSettings, Load->MeshData);
+		Load->bComplete.store(true, std::memory_order_release);
+	});
+	return Load;
+}
+
+void FGPUTessellationDiskCache::UploadMesh(FRDGBuilder& GraphBuilder, FGPUTessellationMeshBuilder& MeshBuilder, const FGPUTessellationDiskCacheLoad& Load,
+	FGPUTessellationBuffers& OutGPUBuffers)
+{
+	check(IsInRenderingThread() && Load.IsHit());
+	MeshBuilder.UploadMeshData(GraphBuilder, Load.GetMeshData(), OutGPUBuffers);
+}
+
+void FGPUTessellationDiskCache::StoreMesh(const FGPUTessellationDiskCacheKey& Key, const FGPUTessellationSettings& EffectiveSettings, const FGPUTessellatedMeshData& MeshData)
+{
+	using namespace GPUTessellationDiskCache;
+
+	if (!Key.bTexturesResident || !IsWriteEnabled() || !MeshData.IsValid() || !BeginStore(Key.Hash))
+	{
+		return;
+	}
+
+	Async(EAsyncExecution::ThreadPool, [Key, EffectiveSettings, MeshData]()
+	{
+		WriteEntry(Key, EffectiveSettings, MeshData);
+		EndStore(Key.Hash);
+	});
+}
+
+void FGPUTessellationDiskCache::StoreMesh(FRDGBuilder& GraphBuilder, FGPUTessellationMeshBuilder& MeshBuilder, const FGPUTessellationDiskCacheKey& Key,
+	const FGPUTessellationSettings& EffectiveSettings, const FGPUTessellationBuffers& GPUBuffers)
+{
+	using namespace GPUTessellationDiskCache;
+	check(IsInRenderingThread());
+
+	if (!Key.bTexturesResident || !IsWriteEnabled() || !BeginStore(Key.Hash))
+	{
+		return;
+	}
+
+	TUniquePtr<FPendingStore> PendingStore = MakeUnique<FPendingStore>();
+	PendingStore->Key = Key;
+	PendingStore->Settings = EffectiveSettings;
+	MeshBuilder.EnqueueMeshReadback(GraphBuilder, GPUBuffers, PendingStore->Readback);
+	GPendingStores.Stores.Add(MoveTemp(PendingStore));
+}
+
+void FGPUTessellationDiskCache::PollStores_RenderThread()
+{
+	using namespace GPUTessellationDiskCache;
+	check(IsInRenderingThread());
+
+	// Backwards, so a finished store can be swapped out without skipping one
+	TArray<TUniquePtr<FPendingStore>>& Stores = GPendingStores.Stores;
+	for (int32 Index = Stores.Num() - 1; Index >= 0; --Index)
+	{
+		FPendingStore& PendingStore = *Stores[Index];
+		if (!PendingStore.Readback.IsReady())
+		{
+			continue;
+		}
+
+		FGPUTessellatedMeshData MeshData;
+		PendingStore.Readback.Read(MeshData);
+		Async(EAsyncExecution::ThreadPool, [Key = PendingStore.Key, Settings = PendingStore.Settings, MeshData = MoveTemp(MeshData)]()
+		{
+			WriteEntry(Key, Settings, MeshData);
+			EndStore(Key.Hash);
+		});
+
+		Stores.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	}
+}
+
+FString FGPUTessellationDiskCache::GetCacheDirectory()
+{
+	return FPaths::ProjectSavedDir() / TEXT("GPUTessellation") / TEXT("MeshCache");
+}
+
+/**
+ * Delete every entry; meshes are generated and stored again on their next load
+ */
+static void ClearDiskCacheCommand()
+{
+	const FString Directory = FGPUTessellationDiskCache::GetCacheDirectory();
+	IFileManager::Get().DeleteDirectory(*Directory, false, true);
+	UE_LOG(LogGPUTessellation, Log, TEXT("GPUTessellation.ClearDiskCache: Deleted %s"), *Directory);
+}
+
+static FAutoConsoleCommand GClearDiskCacheCommand(
+	TEXT("GPUTessellation.ClearDiskCache"),
+	TEXT("Delete every generated mesh stored by r.GPUTessellation.DiskCache"),
+	FConsoleCommandDelegate::CreateStatic(&ClearDiskCacheCommand));
@@ -0,0 +1,79 @@
+// Licensed under the MIT License. See LICENSE file in the project root.
+
+#include "GPUTessellationExtractMeshAction.h"
+#include "GPUTessellationComponent.h"
+#include "GPUTessellationMeshBuilder.h"
+
+void FGPUTessellationExtractedMesh::SetFromMeshData(const FGPUTessellatedMeshData& MeshData)
+{
+	Vertices.Reset(MeshData.Vertices.Num());
+	for (const FVector3f& Vertex : MeshData.Vertices)
+	{
+		Vertices.Add(FVector(Vertex));
+	}
+
+	Normals.Reset(MeshData.Normals.Num());
+	for (const FVector3f& Normal : MeshData.Normals)
+	{
+		Normals.Add(FVector(Normal));
+	}
+
+	UVs.Reset(MeshData.UVs.Num());
+	for (const FVector2f& UV : MeshData.UVs)
+	{
+		UVs.Add(FVector2D(UV));
+	}
+
+	Triangles.Reset(MeshData.Indices.Num());
+	for (uint32 Index : MeshData.Indices)
+	{
+		Triangles.Add(static_cast<int32>(Index));
+	}
+
+	Resolution = FIntPoint(MeshData.ResolutionX, MeshData.ResolutionY);
+}
+
+UGPUTessellationExtractMeshAction* UGPUTessellationExtractMeshAction::ExtractTessellatedMeshAsync(UObject* WorldContextObject, UGPUTessellationComponent* InComponent)
+{
+	UGPUTessellationExtractMeshAction* Action = NewObject<UGPUTessellationExtractMeshAction>();
+	Action->Component = InComponent;
+	Action->RegisterWithGameInstance(WorldContextObject);
+	return Action;
+}
+
+void UGPUTessellationExtractMeshAction::Activate()
+{
+	UGPUTessellationComponent* TessComponent = Component.Get();
+	if (!TessComponent)
+	{
+		Finish(nullptr);
+		return;
+	}
+
+	// Continuation runs on the game thread; the weak pointer guards against the action being collected meanwhile
+	TessComponent->ExtractMeshAsync().Then(
+		[WeakThis = TWeakObjectPtr<UGPUTessellationExtractMeshAction>(this)](TFuture<FGPUTessellatedMeshData> Future)
+		{
+			if (UGPUTessellationExtractMeshAction* Action = WeakThis.Get())
+			{
+				const FGPUTessellatedMeshData MeshData = Future.Get();
+				Action->Finish(Action->Component.IsValid() && MeshData.IsValid() ? &MeshData : nullptr);
+			}
+		});
+}
+
+void UGPUTessellationExtractMeshAction::Finish(const FGPUTessellatedMeshData* MeshData)
+{
+	FGPUTessellationExtractedMesh Mesh;
+	if (MeshData)
+	{
+		Mesh.SetFromMeshData(*MeshData);
+		Completed.Broadcast(Mesh);
+	}
+	else
+	{
+		Failed.Broadcast(Mesh);
+	}
+
+	SetReadyToDestroy();
+}
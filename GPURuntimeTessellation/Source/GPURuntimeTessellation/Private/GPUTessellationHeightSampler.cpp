@@ -0,0 +1,357 @@
+// Licensed under the MIT License. See LICENSE file in the project root.
+
+#include "GPUTessellationHeightSampler.h"
+#include "GPUTessellationCPUReference.h"
+#include "GPUTessellationLog.h"
+#include "Engine/Texture2D.h"
+#include "Engine/TextureRenderTarget.h"
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+#include "Math/VectorRegister.h"
+#include "TextureResource.h"
+
+#if WITH_EDITORONLY_DATA
+#include "ImageCore.h"
+#endif
+
+float FGPUTessellationHeightTexture::Sample(const FVector2f& UV) const
+{
+	// Texel space with centers at integers; clamping to one texel outside keeps the int conversion safe
+	const float X = FMath::Clamp(UV.X * Size.X - 0.5f, -1.0f, (float)Size.X);
+	const float Y = FMath::Clamp(UV.Y * Size.Y - 0.5f, -1.0f, (float)Size.Y);
+	const float X0 = FMath::FloorToFloat(X);
+	const float Y0 = FMath::FloorToFloat(Y);
+	const float FracX = X - X0;
+	const float FracY = Y - Y0;
+
+	const int32 TX0 = FMath::Clamp((int32)X0, 0, Size.X - 1);
+	const int32 TX1 = FMath::Clamp((int32)X0 + 1, 0, Size.X - 1);
+	const float* Row0 = Texels.GetData() + FMath::Clamp((int32)Y0, 0, Size.Y - 1) * Size.X;
+	const float* Row1 = Texels.GetData() + FMath::Clamp((int32)Y0 + 1, 0, Size.Y - 1) * Size.X;
+
+	// Same operation order as SampleBilinear4
+	const float Top = (Row0[TX1] - Row0[TX0]) * FracX + Row0[TX0];
+	const float Bottom = (Row1[TX1] - Row1[TX0]) * FracX + Row1[TX0];
+	return (Bottom - Top) * FracY + Top;
+}
+
+/** Decode one channel of an uncompressed platform mip; channels a single channel format lacks read as 0 */
+static bool DecodePlatformTexels(EPixelFormat Format, bool bSRGB, const uint8* Data, int32 NumTexels, int32 Channel, float* OutTexels)
+{
+	auto DecodeUNorm8 = [bSRGB](uint8 Value)
+	{
+		return bSRGB ? FLinearColor::FromSRGBColor(FColor(Value, 0, 0)).R : Value / 255.0f;
+	};
+
+	switch (Format)
+	{
+		case PF_G8:
+			for (int32 Index = 0; Index < NumTexels; ++Index)
+			{
+				OutTexels[Index] = Channel == 0 ? DecodeUNorm8(Data[Index]) : 0.0f;
+			}
+			return true;
+
+		case PF_B8G8R8A8:
+		{
+			// Memory order is B, G, R, A; alpha is never sRGB encoded
+			const int32 ByteOffset = Channel == 3 ? 3 : 2 - Channel;
+			for (int32 Index = 0; Index < NumTexels; ++Index)
+			{
+				const uint8 Value = Data[Index * 4 + ByteOffset];
+				OutTexels[Index] = Channel == 3 ? Value / 255.0f : DecodeUNorm8(Value);
+			}
+			return true;
+		}
+
+		case PF_G16:
+			for (int32 Index = 0; Index < NumTexels; ++Index)
+			{
+				OutTexels[Index] = Channel == 0 ? reinterpret_cast<const uint16*>(Data)[Index] / 65535.0f : 0.0f;
+			}
+			return true;
+
+		case PF_R16F:
+			for (int32 Index = 0; Index < NumTexels; ++Index)
+			{
+				OutTexels[Index] = Channel == 0 ? reinterpret_cast<const FFloat16*>(Data)[Index].GetFloat() : 0.0f;
+			}
+			return true;
+
+		case PF_R32_FLOAT:
+			for (int32 Index = 0; Index < NumTexels; ++Index)
+			{
+				OutTexels[Index] = Channel == 0 ? reinterpret_cast<const float*>(Data)[Index] : 0.0f;
+			}
+			return true;
+
+		case PF_FloatRGBA:
+			for (int32 Index = 0; Index < NumTexels; ++Index)
+			{
+				const FFloat16Color& Color = reinterpret_cast<const FFloat16Color*>(Data)[Index];
+				const FFloat16 Components[] = { Color.R, Color.G, Color.B, Color.A };
+				OutTexels[Index] = Components[Channel].GetFloat();
+			}
+			return true;
+
+		default:
+			return false;
+	}
+}
+
+bool FGPUTessellationHeightTexture::ReadTexture(UTexture* Texture, FGPUTessellationHeightTexture& OutTexture, int32 Channel)
+{
+	OutTexture = FGPUTessellationHeightTexture();
+	if (!Texture || Texture->IsA<UTextureRenderTarget>() || Channel < 0 || Channel > 3)
+	{
+		return false;
+	}
+
+#if WITH_EDITORONLY_DATA
+	// Source data: exact texel values, independent of the platform compression
+	if (Texture->Source.IsValid())
+	{
+		FImage SourceImage;
+		if (Texture->Source.GetMipImage(SourceImage, 0, 0, 0))
+		{
+			// The GPU decodes sRGB before filtering
+			if (ERawImageFormat::GetFormatNeedsGammaSpace(SourceImage.Format))
+			{
+				SourceImage.GammaSpace = Texture->SRGB ? EGammaSpace::sRGB : EGammaSpace::Linear;
+			}
+
+			FImage LinearImage;
+			SourceImage.CopyTo(LinearImage, ERawImageFormat::RGBA32F, EGammaSpace::Linear);
+
+			const TArrayView64<FLinearColor> Colors = LinearImage.AsRGBA32F();
+			OutTexture.Size = FIntPoint(LinearImage.SizeX, LinearImage.SizeY);
+			OutTexture.Texels.SetNumUninitialized(Colors.Num());
+			for (int32 Index = 0; Index < OutTexture.Texels.Num(); ++Index)
+			{
+				OutTexture.Texels[Index] = Colors[Index].Component(Channel);
+			}
+			return OutTexture.IsValid();
+		}
+	}
+#endif
+
+	// Cooked data: the top mip has to be uncompressed and still resident
+	UTexture2D* Texture2D = Cast<UTexture2D>(Texture);
+	const FTexturePlatformData* PlatformData = Texture2D ? Texture2D->GetPlatformData() : nullptr;
+	if (!PlatformData || PlatformData->Mips.Num() == 0)
+	{
+		return false;
+	}
+
+	const FTexture2DMipMap& Mip = PlatformData->Mips[0];
+	if (!Mip.BulkData.IsBulkDataLoaded() || Mip.BulkData.GetBulkDataSize() == 0)
+	{
+		return false;
+	}
+
+	OutTexture.Size = FIntPoint(Mip.SizeX, Mip.SizeY);
+	OutTexture.Texels.SetNumUninitialized(Mip.SizeX * Mip.SizeY);
+
+	const uint8* Data = static_cast<const uint8*>(Mip.BulkData.LockReadOnly());
+	const bool bDecoded = Data && DecodePlatformTexels(PlatformData->PixelFormat, Texture->SRGB, Data, OutTexture.Texels.Num(), Channel, OutTexture.Texels.GetData());
+	Mip.BulkData.Unlock();
+
+	if (!bDecoded)
+	{
+		OutTexture = FGPUTessellationHeightTexture();
+	}
+	return bDecoded;
+}
+
+bool FGPUTessellationHeightSampler::Build(UTexture* InDisplacementTexture, UTexture* InSubtractTexture)
+{
+	check(IsInGameThread());
+
+	SourceDisplacementTexture = InDisplacementTexture;
+	SourceSubtractTexture = InSubtractTexture;
+	Displacement = FGPUTessellationHeightTexture();
+	Subtract = FGPUTessellationHeightTexture();
+
+	bValid = (!InDisplacementTexture || FGPUTessellationHeightTexture::ReadTexture(InDisplacementTexture, Displacement)) &&
+	         (!InSubtractTexture || FGPUTessellationHeightTexture::ReadTexture(InSubtractTexture, Subtract));
+	return bValid;
+}
+
+void FGPUTessellationHeightSampler::SetTextures(FGPUTessellationHeightTexture&& InDisplacement, FGPUTessellationHeightTexture&& InSubtract)
+{
+	Displacement = MoveTemp(InDisplacement);
+	Subtract = MoveTemp(InSubtract);
+	SourceDisplacementTexture.Reset();
+	SourceSubtractTexture.Reset();
+	bValid = true;
+}
+
+float FGPUTessellationHeightSampler::SampleSource(const FGPUTessellationSettings& Settings, const FVector2f& UV) const
+{
+	// SampleDisplacement in GPUDisplacement.usf - the sine wave ignores the mask
+	if (Settings.bUseSineWaveDisplacement)
+	{
+		return FGPUTessellationCPUReference::SineWaveHeight(UV);
+	}
+
+	// Missing displacement binds the default white texture
+	float Height = Displacement.IsValid() ? Displacement.Sample(UV) : 1.0f;
+	if (Subtract.IsValid())
+	{
+		Height *= 1.0f - Subtract.Sample(UV);
+	}
+	return Height;
+}
+
+float FGPUTessellationHeightSampler::SampleHeight(const FGPUTessellationSettings& Settings, const FVector2f& UV) const
+{
+	return SampleSource(Settings, UV) * Settings.DisplacementIntensity + Settings.DisplacementOffset;
+}
+
+/** FGPUTessellationHeightTexture::Sample for four UVs */
+static VectorRegister4Float SampleBilinear4(const FGPUTessellationHeightTexture& Texture, const VectorRegister4Float& U, const VectorRegister4Float& V)
+{
+	const VectorRegister4Float Half = VectorSetFloat1(0.5f);
+	const VectorRegister4Float X = VectorMin(VectorMax(VectorSubtract(VectorMultiply(U, VectorSetFloat1((float)Texture.Size.X)), Half), VectorSetFloat1(-1.0f)), VectorSetFloat1((float)Texture.Size.X));
+	const VectorRegister4Float Y = VectorMin(VectorMax(VectorSubtract(VectorMultiply(V, VectorSetFloat1((float)Texture.Size.Y)), Half), VectorSetFloat1(-1.0f)), VectorSetFloat1((float)Texture.Size.Y));
+	const VectorRegister4Float X0 = VectorFloor(X);
+	const VectorRegister4Float Y0 = VectorFloor(Y);
+	const VectorRegister4Float FracX = VectorSubtract(X, X0);
+	const VectorRegister4Float FracY = VectorSubtract(Y, Y0);
+
+	alignas(16) float X0Lanes[4];
+	alignas(16) float Y0Lanes[4];
+	VectorStoreAligned(X0, X0Lanes);
+	VectorStoreAligned(Y0, Y0Lanes);
+
+	// No gather instruction in the baseline SIMD set - fetch the four corners per lane
+	alignas(16) float H00[4];
+	alignas(16) float H10[4];
+	alignas(16) float H01[4];
+	alignas(16) float H11[4];
+	const float* Texels = Texture.Texels.GetData();
+	for (int32 Lane = 0; Lane < 4; ++Lane)
+	{
+		const int32 TX0 = FMath::Clamp((int32)X0Lanes[Lane], 0, Texture.Size.X - 1);
+		const int32 TX1 = FMath::Clamp((int32)X0Lanes[Lane] + 1, 0, Texture.Size.X - 1);
+		const float* Row0 = Texels + FMath::Clamp((int32)Y0Lanes[Lane], 0, Texture.Size.Y - 1) * Texture.Size.X;
+		const float* Row1 = Texels + FMath::Clamp((int32)Y0Lanes[Lane] + 1, 0, Texture.Size.Y - 1) * Texture.Size.X;
+		H00[Lane] = Row0[TX0];
+		H10[Lane] = Row0[TX1];
+		H01[Lane] = Row1[TX0];
+		H11[Lane] = Row1[TX1];
+	}
+
+	const VectorRegister4Float Top = VectorMultiplyAdd(VectorSubtract(VectorLoadAligned(H10), VectorLoadAligned(H00)), FracX, VectorLoadAligned(H00));
+	const VectorRegister4Float Bottom = VectorMultiplyAdd(VectorSubtract(VectorLoadAligned(H11), VectorLoadAligned(H01)), FracX, VectorLoadAligned(H01));
+	return VectorMultiplyAdd(VectorSubtract(Bottom, Top), FracY, Top);
+}
+
+void FGPUTessellationHeightSampler::SampleHeightBatch(const FGPUTessellationSettings& Settings, TConstArrayView<FVector2f> UVs, TArrayView<float> OutHeights) const
+{
+	check(UVs.Num() == OutHeights.Num());
+
+	const VectorRegister4Float Intensity = VectorSetFloat1(Settings.DisplacementIntensity);
+	const VectorRegister4Float Offset = VectorSetFloat1(Settings.DisplacementOffset);
+	const VectorRegister4Float One = VectorOne();
+	const VectorRegister4Float Half = VectorSetFloat1(0.5f);
+	const VectorRegister4Float Ten = VectorSetFloat1(10.0f);
+
+	const int32 NumVectorized = UVs.Num() & ~3;
+	for (int32 Index = 0; Index < NumVectorized; Index += 4)
+	{
+		alignas(16) float ULanes[4];
+		alignas(16) float VLanes[4];
+		for (int32 Lane = 0; Lane < 4; ++Lane)
+		{
+			ULanes[Lane] = UVs[Index + Lane].X;
+			VLanes[Lane] = UVs[Index + Lane].Y;
+		}
+		const VectorRegister4Float U = VectorLoadAligned(ULanes);
+		const VectorRegister4Float V = VectorLoadAligned(VLanes);
+
+		VectorRegister4Float Height;
+		if (Settings.bUseSineWaveDisplacement)
+		{
+			Height = VectorMultiplyAdd(VectorMultiply(VectorSin(VectorMultiply(U, Ten)), VectorSin(VectorMultiply(V, Ten))), Half, Half);
+		}
+		else
+		{
+			Height = Displacement.IsValid() ? SampleBilinear4(Displacement, U, V) : One;
+			if (Subtract.IsValid())
+			{
+				Height = VectorMultiply(Height, VectorSubtract(One, SampleBilinear4(Subtract, U, V)));
+			}
+		}
+
+		VectorStore(VectorMultiplyAdd(Height, Intensity, Offset), &OutHeights[Index]);
+	}
+
+	for (int32 Index = NumVectorized; Index < UVs.Num(); ++Index)
+	{
+		OutHeights[Index] = SampleHeight(Settings, UVs[Index]);
+	}
+}
+
+/**
+ * Per-point cost of scalar and batched height queries on a synthetic 1024x1024 displacement and mask
+ */
+static void BenchmarkHeightSamplerCommand(const TArray<FString>& Args)
+{
+	const int32 NumPoints = Args.Num() > 0 ? FMath::Max(4, FCString::Atoi(*Args[0])) : 65536;
+	const int32 TextureSize = 1024;
+
+	FRandomStream RandomStream(0x4E16);
+	auto MakeTexture = [&]()
+	{
+		FGPUTessellationHeightTexture Texture;
+		Texture.Size = FIntPoint(TextureSize, TextureSize);
+		Texture.Texels.SetNumUninitialized(TextureSize * TextureSize);
+		for (float& Texel : Texture.Texels)
+		{
+			Texel = RandomStream.GetFraction();
+		}
+		return Texture;
+	};
+
+	FGPUTessellationHeightSampler Sampler;
+	Sampler.SetTextures(MakeTexture(), MakeTexture());
+
+	TArray<FVector2f> UVs;
+	UVs.SetNumUninitialized(NumPoints);
+	for (FVector2f& UV : UVs)
+	{
+		UV = FVector2f(RandomStream.GetFraction(), RandomStream.GetFraction());
+	}
+
+	FGPUTessellationSettings Settings;
+	TArray<float> ScalarHeights;
+	TArray<float> BatchHeights;
+	ScalarHeights.SetNumUninitialized(NumPoints);
+	BatchHeights.SetNumUninitialized(NumPoints);
+
+	const uint64 ScalarStart = FPlatformTime::Cycles64();
+	for (int32 Index = 0; Index < NumPoints; ++Index)
+	{
+		ScalarHeights[Index] = Sampler.SampleHeight(Settings, UVs[Index]);
+	}
+	const uint64 BatchStart = FPlatformTime::Cycles64();
+	Sampler.SampleHeightBatch(Settings, UVs, BatchHeights);
+	const uint64 BatchEnd = FPlatformTime::Cycles64();
+
+	float MaxDifference = 0.0f;
+	for (int32 Index = 0; Index < NumPoints; ++Index)
+	{
+		MaxDifference = FMath::Max(MaxDifference, FMath::Abs(ScalarHeights[Index] - BatchHeights[Index]));
+	}
+
+	const double ScalarNs = FPlatformTime::ToMilliseconds64(BatchStart - ScalarStart) * 1.0e6 / NumPoints;
+	const double BatchNs = FPlatformTime::ToMilliseconds64(BatchEnd - BatchStart) * 1.0e6 / NumPoints;
+	UE_LOG(LogGPUTessellation, Log, TEXT("GPUTessellation.BenchmarkHeightSampler: %d points, scalar %.1f ns/point, batch %.1f ns/point (%.2fx), max difference %g"),
+		NumPoints, ScalarNs, BatchNs, BatchNs > 0.0 ? ScalarNs / BatchNs : 0.0, MaxDifference);
+}
+
+static FAutoConsoleCommand GBenchmarkHeightSamplerCommand(
+	TEXT("GPUTessellation.BenchmarkHeightSampler"),
+	TEXT("Measure per-point cost of CPU height queries. Usage: GPUTessellation.BenchmarkHeightSampler [NumPoints]"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkHeightSamplerCommand));
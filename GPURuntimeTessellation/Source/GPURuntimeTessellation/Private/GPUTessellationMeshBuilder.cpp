@@ -1,8 +1,11 @@
 // Licensed under the MIT License. See LICENSE file in the project root.
 
 #include "GPUTessellationMeshBuilder.h"
+#include "GPUTessellationCPUBackend.h"
+#include "GPUTessellationDiskCache.h"
 #include "GPUTessellationComputeShaders.h"
 #include "GPUTessellationComponent.h"
+#include "GPUTessellationLog.h"
 #include "RenderGraphBuilder.h"
 #include "RenderGraphUtils.h"
 #include "GlobalShader.h"
@@ -14,6 +17,24 @@
 #include "RHICommandList.h"
 #include "RHIGPUReadback.h"
 #include "SystemTextures.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarGPUTessellationBatchedPatches(
+	TEXT("r.GPUTessellation.BatchedPatches"),
+	1,
+	TEXT("Generate spatial patches with one dispatch per pipeline stage.\n")
+	TEXT(" 0: separate passes and buffers for every patch\n")
+	TEXT(" 1: all visible patches share one set of passes and buffers (default)"),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<int32> CVarGPUTessellationIndirectPatches(
+	TEXT("r.GPUTessellation.IndirectPatches"),
+	0,
+	TEXT("Cull batched patches on the GPU and draw them with indirect arguments, one draw per LOD level.\n")
+	TEXT("Requires r.GPUTessellation.BatchedPatches.\n")
+	TEXT(" 0: one draw per visible patch (default)\n")
+	TEXT(" 1: GPU-built indexed indirect draws"),
+	ECVF_RenderThreadSafe);
 
 FGPUTessellationMeshBuilder::FGPUTessellationMeshBuilder()
 {
@@ -23,7 +44,7 @@ FGPUTessellationMeshBuilder::~FGPUTessellationMeshBuilder()
 {
 }
 
-FIntPoint FGPUTessellationMeshBuilder::CalculateResolution(float TessellationFactor) const
+FIntPoint FGPUTessellationMeshBuilder::CalculateResolution(float TessellationFactor)
 {
 	// Convert tessellation factor to "segment" count so adjacent LODs share divisors.
 	// Each factor step contributes 4 segments (matching historical density), then we add 1 vertex
@@ -45,6 +66,14 @@ FIntPoint FGPUTessellationMeshBuilder::CalculateResolution(float TessellationFac
 	return FIntPoint(Resolution, Resolution);
 }
 
+FVector2f FGPUTessellationMeshBuilder::CalculateGridStep(const FGPUTessellationSettings& Settings, FIntPoint Resolution)
+{
+	// Local-space distance between adjacent vertices; patches cover UVScale of the full plane
+	return FVector2f(
+		Settings.PlaneSizeX * Settings.UVScale.X / FMath::Max(Resolution.X - 1, 1),
+		Settings.PlaneSizeY * Settings.UVScale.Y / FMath::Max(Resolution.Y - 1, 1));
+}
+
 void FGPUTessellationMeshBuilder::ExecuteTessellationPipeline(
 	FRDGBuilder& GraphBuilder,
 	const FGPUTessellationSettings& Settings,
@@ -55,6 +84,8 @@ void FGPUTessellationMeshBuilder::ExecuteTessellationPipeline(
 	UTexture* NormalMapTexture,
 	FGPUTessellatedMeshData& OutMeshData)
 {
+	GPUTESSELLATION_SCOPE_CYCLE_COUNTER(STAT_GPUTessellation_RDGSetup, RDGSetup);
+	
 	// Calculate resolution
 	FIntPoint Resolution = CalculateResolution(Settings.TessellationFactor);
 	int32 VertexCount = Resolution.X * Resolution.Y;
@@ -84,6 +115,9 @@ void FGPUTessellationMeshBuilder::ExecuteTessellationPipeline(
 
 	// Step 5: Extract mesh data to CPU
 	ExtractMeshData(GraphBuilder, Resolution, VertexBuffer, NormalBuffer, UVBuffer, IndexBuffer, OutMeshData);
+	
+	BuildStats.VertexCount += VertexCount;
+	BuildStats.IndexCount += IndexCount;
 }
 
 void FGPUTessellationMeshBuilder::GenerateMeshSync(
@@ -94,17 +128,45 @@ void FGPUTessellationMeshBuilder::GenerateMeshSync(
 	UTexture* RVTMaskTexture,
 	FGPUTessellatedMeshData& OutMeshData)
 {
-	ENQUEUE_RENDER_COMMAND(GenerateTessellatedMesh)(
-		[this, Settings, LocalToWorld, CameraPosition, DisplacementTexture, RVTMaskTexture, &OutMeshData](FRHICommandListImmediate& RHICmdList)
+	// Content generated by an earlier run is read from disk instead
+	FGPUTessellationDiskCacheKey DiskCacheKey;
+	const bool bHasDiskCacheKey = FGPUTessellationDiskCache::MakeKey(Settings, DisplacementTexture, RVTMaskTexture, nullptr, DiskCacheKey);
+	if (bHasDiskCacheKey && FGPUTessellationDiskCache::LoadMesh(DiskCacheKey, Settings, OutMeshData))
+	{
+		return;
+	}
+
+	if (FGPUTessellationCPUBackend::IsActive())
+	{
+		FGPUTessellationCPUTextures Textures;
+		if (Textures.Build(Settings, DisplacementTexture, RVTMaskTexture, nullptr))
 		{
-			FRDGBuilder GraphBuilder(RHICmdList);
-			
-			ExecuteTessellationPipeline(GraphBuilder, Settings, LocalToWorld, CameraPosition, DisplacementTexture, RVTMaskTexture, nullptr, OutMeshData);
-			
-			GraphBuilder.Execute();
-		});
-	
-	FlushRenderingCommands();
+			FGPUTessellationCPUBackend::ExecuteTessellationPipeline(Settings, Textures, OutMeshData);
+		}
+		else
+		{
+			OutMeshData.Reset();
+		}
+	}
+	else
+	{
+		ENQUEUE_RENDER_COMMAND(GenerateTessellatedMesh)(
+			[this, Settings, LocalToWorld, CameraPosition, DisplacementTexture, RVTMaskTexture, &OutMeshData](FRHICommandListImmediate& RHICmdList)
+			{
+				FRDGBuilder GraphBuilder(RHICmdList);
+				
+				ExecuteTessellationPipeline(GraphBuilder, Settings, LocalToWorld, CameraPosition, DisplacementTexture, RVTMaskTexture, nullptr, OutMeshData);
+				
+				GraphBuilder.Execute();
+			});
+		
+		FlushRenderingCommands();
+	}
+
+	if (bHasDiskCacheKey)
+	{
+		FGPUTessellationDiskCache::StoreMesh(DiskCacheKey, Settings, OutMeshData);
+	}
 }
 
 void FGPUTessellationMeshBuilder::DispatchVertexGeneration(
@@ -115,22 +177,37 @@ void FGPUTessellationMeshBuilder::DispatchVertexGeneration(
 	const FVector& PatchLocalOffset,
 	FRDGBufferRef& OutVertexBuffer,
 	FRDGBufferRef& OutNormalBuffer,
-	FRDGBufferRef& OutUVBuffer)
+	FRDGBufferRef& OutUVBuffer,
+	const FGPUTessellationPatchBatch* Batch,
+	const FIntRect* VertexRegion)
 {
-	int32 VertexCount = Resolution.X * Resolution.Y;
+	// Partial refreshes dispatch only VertexRegion of the grid
+	const FIntPoint DispatchOrigin = VertexRegion ? VertexRegion->Min : FIntPoint::ZeroValue;
+	const FIntPoint DispatchSize = VertexRegion ? VertexRegion->Size() : Resolution;
 
-	// Create output buffers
-	OutVertexBuffer = GraphBuilder.CreateBuffer(
-		FRDGBufferDesc::CreateStructuredDesc(sizeof(FVector3f), VertexCount),
-		TEXT("GPUTessellation.VertexBuffer"));
+	int32 VertexCount = Batch ? Batch->TotalVertexCount : Resolution.X * Resolution.Y;
 
-	OutNormalBuffer = GraphBuilder.CreateBuffer(
-		FRDGBufferDesc::CreateStructuredDesc(sizeof(FVector3f), VertexCount),
-		TEXT("GPUTessellation.NormalBuffer"));
+	// Create output buffers (a refresh passes in the registered existing ones)
+	if (!OutVertexBuffer)
+	{
+		OutVertexBuffer = GraphBuilder.CreateBuffer(
+			FRDGBufferDesc::CreateStructuredDesc(sizeof(FVector3f), VertexCount),
+			TEXT("GPUTessellation.VertexBuffer"));
+	}
 
-	OutUVBuffer = GraphBuilder.CreateBuffer(
-		FRDGBufferDesc::CreateStructuredDesc(sizeof(FVector2f), VertexCount),
-		TEXT("GPUTessellation.UVBuffer"));
+	if (!OutNormalBuffer)
+	{
+		OutNormalBuffer = GraphBuilder.CreateBuffer(
+			FRDGBufferDesc::CreateStructuredDesc(sizeof(FVector3f), VertexCount),
+			TEXT("GPUTessellation.NormalBuffer"));
+	}
+
+	if (!OutUVBuffer)
+	{
+		OutUVBuffer = GraphBuilder.CreateBuffer(
+			FRDGBufferDesc::CreateStructuredDesc(sizeof(FVector2f), VertexCount),
+			TEXT("GPUTessellation.UVBuffer"));
+	}
 
 	// Setup shader parameters
 	FGPUVertexGenerationCS::FParameters* PassParameters = GraphBuilder.AllocParameters<FGPUVertexGenerationCS::FParameters>();
@@ -146,44 +223,22 @@ void FGPUTessellationMeshBuilder::DispatchVertexGeneration(
 	// For single-mesh mode, use full UV range [0,1]
 	PassParameters->PatchUVOffset = FVector2f(Settings.UVOffset.X, Settings.UVOffset.Y);
 	PassParameters->PatchUVScale = FVector2f(Settings.UVScale.X, Settings.UVScale.Y);
+	PassParameters->PatchDescriptors = Batch ? Batch->PatchDescriptors : nullptr;
+	PassParameters->VertexRegionOffset = FUintVector2(DispatchOrigin.X, DispatchOrigin.Y);
 	PassParameters->OutputPositions = GraphBuilder.CreateUAV(OutVertexBuffer);
 	PassParameters->OutputNormals = GraphBuilder.CreateUAV(OutNormalBuffer);
 	PassParameters->OutputUVs = GraphBuilder.CreateUAV(OutUVBuffer);
 
-	// Dummy input buffers (not used in simple grid generation, but required by shader parameters)
-	// Create them with ERDGBufferFlags::None so RDG knows they're optional
-	FRDGBufferRef DummyVertexBuffer = GraphBuilder.CreateBuffer(
-		FRDGBufferDesc::CreateStructuredDesc(sizeof(FVector3f), 1),
-		TEXT("GPUTessellation.DummyVertexBuffer"),
-		ERDGBufferFlags::None);
-	
-	FRDGBufferRef DummyIndexBuffer = GraphBuilder.CreateBuffer(
-		FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), 3),
-		TEXT("GPUTessellation.DummyIndexBuffer"),
-		ERDGBufferFlags::None);
-	
-	FRDGBufferRef DummyTessFactorBuffer = GraphBuilder.CreateBuffer(
-		FRDGBufferDesc::CreateStructuredDesc(sizeof(float), 1),
-		TEXT("GPUTessellation.DummyTessFactorBuffer"),
-		ERDGBufferFlags::None);
-
-	// Clear dummy buffers to satisfy RDG validation
-	AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(DummyVertexBuffer), 0);
-	AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(DummyIndexBuffer), 0);
-	AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(DummyTessFactorBuffer), 0);
-
-	PassParameters->InputVertices = GraphBuilder.CreateSRV(DummyVertexBuffer);
-	PassParameters->InputIndices = GraphBuilder.CreateSRV(DummyIndexBuffer);
-	PassParameters->TessellationFactors = GraphBuilder.CreateSRV(DummyTessFactorBuffer);
-
 	// Get shader
-	TShaderMapRef<FGPUVertexGenerationCS> ComputeShader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
+	FGPUVertexGenerationCS::FPermutationDomain PermutationVector;
+	PermutationVector.Set<FGPUVertexGenerationCS::FBatchedPatchesDim>(Batch != nullptr);
+	TShaderMapRef<FGPUVertexGenerationCS> ComputeShader(GetGlobalShaderMap(GMaxRHIFeatureLevel), PermutationVector);
 
-	// Calculate dispatch size
+	// Calculate dispatch size (group z selects the patch when batching)
 	FIntVector GroupCount(
-		FMath::DivideAndRoundUp(Resolution.X, 8),
-		FMath::DivideAndRoundUp(Resolution.Y, 8),
-		1);
+		FMath::DivideAndRoundUp(DispatchSize.X, 8),
+		FMath::DivideAndRoundUp(DispatchSize.Y, 8),
+		Batch ? Batch->PatchCount : 1);
 
 	// Add compute pass
 	GraphBuilder.AddPass(
@@ -194,6 +249,8 @@ void FGPUTessellationMeshBuilder::DispatchVertexGeneration(
 		{
 			FComputeShaderUtils::Dispatch(RHICmdList, ComputeShader, *PassParameters, GroupCount);
 		});
+	
+	BuildStats.VertexGenerationPasses++;
 }
 
 void FGPUTessellationMeshBuilder::DispatchDisplacement(
@@ -204,43 +261,59 @@ void FGPUTessellationMeshBuilder::DispatchDisplacement(
 	UTexture* SubtractTexture,
 	FRDGBufferRef VertexBuffer,
 	FRDGBufferRef NormalBuffer,
-	FRDGBufferRef UVBuffer)
+	FRDGBufferRef UVBuffer,
+	const FGPUTessellationPatchBatch* Batch,
+	const FIntRect* VertexRegion)
 {
-	int32 VertexCount = Resolution.X * Resolution.Y;
+	// Partial refreshes dispatch only VertexRegion of the grid
+	const FIntPoint DispatchOrigin = VertexRegion ? VertexRegion->Min : FIntPoint::ZeroValue;
+	const FIntPoint DispatchSize = VertexRegion ? VertexRegion->Size() : Resolution;
 
-	// Get or create textures
-	FRDGTextureRef DisplacementTextureRDG = DisplacementTexture ? 
-		CreateRDGTextureFromUTexture(GraphBuilder, DisplacementTexture, TEXT("DisplacementTexture")) :
-		GetDefaultWhiteTexture(GraphBuilder);
-
-	FRDGTextureRef SubtractTextureRDG = SubtractTexture ?
-		CreateRDGTextureFromUTexture(GraphBuilder, SubtractTexture, TEXT("SubtractTexture")) :
-		GetDefaultWhiteTexture(GraphBuilder);
+	// Select the permutation up front so only the textures it samples get registered
+	FGPUDisplacementCS::FPermutationDomain PermutationVector;
+	PermutationVector.Set<FGPUDisplacementCS::FSineWaveDim>(Settings.bUseSineWaveDisplacement);
+	PermutationVector.Set<FGPUDisplacementCS::FRVTMaskDim>(SubtractTexture != nullptr);
+	PermutationVector.Set<FGPUDisplacementCS::FBatchedPatchesDim>(Batch != nullptr);
+	PermutationVector = FGPUDisplacementCS::RemapPermutation(PermutationVector);
 
 	// Setup shader parameters
 	FGPUDisplacementCS::FParameters* PassParameters = GraphBuilder.AllocParameters<FGPUDisplacementCS::FParameters>();
 	PassParameters->DisplacementIntensity = Settings.DisplacementIntensity;
 	PassParameters->DisplacementOffset = Settings.DisplacementOffset;
-	PassParameters->bUseSineWaveDisplacement = Settings.bUseSineWaveDisplacement ? 1 : 0;
-	PassParameters->bHasRVTMask = (SubtractTexture != nullptr) ? 1 : 0;
-	PassParameters->VertexCount = VertexCount;
+	PassParameters->ResolutionX = Resolution.X;
+	PassParameters->ResolutionY = Resolution.Y;
 	PassParameters->UVOffset = Settings.UVOffset; // For patch rendering
 	PassParameters->UVScale = Settings.UVScale;   // For patch rendering
-	PassParameters->DisplacementTexture = GraphBuilder.CreateSRV(FRDGTextureSRVDesc::Create(DisplacementTextureRDG));
-	// Use Bilinear sampling with Clamp addressing to avoid edge wrapping artifacts
-	PassParameters->DisplacementSampler = TStaticSamplerState<SF_Bilinear, AM_Clamp, AM_Clamp, AM_Clamp>::GetRHI();
-	PassParameters->RVTMaskTexture = GraphBuilder.CreateSRV(FRDGTextureSRVDesc::Create(SubtractTextureRDG));
-	PassParameters->RVTMaskSampler = TStaticSamplerState<SF_Bilinear, AM_Clamp, AM_Clamp, AM_Clamp>::GetRHI();
+	PassParameters->PatchDescriptors = Batch ? Batch->PatchDescriptors : nullptr;
+	PassParameters->VertexRegionOffset = FUintVector2(DispatchOrigin.X, DispatchOrigin.Y);
+	if (!PermutationVector.Get<FGPUDisplacementCS::FSineWaveDim>())
+	{
+		FRDGTextureRef DisplacementTextureRDG = DisplacementTexture ? 
+			CreateRDGTextureFromUTexture(GraphBuilder, DisplacementTexture, TEXT("DisplacementTexture")) :
+			GetDefaultWhiteTexture(GraphBuilder);
+		PassParameters->DisplacementTexture = GraphBuilder.CreateSRV(FRDGTextureSRVDesc::Create(DisplacementTextureRDG));
+		// Use Bilinear sampling with Clamp addressing to avoid edge wrapping artifacts
+		PassParameters->DisplacementSampler = TStaticSamplerState<SF_Bilinear, AM_Clamp, AM_Clamp, AM_Clamp>::GetRHI();
+	}
+	if (PermutationVector.Get<FGPUDisplacementCS::FRVTMaskDim>())
+	{
+		FRDGTextureRef SubtractTextureRDG = CreateRDGTextureFromUTexture(GraphBuilder, SubtractTexture, TEXT("SubtractTexture"));
+		PassParameters->RVTMaskTexture = GraphBuilder.CreateSRV(FRDGTextureSRVDesc::Create(SubtractTextureRDG));
+		PassParameters->RVTMaskSampler = TStaticSamplerState<SF_Bilinear, AM_Clamp, AM_Clamp, AM_Clamp>::GetRHI();
+	}
 	PassParameters->InputPositions = GraphBuilder.CreateSRV(VertexBuffer);
 	PassParameters->InputNormals = GraphBuilder.CreateSRV(NormalBuffer);
 	PassParameters->InputUVs = GraphBuilder.CreateSRV(UVBuffer);
 	PassParameters->OutputPositions = GraphBuilder.CreateUAV(VertexBuffer);
 
 	// Get shader
-	TShaderMapRef<FGPUDisplacementCS> ComputeShader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
+	TShaderMapRef<FGPUDisplacementCS> ComputeShader(GetGlobalShaderMap(GMaxRHIFeatureLevel), PermutationVector);
 
-	// Calculate dispatch size
-	FIntVector GroupCount(FMath::DivideAndRoundUp(VertexCount, 64), 1, 1);
+	// Calculate dispatch size (group z selects the patch when batching)
+	FIntVector GroupCount(
+		FMath::DivideAndRoundUp(DispatchSize.X, 8),
+		FMath::DivideAndRoundUp(DispatchSize.Y, 8),
+		Batch ? Batch->PatchCount : 1);
 
 	// Add compute pass
 	GraphBuilder.AddPass(
@@ -251,6 +324,8 @@ void FGPUTessellationMeshBuilder::DispatchDisplacement(
 		{
 			FComputeShaderUtils::Dispatch(RHICmdList, ComputeShader, *PassParameters, GroupCount);
 		});
+	
+	BuildStats.DisplacementPasses++;
 }
 
 void FGPUTessellationMeshBuilder::DispatchNormalCalculation(
@@ -262,66 +337,77 @@ void FGPUTessellationMeshBuilder::DispatchNormalCalculation(
 	UTexture* NormalMapTexture,
 	FRDGBufferRef VertexBuffer,
 	FRDGBufferRef NormalBuffer,
-	FRDGBufferRef UVBuffer)
+	FRDGBufferRef UVBuffer,
+	const FGPUTessellationPatchBatch* Batch,
+	const FIntRect* VertexRegion)
 {
-	int32 VertexCount = Resolution.X * Resolution.Y;
-
-	// Get displacement texture
-	FRDGTextureRef DisplacementTextureRDG = DisplacementTexture ?
-		CreateRDGTextureFromUTexture(GraphBuilder, DisplacementTexture, TEXT("DisplacementTexture")) :
-		GetDefaultWhiteTexture(GraphBuilder);
-
-	// Get subtract/mask texture (NEW - for correct normal calculation)
-	FRDGTextureRef SubtractTextureRDG = SubtractTexture ?
-		CreateRDGTextureFromUTexture(GraphBuilder, SubtractTexture, TEXT("SubtractTexture")) :
-		GetDefaultWhiteTexture(GraphBuilder);
-
-	// Get normal map texture (optional - only used when NormalCalculationMethod == FromNormalMap)
-	FRDGTextureRef NormalMapTextureRDG = NormalMapTexture ?
-		CreateRDGTextureFromUTexture(GraphBuilder, NormalMapTexture, TEXT("NormalMapTexture")) :
-		GetDefaultWhiteTexture(GraphBuilder);
-
-	// Dummy index buffer for normal calculation (not actually used in grid-based normals)
-	FRDGBufferRef DummyIndexBuffer = GraphBuilder.CreateBuffer(
-		FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), 3),
-		TEXT("GPUTessellation.DummyIndexBuffer"),
-		ERDGBufferFlags::None);
-	
-	// Clear dummy buffer to satisfy RDG validation
-	AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(DummyIndexBuffer), 0);
+	// Partial refreshes dispatch only VertexRegion of the grid
+	const FIntPoint DispatchOrigin = VertexRegion ? VertexRegion->Min : FIntPoint::ZeroValue;
+	const FIntPoint DispatchSize = VertexRegion ? VertexRegion->Size() : Resolution;
+
+	// FiniteDifference, GeometryBased and Hybrid share the finite difference kernel;
+	// the smoothing factor decides whether the geometry blend is compiled in
+	const bool bFromNormalMap = Settings.NormalCalculationMethod == EGPUTessellationNormalMethod::FromNormalMap;
+	FGPUNormalCalculationCS::FPermutationDomain PermutationVector;
+	PermutationVector.Set<FGPUNormalCalculationCS::FNormalMapDim>(bFromNormalMap);
+	PermutationVector.Set<FGPUNormalCalculationCS::FGeometryBlendDim>(Settings.NormalSmoothingFactor > 0.001f);
+	PermutationVector.Set<FGPUNormalCalculationCS::FSubtractTextureDim>(SubtractTexture != nullptr);
+	PermutationVector.Set<FGPUNormalCalculationCS::FSineWaveDim>(Settings.bUseSineWaveDisplacement);
+	PermutationVector.Set<FGPUNormalCalculationCS::FBatchedPatchesDim>(Batch != nullptr);
+	PermutationVector = FGPUNormalCalculationCS::RemapPermutation(PermutationVector);
 
 	// Setup shader parameters
 	FGPUNormalCalculationCS::FParameters* PassParameters = GraphBuilder.AllocParameters<FGPUNormalCalculationCS::FParameters>();
-	PassParameters->NormalCalculationMethod = (uint32)Settings.NormalCalculationMethod;
 	PassParameters->NormalSmoothingFactor = Settings.NormalSmoothingFactor;
 	PassParameters->bInvertNormals = Settings.bInvertNormals ? 1 : 0;
-	PassParameters->VertexCount = VertexCount;
 	PassParameters->ResolutionX = Resolution.X;
 	PassParameters->ResolutionY = Resolution.Y;
-	PassParameters->TexelSize = 1.0f / FMath::Max(Resolution.X, Resolution.Y);
+	// Finite differences step one grid vertex; the shader derives the step per patch (see CalculateGridStep)
 	PassParameters->PlaneSizeX = Settings.PlaneSizeX;
 	PassParameters->PlaneSizeY = Settings.PlaneSizeY;
-	PassParameters->DisplacementTexture = GraphBuilder.CreateSRV(FRDGTextureSRVDesc::Create(DisplacementTextureRDG));
-	// Use Bilinear sampling with Clamp addressing to avoid edge wrapping artifacts
-	PassParameters->DisplacementSampler = TStaticSamplerState<SF_Bilinear, AM_Clamp, AM_Clamp, AM_Clamp>::GetRHI();
+	PassParameters->PatchUVOffset = Settings.UVOffset;
+	PassParameters->PatchUVScale = Settings.UVScale;
+	PassParameters->PatchDescriptors = Batch ? Batch->PatchDescriptors : nullptr;
+	PassParameters->VertexRegionOffset = FUintVector2(DispatchOrigin.X, DispatchOrigin.Y);
 	PassParameters->DisplacementIntensity = Settings.DisplacementIntensity;
-	// Subtract/mask texture parameters (NEW - for correct normals with RVT)
-	PassParameters->bHasSubtractTexture = (SubtractTexture != nullptr) ? 1 : 0;
-	PassParameters->SubtractTexture = GraphBuilder.CreateSRV(FRDGTextureSRVDesc::Create(SubtractTextureRDG));
-	PassParameters->SubtractSampler = TStaticSamplerState<SF_Bilinear, AM_Clamp, AM_Clamp, AM_Clamp>::GetRHI();
-	// Normal map texture parameters
-	PassParameters->NormalMapTexture = GraphBuilder.CreateSRV(FRDGTextureSRVDesc::Create(NormalMapTextureRDG));
-	PassParameters->NormalMapSampler = TStaticSamplerState<SF_Bilinear, AM_Clamp, AM_Clamp, AM_Clamp>::GetRHI();
+	PassParameters->DisplacementOffset = Settings.DisplacementOffset;
+	if (bFromNormalMap)
+	{
+		// Normal map texture parameters
+		FRDGTextureRef NormalMapTextureRDG = NormalMapTexture ?
+			CreateRDGTextureFromUTexture(GraphBuilder, NormalMapTexture, TEXT("NormalMapTexture")) :
+			GetDefaultWhiteTexture(GraphBuilder);
+		PassParameters->NormalMapTexture = GraphBuilder.CreateSRV(FRDGTextureSRVDesc::Create(NormalMapTextureRDG));
+		PassParameters->NormalMapSampler = TStaticSamplerState<SF_Bilinear, AM_Clamp, AM_Clamp, AM_Clamp>::GetRHI();
+	}
+	else if (!PermutationVector.Get<FGPUNormalCalculationCS::FSineWaveDim>())
+	{
+		FRDGTextureRef DisplacementTextureRDG = DisplacementTexture ?
+			CreateRDGTextureFromUTexture(GraphBuilder, DisplacementTexture, TEXT("DisplacementTexture")) :
+			GetDefaultWhiteTexture(GraphBuilder);
+		PassParameters->DisplacementTexture = GraphBuilder.CreateSRV(FRDGTextureSRVDesc::Create(DisplacementTextureRDG));
+		// Use Bilinear sampling with Clamp addressing to avoid edge wrapping artifacts
+		PassParameters->DisplacementSampler = TStaticSamplerState<SF_Bilinear, AM_Clamp, AM_Clamp, AM_Clamp>::GetRHI();
+	}
+	if (PermutationVector.Get<FGPUNormalCalculationCS::FSubtractTextureDim>())
+	{
+		// Subtract/mask texture parameters (for correct normals with RVT)
+		FRDGTextureRef SubtractTextureRDG = CreateRDGTextureFromUTexture(GraphBuilder, SubtractTexture, TEXT("SubtractTexture"));
+		PassParameters->SubtractTexture = GraphBuilder.CreateSRV(FRDGTextureSRVDesc::Create(SubtractTextureRDG));
+		PassParameters->SubtractSampler = TStaticSamplerState<SF_Bilinear, AM_Clamp, AM_Clamp, AM_Clamp>::GetRHI();
+	}
 	PassParameters->InputPositions = GraphBuilder.CreateSRV(VertexBuffer);
 	PassParameters->InputUVs = GraphBuilder.CreateSRV(UVBuffer);
-	PassParameters->InputIndices = GraphBuilder.CreateSRV(DummyIndexBuffer);
 	PassParameters->OutputNormals = GraphBuilder.CreateUAV(NormalBuffer);
 
 	// Get shader
-	TShaderMapRef<FGPUNormalCalculationCS> ComputeShader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
+	TShaderMapRef<FGPUNormalCalculationCS> ComputeShader(GetGlobalShaderMap(GMaxRHIFeatureLevel), PermutationVector);
 
-	// Calculate dispatch size
-	FIntVector GroupCount(FMath::DivideAndRoundUp(VertexCount, 64), 1, 1);
+	// Calculate dispatch size (8x8 vertex tiles, group z selects the patch when batching)
+	FIntVector GroupCount(
+		FMath::DivideAndRoundUp(DispatchSize.X, 8),
+		FMath::DivideAndRoundUp(DispatchSize.Y, 8),
+		Batch ? Batch->PatchCount : 1);
 
 	// Add compute pass
 	GraphBuilder.AddPass(
@@ -332,15 +418,106 @@ void FGPUTessellationMeshBuilder::DispatchNormalCalculation(
 		{
 			FComputeShaderUtils::Dispatch(RHICmdList, ComputeShader, *PassParameters, GroupCount);
 		});
+	
+	BuildStats.NormalPasses++;
+}
+
+void FGPUTessellationMeshBuilder::DispatchTangentCalculation(
+	FRDGBuilder& GraphBuilder,
+	FIntPoint Resolution,
+	FRDGBufferRef VertexBuffer,
+	FRDGBufferRef NormalBuffer,
+	FRDGBufferRef UVBuffer,
+	FRDGBufferRef& OutTangentBuffer)
+{
+	const int32 VertexCount = Resolution.X * Resolution.Y;
+
+	OutTangentBuffer = GraphBuilder.CreateBuffer(
+		FRDGBufferDesc::CreateStructuredDesc(sizeof(FVector4f), VertexCount),
+		TEXT("GPUTessellation.TangentBuffer"));
+
+	// Setup shader parameters
+	FGPUTangentCalculationCS::FParameters* PassParameters = GraphBuilder.AllocParameters<FGPUTangentCalculationCS::FParameters>();
+	PassParameters->ResolutionX = Resolution.X;
+	PassParameters->ResolutionY = Resolution.Y;
+	PassParameters->VertexCount = VertexCount;
+	PassParameters->InputPositions = GraphBuilder.CreateSRV(VertexBuffer);
+	PassParameters->InputNormals = GraphBuilder.CreateSRV(NormalBuffer);
+	PassParameters->InputUVs = GraphBuilder.CreateSRV(UVBuffer);
+	PassParameters->OutputTangents = GraphBuilder.CreateUAV(OutTangentBuffer);
+
+	// Get shader
+	TShaderMapRef<FGPUTangentCalculationCS> ComputeShader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
+
+	// One thread per vertex, 64 per group
+	FIntVector GroupCount(FMath::DivideAndRoundUp(VertexCount, 64), 1, 1);
+
+	// Add compute pass
+	GraphBuilder.AddPass(
+		RDG_EVENT_NAME("GPUTessellation.CalculateTangents"),
+		PassParameters,
+		ERDGPassFlags::Compute,
+		[PassParameters, ComputeShader, GroupCount](FRHIComputeCommandList& RHICmdList)
+		{
+			FComputeShaderUtils::Dispatch(RHICmdList, ComputeShader, *PassParameters, GroupCount);
+		});
+	
+	BuildStats.TangentPasses++;
+}
+
+void FGPUTessellationMeshBuilder::AddTessellationFactorPass(
+	FRDGBuilder& GraphBuilder,
+	FRDGBufferRef VertexBuffer,
+	FRDGBufferRef IndexBuffer,
+	int32 TriangleCount,
+	const FMatrix& LocalToWorld,
+	const FVector& CameraPosition,
+	float MaxTessellationDistance,
+	float MinTessellationFactor,
+	float MaxTessellationFactor,
+	FRDGBufferRef& OutTessFactorBuffer)
+{
+	OutTessFactorBuffer = GraphBuilder.CreateBuffer(
+		FRDGBufferDesc::CreateStructuredDesc(sizeof(float), FMath::Max(TriangleCount, 1)),
+		TEXT("GPUTessellation.TessFactorBuffer"));
+
+	// Setup shader parameters
+	FGPUTessellationFactorCS::FParameters* PassParameters = GraphBuilder.AllocParameters<FGPUTessellationFactorCS::FParameters>();
+	PassParameters->CameraPosition = FVector3f(CameraPosition);
+	PassParameters->MaxTessellationDistance = MaxTessellationDistance;
+	PassParameters->MinTessellationFactor = MinTessellationFactor;
+	PassParameters->MaxTessellationFactor = MaxTessellationFactor;
+	PassParameters->LocalToWorld = FMatrix44f(LocalToWorld);
+	PassParameters->TriangleCount = TriangleCount;
+	PassParameters->InputVertices = GraphBuilder.CreateSRV(VertexBuffer);
+	PassParameters->InputIndices = GraphBuilder.CreateSRV(FRDGBufferSRVDesc(IndexBuffer, PF_R32_UINT));
+	PassParameters->OutputTessFactors = GraphBuilder.CreateUAV(OutTessFactorBuffer);
+
+	// Get shader
+	TShaderMapRef<FGPUTessellationFactorCS> ComputeShader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
+
+	// One thread per triangle (THREADGROUP_SIZE 64)
+	FIntVector GroupCount(FMath::DivideAndRoundUp(FMath::Max(TriangleCount, 1), 64), 1, 1);
+
+	// Add compute pass
+	GraphBuilder.AddPass(
+		RDG_EVENT_NAME("GPUTessellation.CalculateTessellationFactors"),
+		PassParameters,
+		ERDGPassFlags::Compute,
+		[PassParameters, ComputeShader, GroupCount](FRHIComputeCommandList& RHICmdList)
+		{
+			FComputeShaderUtils::Dispatch(RHICmdList, ComputeShader, *PassParameters, GroupCount);
+		});
 }
 
 void FGPUTessellationMeshBuilder::DispatchIndexGeneration(
 	FRDGBuilder& GraphBuilder,
 	FIntPoint Resolution,
 	const FIntVector4& EdgeCollapseFactors,
-	FRDGBufferRef& OutIndexBuffer)
+	FRDGBufferRef& OutIndexBuffer,
+	const FGPUTessellationPatchBatch* Batch)
 {
-	int32 IndexCount = (Resolution.X - 1) * (Resolution.Y - 1) * 6;
+	int32 IndexCount = Batch ? Batch->TotalIndexCount : (Resolution.X - 1) * (Resolution.Y - 1) * 6;
 
 	// Create output buffer as a typed buffer with IndexBuffer usage for proper binding
 	{
@@ -356,17 +533,20 @@ void FGPUTessellationMeshBuilder::DispatchIndexGeneration(
 	PassParameters->ResolutionX = Resolution.X;
 	PassParameters->ResolutionY = Resolution.Y;
 	PassParameters->EdgeCollapseFactors = EdgeCollapseFactors;
+	PassParameters->PatchDescriptors = Batch ? Batch->PatchDescriptors : nullptr;
 	// Create a typed UAV (R32_UINT) to match RWBuffer<uint> in the shader
 	PassParameters->OutputIndices = GraphBuilder.CreateUAV(FRDGBufferUAVDesc(OutIndexBuffer, PF_R32_UINT));
 
 	// Get shader
-	TShaderMapRef<FGPUIndexGenerationCS> ComputeShader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
+	FGPUIndexGenerationCS::FPermutationDomain PermutationVector;
+	PermutationVector.Set<FGPUIndexGenerationCS::FBatchedPatchesDim>(Batch != nullptr);
+	TShaderMapRef<FGPUIndexGenerationCS> ComputeShader(GetGlobalShaderMap(GMaxRHIFeatureLevel), PermutationVector);
 
-	// Calculate dispatch size
+	// Calculate dispatch size (group z selects the patch when batching)
 	FIntVector GroupCount(
 		FMath::DivideAndRoundUp(Resolution.X - 1, 8),
 		FMath::DivideAndRoundUp(Resolution.Y - 1, 8),
-		1);
+		Batch ? Batch->PatchCount : 1);
 
 	// Add compute pass
 	GraphBuilder.AddPass(
@@ -377,6 +557,8 @@ void FGPUTessellationMeshBuilder::DispatchIndexGeneration(
 		{
 			FComputeShaderUtils::Dispatch(RHICmdList, ComputeShader, *PassParameters, GroupCount);
 		});
+	
+	BuildStats.IndexPasses++;
 }
 
 void FGPUTessellationMeshBuilder::ExtractMeshData(
@@ -388,73 +570,24 @@ void FGPUTessellationMeshBuilder::ExtractMeshData(
 	FRDGBufferRef IndexBuffer,
 	FGPUTessellatedMeshData& OutMeshData)
 {
-	int32 VertexCount = Resolution.X * Resolution.Y;
-	int32 IndexCount = (Resolution.X - 1) * (Resolution.Y - 1) * 6;
-
-	// Prepare output arrays
-	OutMeshData.Reset();
-	OutMeshData.Vertices.SetNumUninitialized(VertexCount);
-	OutMeshData.Normals.SetNumUninitialized(VertexCount);
-	OutMeshData.UVs.SetNumUninitialized(VertexCount);
-	OutMeshData.Indices.SetNumUninitialized(IndexCount);
-	OutMeshData.ResolutionX = Resolution.X;
-	OutMeshData.ResolutionY = Resolution.Y;
-
-	// Create staging buffers for CPU readback
-	FRHIGPUBufferReadback* VertexReadback = new FRHIGPUBufferReadback(TEXT("VertexReadback"));
-	FRHIGPUBufferReadback* NormalReadback = new FRHIGPUBufferReadback(TEXT("NormalReadback"));
-	FRHIGPUBufferReadback* UVReadback = new FRHIGPUBufferReadback(TEXT("UVReadback"));
-	FRHIGPUBufferReadback* IndexReadback = new FRHIGPUBufferReadback(TEXT("IndexReadback"));
-
-	// Enqueue copy operations
-	AddEnqueueCopyPass(GraphBuilder, VertexReadback, VertexBuffer, sizeof(FVector3f) * VertexCount);
-	AddEnqueueCopyPass(GraphBuilder, NormalReadback, NormalBuffer, sizeof(FVector3f) * VertexCount);
-	AddEnqueueCopyPass(GraphBuilder, UVReadback, UVBuffer, sizeof(FVector2f) * VertexCount);
-	AddEnqueueCopyPass(GraphBuilder, IndexReadback, IndexBuffer, sizeof(uint32) * IndexCount);
+	// Pooled staging buffers, read as soon as the GPU is idle
+	FGPUTessellationMeshReadback* Readback = new FGPUTessellationMeshReadback();
+	EnqueueMeshReadback(GraphBuilder, Resolution, VertexBuffer, NormalBuffer, UVBuffer, IndexBuffer, EGPUTessellationReadbackContent::Full, *Readback);
 
 	// Add pass to extract data after GPU work completes
 	GraphBuilder.AddPass(
 		RDG_EVENT_NAME("ExtractTessellationData"),
 		ERDGPassFlags::None,
-		[VertexReadback, NormalReadback, UVReadback, IndexReadback, &OutMeshData, VertexCount, IndexCount](FRHICommandListImmediate& RHICmdList)
+		[Readback, &OutMeshData](FRHICommandListImmediate& RHICmdList)
 		{
 			// Wait for GPU to finish
 			RHICmdList.BlockUntilGPUIdle();
 
-			// Copy vertices
-			if (const void* VertexData = VertexReadback->Lock(sizeof(FVector3f) * VertexCount))
-			{
-				FMemory::Memcpy(OutMeshData.Vertices.GetData(), VertexData, sizeof(FVector3f) * VertexCount);
-				VertexReadback->Unlock();
-			}
-
-			// Copy normals
-			if (const void* NormalData = NormalReadback->Lock(sizeof(FVector3f) * VertexCount))
-			{
-				FMemory::Memcpy(OutMeshData.Normals.GetData(), NormalData, sizeof(FVector3f) * VertexCount);
-				NormalReadback->Unlock();
-			}
-
-			// Copy UVs
-			if (const void* UVData = UVReadback->Lock(sizeof(FVector2f) * VertexCount))
-			{
-				FMemory::Memcpy(OutMeshData.UVs.GetData(), UVData, sizeof(FVector2f) * VertexCount);
-				UVReadback->Unlock();
-			}
-
-			// Copy indices
-			if (const void* IndexData = IndexReadback->Lock(sizeof(uint32) * IndexCount))
-			{
-				FMemory::Memcpy(OutMeshData.Indices.GetData(), IndexData, sizeof(uint32) * IndexCount);
-				IndexReadback->Unlock();
-			}
-
-			// Cleanup
-			delete VertexReadback;
-			delete NormalReadback;
-			delete UVReadback;
-			delete IndexReadback;
+			Readback->Read(OutMeshData);
+			delete Readback;
 		});
+	
+	BuildStats.OtherPasses++;
 }
 
 FRDGTextureRef FGPUTessellationMeshBuilder::CreateRDGTextureFromUTexture(
@@ -489,6 +622,8 @@ void FGPUTessellationMeshBuilder::ExecuteTessellationPipeline(
 	UTexture* NormalMapTexture,
 	FGPUTessellationBuffers& OutGPUBuffers)
 {
+	GPUTESSELLATION_SCOPE_CYCLE_COUNTER(STAT_GPUTessellation_RDGSetup, RDGSetup);
+	
 	// Calculate resolution
 	FIntPoint Resolution = CalculateResolution(Settings.TessellationFactor);
 	int32 VertexCount = Resolution.X * Resolution.Y;
@@ -522,29 +657,171 @@ void FGPUTessellationMeshBuilder::ExecuteTessellationPipeline(
 	// Store metadata
 	OutGPUBuffers.VertexCount = VertexCount;
 	OutGPUBuffers.IndexCount = IndexCount;
+	BuildStats.VertexCount += VertexCount;
+	BuildStats.IndexCount += IndexCount;
+	OutGPUBuffers.ResolutionX = Resolution.X;
+	OutGPUBuffers.ResolutionY = Resolution.Y;
+	
+	ConvertToPersistentBuffers(GraphBuilder, VertexBuffer, NormalBuffer, UVBuffer, IndexBuffer, OutGPUBuffers);
+	
+	// Tessellation pipeline scheduled (verbose logging removed for performance)
+}
+
+void FGPUTessellationMeshBuilder::UploadMeshData(
+	FRDGBuilder& GraphBuilder,
+	const FGPUTessellatedMeshData& MeshData,
+	FGPUTessellationBuffers& OutGPUBuffers)
+{
+	GPUTESSELLATION_SCOPE_CYCLE_COUNTER(STAT_GPUTessellation_RDGSetup, RDGSetup);
+	
+	const FIntPoint Resolution(MeshData.ResolutionX, MeshData.ResolutionY);
+	const int32 VertexCount = Resolution.X * Resolution.Y;
+	const int32 IndexCount = (Resolution.X - 1) * (Resolution.Y - 1) * 6;
+	check(MeshData.Vertices.Num() == VertexCount && MeshData.Normals.Num() == VertexCount && MeshData.UVs.Num() == VertexCount);
+	
+	// Same structured buffers the generation passes create; RDG copies the data, so MeshData may go away
+	FRDGBufferRef VertexBuffer = CreateStructuredBuffer(GraphBuilder, TEXT("GPUTessellation.VertexBuffer"), MeshData.Vertices);
+	FRDGBufferRef NormalBuffer = CreateStructuredBuffer(GraphBuilder, TEXT("GPUTessellation.NormalBuffer"), MeshData.Normals);
+	FRDGBufferRef UVBuffer = CreateStructuredBuffer(GraphBuilder, TEXT("GPUTessellation.UVBuffer"), MeshData.UVs);
+	FRDGBufferRef IndexBuffer = nullptr;
+	
+	// The grid topology follows from the resolution, so indices are generated as usual
+	DispatchIndexGeneration(GraphBuilder, Resolution, FIntVector4(1, 1, 1, 1), IndexBuffer);
+	
+	OutGPUBuffers.VertexCount = VertexCount;
+	OutGPUBuffers.IndexCount = IndexCount;
+	BuildStats.VertexCount += VertexCount;
+	BuildStats.IndexCount += IndexCount;
 	OutGPUBuffers.ResolutionX = Resolution.X;
 	OutGPUBuffers.ResolutionY = Resolution.Y;
 	
-	// Convert to external pooled buffers
+	ConvertToPersistentBuffers(GraphBuilder, VertexBuffer, NormalBuffer, UVBuffer, IndexBuffer, OutGPUBuffers);
+}
+
+bool FGPUTessellationMeshBuilder::RefreshTessellationPipeline(
+	FRDGBuilder& GraphBuilder,
+	const FGPUTessellationSettings& Settings,
+	const FMatrix& LocalToWorld,
+	UTexture* DisplacementTexture,
+	UTexture* SubtractTexture,
+	UTexture* NormalMapTexture,
+	FGPUTessellationBuffers& InOutGPUBuffers,
+	TConstArrayView<FBox2f> DirtyUVRegions)
+{
+	GPUTESSELLATION_SCOPE_CYCLE_COUNTER(STAT_GPUTessellation_RDGSetup, RDGSetup);
+	
+	FIntPoint Resolution = CalculateResolution(Settings.TessellationFactor);
+	
+	// Same grid only - a different resolution needs new buffers and indices
+	if (!InOutGPUBuffers.IsValid() ||
+		!InOutGPUBuffers.PooledPositionBuffer.IsValid() ||
+		!InOutGPUBuffers.PooledNormalBuffer.IsValid() ||
+		!InOutGPUBuffers.PooledUVBuffer.IsValid() ||
+		Resolution.X != InOutGPUBuffers.ResolutionX ||
+		Resolution.Y != InOutGPUBuffers.ResolutionY)
+	{
+		return false;
+	}
+
+	// Write straight into the buffers the vertex factory already reads
+	FRDGBufferRef VertexBuffer = GraphBuilder.RegisterExternalBuffer(InOutGPUBuffers.PooledPositionBuffer);
+	FRDGBufferRef NormalBuffer = GraphBuilder.RegisterExternalBuffer(InOutGPUBuffers.PooledNormalBuffer);
+	FRDGBufferRef UVBuffer = GraphBuilder.RegisterExternalBuffer(InOutGPUBuffers.PooledUVBuffer);
+
+	if (DirtyUVRegions.Num() == 0)
+	{
+		DispatchVertexGeneration(GraphBuilder, Settings, Resolution, LocalToWorld, FVector::ZeroVector, VertexBuffer, NormalBuffer, UVBuffer);
+		DispatchDisplacement(GraphBuilder, Settings, Resolution, DisplacementTexture, SubtractTexture, VertexBuffer, NormalBuffer, UVBuffer);
+		if (Settings.NormalCalculationMethod != EGPUTessellationNormalMethod::Disabled)
+		{
+			DispatchNormalCalculation(GraphBuilder, Settings, Resolution, DisplacementTexture, SubtractTexture, NormalMapTexture, VertexBuffer, NormalBuffer, UVBuffer);
+		}
+		BuildStats.VertexCount += Resolution.X * Resolution.Y;
+		return true;
+	}
+
+	const FIntRect GridRect(FIntPoint::ZeroValue, Resolution);
+	for (const FBox2f& UVRegion : DirtyUVRegions)
+	{
+		FIntRect VertexRegion = CalculateDirtyVertexRegion(Settings, Resolution, UVRegion);
+		if (VertexRegion.IsEmpty())
+		{
+			continue;
+		}
+
+		// Positions are rebuilt from the flat grid, so generation and displacement cover the same vertices
+		BuildStats.VertexCount += VertexRegion.Area();
+		DispatchVertexGeneration(GraphBuilder, Settings, Resolution, LocalToWorld, FVector::ZeroVector, VertexBuffer, NormalBuffer, UVBuffer, nullptr, &VertexRegion);
+		DispatchDisplacement(GraphBuilder, Settings, Resolution, DisplacementTexture, SubtractTexture, VertexBuffer, NormalBuffer, UVBuffer, nullptr, &VertexRegion);
+
+		// Normals one vertex past the moved positions read them through the finite difference stencil
+		if (Settings.NormalCalculationMethod != EGPUTessellationNormalMethod::Disabled)
+		{
+			FIntRect NormalRegion = VertexRegion;
+			NormalRegion.InflateRect(1);
+			NormalRegion.Clip(GridRect);
+			DispatchNormalCalculation(GraphBuilder, Settings, Resolution, DisplacementTexture, SubtractTexture, NormalMapTexture, VertexBuffer, NormalBuffer, UVBuffer, nullptr, &NormalRegion);
+		}
+	}
+
+	return true;
+}
+
+FIntRect FGPUTessellationMeshBuilder::CalculateDirtyVertexRegion(const FGPUTessellationSettings& Settings, FIntPoint Resolution, const FBox2f& UVRegion)
+{
+	if (!UVRegion.bIsValid || Settings.UVScale.X <= 0.0f || Settings.UVScale.Y <= 0.0f)
+	{
+		return FIntRect();
+	}
+
+	// Invert the vertex generation mapping: UV = Vertex / (Resolution - 1) * UVScale + UVOffset
+	const FVector2f VerticesPerUV(
+		FMath::Max(Resolution.X - 1, 1) / Settings.UVScale.X,
+		FMath::Max(Resolution.Y - 1, 1) / Settings.UVScale.Y);
+	const FVector2f MinVertex = (UVRegion.Min - Settings.UVOffset) * VerticesPerUV;
+	const FVector2f MaxVertex = (UVRegion.Max - Settings.UVOffset) * VerticesPerUV;
+
+	// Bilinear sampling reaches one vertex further on each side
+	FIntRect VertexRegion(
+		FIntPoint(FMath::FloorToInt(MinVertex.X) - 1, FMath::FloorToInt(MinVertex.Y) - 1),
+		FIntPoint(FMath::CeilToInt(MaxVertex.X) + 2, FMath::CeilToInt(MaxVertex.Y) + 2));
+	VertexRegion.Clip(FIntRect(FIntPoint::ZeroValue, Resolution));
+	return VertexRegion;
+}
+
+void FGPUTessellationMeshBuilder::ConvertToPersistentBuffers(
+	FRDGBuilder& GraphBuilder,
+	FRDGBufferRef VertexBuffer,
+	FRDGBufferRef NormalBuffer,
+	FRDGBufferRef UVBuffer,
+	FRDGBufferRef IndexBuffer,
+	FGPUTessellationBuffers& OutBuffers)
+{
+	// Convert to external pooled buffers so the results outlive the graph
 	TRefCountPtr<FRDGPooledBuffer> PooledPositionBuffer = GraphBuilder.ConvertToExternalBuffer(VertexBuffer);
 	TRefCountPtr<FRDGPooledBuffer> PooledNormalBuffer = GraphBuilder.ConvertToExternalBuffer(NormalBuffer);
 	TRefCountPtr<FRDGPooledBuffer> PooledUVBuffer = GraphBuilder.ConvertToExternalBuffer(UVBuffer);
 	TRefCountPtr<FRDGPooledBuffer> PooledIndexBuffer = GraphBuilder.ConvertToExternalBuffer(IndexBuffer);
 	
+	OutBuffers.PooledPositionBuffer = PooledPositionBuffer;
+	OutBuffers.PooledNormalBuffer = PooledNormalBuffer;
+	OutBuffers.PooledUVBuffer = PooledUVBuffer;
+	OutBuffers.PooledIndexBuffer = PooledIndexBuffer;
+	
 	// After graph execution, extract the RHI buffers and create SRVs
 	GraphBuilder.AddPass(
 		RDG_EVENT_NAME("CreateGPUBufferSRVs"),
 		ERDGPassFlags::None,
-		[&OutGPUBuffers, PooledPositionBuffer, PooledNormalBuffer, PooledUVBuffer, PooledIndexBuffer](FRHICommandList& RHICmdList)
+		[&OutBuffers, PooledPositionBuffer, PooledNormalBuffer, PooledUVBuffer, PooledIndexBuffer](FRHICommandList& RHICmdList)
 		{
 			// Extract RHI buffers from pooled buffers
 			if (PooledPositionBuffer.IsValid())
 			{
-				OutGPUBuffers.PositionBuffer = PooledPositionBuffer->GetRHI();
+				OutBuffers.PositionBuffer = PooledPositionBuffer->GetRHI();
 				
 				// Create structured buffer SRV for float3 position data
-				OutGPUBuffers.PositionSRV = RHICmdList.CreateShaderResourceView(
-					OutGPUBuffers.PositionBuffer,
+				OutBuffers.PositionSRV = RHICmdList.CreateShaderResourceView(
+					OutBuffers.PositionBuffer,
 					FRHIViewDesc::CreateBufferSRV()
 						.SetType(FRHIViewDesc::EBufferType::Structured)
 				);
@@ -552,11 +829,11 @@ void FGPUTessellationMeshBuilder::ExecuteTessellationPipeline(
 			
 			if (PooledNormalBuffer.IsValid())
 			{
-				OutGPUBuffers.NormalBuffer = PooledNormalBuffer->GetRHI();
+				OutBuffers.NormalBuffer = PooledNormalBuffer->GetRHI();
 				
 				// Create structured buffer SRV for float3 normal data
-				OutGPUBuffers.NormalSRV = RHICmdList.CreateShaderResourceView(
-					OutGPUBuffers.NormalBuffer,
+				OutBuffers.NormalSRV = RHICmdList.CreateShaderResourceView(
+					OutBuffers.NormalBuffer,
 					FRHIViewDesc::CreateBufferSRV()
 						.SetType(FRHIViewDesc::EBufferType::Structured)
 				);
@@ -564,11 +841,11 @@ void FGPUTessellationMeshBuilder::ExecuteTessellationPipeline(
 			
 			if (PooledUVBuffer.IsValid())
 			{
-				OutGPUBuffers.UVBuffer = PooledUVBuffer->GetRHI();
+				OutBuffers.UVBuffer = PooledUVBuffer->GetRHI();
 				
 				// Create structured buffer SRV for float2 UV data
-				OutGPUBuffers.UVSRV = RHICmdList.CreateShaderResourceView(
-					OutGPUBuffers.UVBuffer,
+				OutBuffers.UVSRV = RHICmdList.CreateShaderResourceView(
+					OutBuffers.UVBuffer,
 					FRHIViewDesc::CreateBufferSRV()
 						.SetType(FRHIViewDesc::EBufferType::Structured)
 				);
@@ -577,21 +854,19 @@ void FGPUTessellationMeshBuilder::ExecuteTessellationPipeline(
 			// Set up index buffer wrapper for mesh rendering
 			if (PooledIndexBuffer.IsValid())
 			{
-				OutGPUBuffers.IndexBufferRHI = PooledIndexBuffer->GetRHI();
+				OutBuffers.IndexBufferRHI = PooledIndexBuffer->GetRHI();
 				// Set the base class IndexBufferRHI member for rendering
-				OutGPUBuffers.IndexBuffer.IndexBufferRHI = OutGPUBuffers.IndexBufferRHI;
+				OutBuffers.IndexBuffer.IndexBufferRHI = OutBuffers.IndexBufferRHI;
 				
 				// Initialize the index buffer as a render resource if not already initialized
-				if (!OutGPUBuffers.IndexBuffer.IsInitialized())
+				if (!OutBuffers.IndexBuffer.IsInitialized())
 				{
-					OutGPUBuffers.IndexBuffer.InitResource(RHICmdList);
+					OutBuffers.IndexBuffer.InitResource(RHICmdList);
 				}
 			}
-			
-			// Debug logging removed - too verbose, enable in SceneProxy if needed
 		});
 	
-	// Tessellation pipeline scheduled (verbose logging removed for performance)
+	BuildStats.OtherPasses++;
 }
 
 // ============================================================================
@@ -610,51 +885,117 @@ void FGPUTessellationMeshBuilder::ExecutePatchTessellationPipeline(
 	UTexture* SubtractTexture,
 	UTexture* NormalMapTexture,
 	FGPUTessellationPatchBuffers& OutPatchBuffers)
+{
+	PreparePatchGeneration(Settings, LocalToWorld, CameraPosition, ViewFrustum, PatchCountX, PatchCountY, OutPatchBuffers);
+	
+	GeneratePendingPatches(
+		GraphBuilder,
+		Settings,
+		LocalToWorld,
+		ViewFrustum,
+		DisplacementTexture,
+		SubtractTexture,
+		NormalMapTexture,
+		0,
+		OutPatchBuffers);
+}
+
+void FGPUTessellationMeshBuilder::PreparePatchGeneration(
+	const FGPUTessellationSettings& Settings,
+	const FMatrix& LocalToWorld,
+	const FVector& CameraPosition,
+	const FConvexVolume* ViewFrustum,
+	int32 PatchCountX,
+	int32 PatchCountY,
+	FGPUTessellationPatchBuffers& OutPatchBuffers)
 {
 	check(PatchCountX > 0 && PatchCountY > 0);
 	
 	// Calculate patch information (LOD, bounds, culling)
 	TArray<FGPUTessellationPatchInfo> PatchInfo;
 	
-	// Debug: Log the LocalToWorld matrix
-	FVector Location = LocalToWorld.GetOrigin();
-	FVector Scale = LocalToWorld.GetScaleVector();
-	UE_LOG(LogTemp, Warning, TEXT("ExecutePatchPipeline: LocalToWorld Location=%s Scale=%s"), 
-		*Location.ToString(), *Scale.ToString());
+	UE_LOG(LogGPUTessellation, Verbose, TEXT("ExecutePatchPipeline: LocalToWorld Location=%s Scale=%s"), 
+		*LocalToWorld.GetOrigin().ToString(), *LocalToWorld.GetScaleVector().ToString());
 	
 	CalculatePatchInfo(Settings, LocalToWorld, CameraPosition, ViewFrustum, PatchCountX, PatchCountY, PatchInfo);
 	ComputePatchEdgeTransitions(PatchCountX, PatchCountY, PatchInfo);
 	
-	// Resize patch buffer arrays
 	int32 TotalPatches = PatchCountX * PatchCountY;
-	OutPatchBuffers.PatchBuffers.SetNum(TotalPatches);
+	
+	// Release whatever the buffers held; only PatchInfo carries over
+	OutPatchBuffers.Reset();
 	OutPatchBuffers.PatchInfo = PatchInfo;
 	OutPatchBuffers.PatchCountX = PatchCountX;
 	OutPatchBuffers.PatchCountY = PatchCountY;
+	OutPatchBuffers.bBatched = CVarGPUTessellationBatchedPatches.GetValueOnRenderThread() != 0;
+	OutPatchBuffers.NextPatchToGenerate = 0;
 	
-	// Debug: Log patch subdivision info
-	UE_LOG(LogTemp, Warning, TEXT("GPUTessellation: Generating %dx%d = %d patches"), 
+	if (!OutPatchBuffers.bBatched)
+	{
+		OutPatchBuffers.PatchBuffers.SetNum(TotalPatches);
+	}
+	
+	UE_LOG(LogGPUTessellation, Verbose, TEXT("GPUTessellation: Generating %dx%d = %d patches"), 
 		PatchCountX, PatchCountY, TotalPatches);
+}
+
+bool FGPUTessellationMeshBuilder::GeneratePendingPatches(
+	FRDGBuilder& GraphBuilder,
+	const FGPUTessellationSettings& Settings,
+	const FMatrix& LocalToWorld,
+	const FConvexVolume* ViewFrustum,
+	UTexture* DisplacementTexture,
+	UTexture* SubtractTexture,
+	UTexture* NormalMapTexture,
+	int32 MaxPatches,
+	FGPUTessellationPatchBuffers& OutPatchBuffers)
+{
+	GPUTESSELLATION_SCOPE_CYCLE_COUNTER(STAT_GPUTessellation_RDGSetup, RDGSetup);
+	
+	const int32 TotalPatches = OutPatchBuffers.PatchInfo.Num();
+	
+	if (OutPatchBuffers.bBatched)
+	{
+		// Batched patches share buffers sized for the whole set, so they are always generated together
+		if (!OutPatchBuffers.IsGenerationComplete())
+		{
+			GenerateBatchedPatches(
+				GraphBuilder,
+				Settings,
+				LocalToWorld,
+				ViewFrustum,
+				DisplacementTexture,
+				SubtractTexture,
+				NormalMapTexture,
+				OutPatchBuffers);
+			OutPatchBuffers.NextPatchToGenerate = TotalPatches;
+		}
+		return true;
+	}
 	
 	// Generate each patch independently (pure GPU)
+	const int32 FirstPatch = OutPatchBuffers.NextPatchToGenerate;
 	int32 SkippedCulled = 0;
 	int32 SkippedInvalidLOD = 0;
 	int32 GeneratedSuccessfully = 0;
 	
-	for (int32 PatchIndex = 0; PatchIndex < TotalPatches; ++PatchIndex)
+	int32 PatchIndex = FirstPatch;
+	for (; PatchIndex < TotalPatches; ++PatchIndex)
 	{
-		const FGPUTessellationPatchInfo& Patch = PatchInfo[PatchIndex];
-		
-		// Debug: Log first few patches
-		if (PatchIndex < 4)
+		// Only generated patches count toward the per-step limit
+		if (MaxPatches > 0 && GeneratedSuccessfully >= MaxPatches)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("  Patch[%d]: UV:(%.3f,%.3f) Size:(%.3f,%.3f) LOD:%d Visible:%d WorldCenter:%s"),
-				PatchIndex,
-				Patch.PatchOffset.X, Patch.PatchOffset.Y,
-				Patch.PatchSize.X, Patch.PatchSize.Y,
-				Patch.TessellationLevel, Patch.bVisible, *Patch.WorldCenter.ToString());
+			break;
 		}
 		
+		const FGPUTessellationPatchInfo& Patch = OutPatchBuffers.PatchInfo[PatchIndex];
+		
+		UE_LOG(LogGPUTessellation, VeryVerbose, TEXT("  Patch[%d]: UV:(%.3f,%.3f) Size:(%.3f,%.3f) LOD:%d Visible:%d WorldCenter:%s"),
+			PatchIndex,
+			Patch.PatchOffset.X, Patch.PatchOffset.Y,
+			Patch.PatchSize.X, Patch.PatchSize.Y,
+			Patch.TessellationLevel, Patch.bVisible, *Patch.WorldCenter.ToString());
+		
 		// Skip culled patches
 		if (!Patch.bVisible)
 		{
@@ -666,7 +1007,7 @@ void FGPUTessellationMeshBuilder::ExecutePatchTessellationPipeline(
 		// Validate tessellation level before generating
 		if (Patch.TessellationLevel <= 0)
 		{
-			UE_LOG(LogTemp, Error, TEXT("  Patch[%d]: INVALID TessellationLevel=%d, skipping!"), 
+			UE_LOG(LogGPUTessellation, Error, TEXT("  Patch[%d]: INVALID TessellationLevel=%d, skipping!"), 
 				PatchIndex, Patch.TessellationLevel);
 			OutPatchBuffers.PatchBuffers[PatchIndex].Reset();
 			SkippedInvalidLOD++;
@@ -686,14 +1027,324 @@ void FGPUTessellationMeshBuilder::ExecutePatchTessellationPipeline(
 		);
 		
 		GeneratedSuccessfully++;
+		BuildStats.VertexCount += OutPatchBuffers.PatchBuffers[PatchIndex].VertexCount;
+		BuildStats.IndexCount += OutPatchBuffers.PatchBuffers[PatchIndex].IndexCount;
 		
 		// Note: Buffers won't be valid until after GraphBuilder.Execute() is called
 		// Validation happens in the scene proxy when rendering
 	}
+	OutPatchBuffers.NextPatchToGenerate = PatchIndex;
+	BuildStats.GeneratedPatches += GeneratedSuccessfully;
+	BuildStats.CulledPatches += SkippedCulled;
+	GPUTESSELLATION_INC_COUNTER(STAT_GPUTessellation_PatchesGenerated, PatchesGenerated, GeneratedSuccessfully);
 	
-	// Log summary
-	UE_LOG(LogTemp, Warning, TEXT("GPUTessellation: Patch Generation Summary - Total:%d Generated:%d SkippedCulled:%d SkippedInvalidLOD:%d"),
-		TotalPatches, GeneratedSuccessfully, SkippedCulled, SkippedInvalidLOD);
+	UE_LOG(LogGPUTessellation, Verbose, TEXT("GPUTessellation: Patch Generation Summary - Total:%d Range:[%d,%d) Generated:%d SkippedCulled:%d SkippedInvalidLOD:%d"),
+		TotalPatches, FirstPatch, PatchIndex, GeneratedSuccessfully, SkippedCulled, SkippedInvalidLOD);
+	
+	return OutPatchBuffers.IsGenerationComplete();
+}
+
+void FGPUTessellationMeshBuilder::GenerateBatchedPatches(
+	FRDGBuilder& GraphBuilder,
+	const FGPUTessellationSettings& Settings,
+	const FMatrix& LocalToWorld,
+	const FConvexVolume* ViewFrustum,
+	UTexture* DisplacementTexture,
+	UTexture* SubtractTexture,
+	UTexture* NormalMapTexture,
+	FGPUTessellationPatchBuffers& OutPatchBuffers)
+{
+	OutPatchBuffers.bBatched = true;
+	OutPatchBuffers.IndirectDraw.Reset();
+	
+	// Indirect draws share one plain index grid per distinct patch resolution (LOD level)
+	bool bIndirect = CVarGPUTessellationIndirectPatches.GetValueOnRenderThread() != 0;
+	TArray<FIntPoint> LODResolutions;
+	if (bIndirect)
+	{
+		for (const FGPUTessellationPatchInfo& Patch : OutPatchBuffers.PatchInfo)
+		{
+			if (Patch.TessellationLevel > 0 && Patch.ResolutionX >= 2 && Patch.ResolutionY >= 2)
+			{
+				LODResolutions.AddUnique(FIntPoint(Patch.ResolutionX, Patch.ResolutionY));
+			}
+		}
+		LODResolutions.Sort([](const FIntPoint& A, const FIntPoint& B) { return A.X * A.Y > B.X * B.Y; });
+		
+		if (LODResolutions.Num() > FGPUPatchIndirectArgsCS::MaxLODLevels)
+		{
+			UE_LOG(LogGPUTessellation, Warning, TEXT("GPUTessellation: %d patch LOD levels exceed the indirect draw limit of %d, drawing patches directly"),
+				LODResolutions.Num(), FGPUPatchIndirectArgsCS::MaxLODLevels);
+			bIndirect = false;
+		}
+	}
+	OutPatchBuffers.bIndirect = bIndirect;
+	
+	TArray<FUintVector4> LODIndexRanges;
+	TArray<FGPUTessellationPatchDescriptor> LODDescriptors;
+	int32 LODIndexCount = 0;
+	for (const FIntPoint& LODResolution : LODResolutions)
+	{
+		const int32 LODIndices = (LODResolution.X - 1) * (LODResolution.Y - 1) * 6;
+		LODIndexRanges.Add(FUintVector4(LODIndices, LODIndexCount, 0, 0));
+		
+		// Plain grid; edge collapse is applied per patch by the indirect vertex factory
+		FGPUTessellationPatchDescriptor& LODDescriptor = LODDescriptors.AddDefaulted_GetRef();
+		LODDescriptor.UVOffset = FVector2f::ZeroVector;
+		LODDescriptor.UVScale = FVector2f::UnitVector;
+		LODDescriptor.ResolutionX = LODResolution.X;
+		LODDescriptor.ResolutionY = LODResolution.Y;
+		LODDescriptor.VertexBase = 0;
+		LODDescriptor.IndexBase = LODIndexCount;
+		LODDescriptor.EdgeCollapseFactors = FUintVector4(1, 1, 1, 1);
+		
+		LODIndexCount += LODIndices;
+	}
+	
+	// Pack every visible patch back to back into the shared buffers
+	// Indirect draws cull on the GPU, so every valid patch is generated
+	TArray<FGPUTessellationPatchCullData> CullData;
+	TArray<FGPUTessellationPatchDescriptor> Descriptors;
+	Descriptors.Reserve(OutPatchBuffers.PatchInfo.Num());
+	FIntPoint MaxResolution(0, 0);
+	int32 TotalVertexCount = 0;
+	int32 TotalIndexCount = 0;
+	int32 SkippedCulled = 0;
+	int32 SkippedInvalidLOD = 0;
+	
+	for (int32 PatchIndex = 0; PatchIndex < OutPatchBuffers.PatchInfo.Num(); ++PatchIndex)
+	{
+		FGPUTessellationPatchInfo& Patch = OutPatchBuffers.PatchInfo[PatchIndex];
+		Patch.FirstVertex = 0;
+		Patch.NumVertices = 0;
+		Patch.FirstIndex = 0;
+		Patch.NumIndices = 0;
+		
+		if (!Patch.bVisible && !bIndirect)
+		{
+			SkippedCulled++;
+			continue;
+		}
+		
+		if (Patch.TessellationLevel <= 0 || Patch.ResolutionX < 2 || Patch.ResolutionY < 2)
+		{
+			UE_LOG(LogGPUTessellation, Error, TEXT("  Patch[%d]: INVALID TessellationLevel=%d Resolution=%dx%d, skipping!"), 
+				PatchIndex, Patch.TessellationLevel, Patch.ResolutionX, Patch.ResolutionY);
+			SkippedInvalidLOD++;
+			continue;
+		}
+		
+		Patch.FirstVertex = TotalVertexCount;
+		Patch.NumVertices = Patch.ResolutionX * Patch.ResolutionY;
+		Patch.FirstIndex = TotalIndexCount;
+		Patch.NumIndices = (Patch.ResolutionX - 1) * (Patch.ResolutionY - 1) * 6;
+		
+		if (bIndirect)
+		{
+			// Index range of the shared LOD grid instead of a private copy
+			const int32 LODIndex = LODResolutions.IndexOfByKey(FIntPoint(Patch.ResolutionX, Patch.ResolutionY));
+			Patch.FirstIndex = LODIndexRanges[LODIndex].Y;
+			
+			FGPUTessellationPatchCullData& PatchCullData = CullData.AddDefaulted_GetRef();
+			PatchCullData.BoundsCenter = FVector3f(Patch.WorldBounds.GetCenter());
+			PatchCullData.LODIndex = LODIndex;
+			PatchCullData.BoundsExtent = FVector3f(Patch.WorldBounds.GetExtent());
+		}
+		
+		// Plane size stays global; the descriptor selects this patch's UV window
+		FGPUTessellationPatchDescriptor& Descriptor = Descriptors.AddDefaulted_GetRef();
+		Descriptor.UVOffset = Patch.PatchOffset;
+		Descriptor.UVScale = Patch.PatchSize;
+		Descriptor.ResolutionX = Patch.ResolutionX;
+		Descriptor.ResolutionY = Patch.ResolutionY;
+		Descriptor.VertexBase = Patch.FirstVertex;
+		Descriptor.IndexBase = Patch.FirstIndex;
+		Descriptor.EdgeCollapseFactors = FUintVector4(
+			Patch.EdgeCollapseFactors.X,
+			Patch.EdgeCollapseFactors.Y,
+			Patch.EdgeCollapseFactors.Z,
+			Patch.EdgeCollapseFactors.W);
+		
+		TotalVertexCount += Patch.NumVertices;
+		TotalIndexCount += bIndirect ? 0 : Patch.NumIndices;
+		MaxResolution = MaxResolution.ComponentMax(FIntPoint(Patch.ResolutionX, Patch.ResolutionY));
+	}
+	
+	UE_LOG(LogGPUTessellation, Verbose, TEXT("GPUTessellation: Batched Patch Generation - Total:%d Generated:%d SkippedCulled:%d SkippedInvalidLOD:%d Verts:%d Indices:%d"),
+		OutPatchBuffers.PatchInfo.Num(), Descriptors.Num(), SkippedCulled, SkippedInvalidLOD, TotalVertexCount, TotalIndexCount);
+	
+	BuildStats.GeneratedPatches += Descriptors.Num();
+	BuildStats.CulledPatches += SkippedCulled;
+	GPUTESSELLATION_INC_COUNTER(STAT_GPUTessellation_PatchesGenerated, PatchesGenerated, Descriptors.Num());
+	
+	if (Descriptors.Num() == 0)
+	{
+		OutPatchBuffers.SharedBuffers.Reset();
+		return;
+	}
+	
+	FRDGBufferRef DescriptorBuffer = CreateStructuredBuffer(GraphBuilder, TEXT("GPUTessellation.PatchDescriptors"), Descriptors);
+	
+	FGPUTessellationPatchBatch Batch;
+	Batch.PatchDescriptors = GraphBuilder.CreateSRV(DescriptorBuffer);
+	Batch.PatchCount = Descriptors.Num();
+	Batch.TotalVertexCount = TotalVertexCount;
+	Batch.TotalIndexCount = TotalIndexCount;
+	
+	FRDGBufferRef VertexBuffer = nullptr;
+	FRDGBufferRef NormalBuffer = nullptr;
+	FRDGBufferRef UVBuffer = nullptr;
+	FRDGBufferRef IndexBuffer = nullptr;
+	
+	// One dispatch per stage, sized for the largest patch; group z selects the patch
+	DispatchVertexGeneration(GraphBuilder, Settings, MaxResolution, LocalToWorld, FVector::ZeroVector, VertexBuffer, NormalBuffer, UVBuffer, &Batch);
+	DispatchDisplacement(GraphBuilder, Settings, MaxResolution, DisplacementTexture, SubtractTexture, VertexBuffer, NormalBuffer, UVBuffer, &Batch);
+	if (Settings.NormalCalculationMethod != EGPUTessellationNormalMethod::Disabled)
+	{
+		DispatchNormalCalculation(GraphBuilder, Settings, MaxResolution, DisplacementTexture, SubtractTexture, NormalMapTexture, VertexBuffer, NormalBuffer, UVBuffer, &Batch);
+	}
+	
+	if (!bIndirect)
+	{
+		DispatchIndexGeneration(GraphBuilder, MaxResolution, FIntVector4(1, 1, 1, 1), IndexBuffer, &Batch);
+	}
+	else
+	{
+		// One plain grid per LOD level, batched the same way as the patches
+		FGPUTessellationPatchBatch LODBatch;
+		LODBatch.PatchDescriptors = GraphBuilder.CreateSRV(
+			CreateStructuredBuffer(GraphBuilder, TEXT("GPUTessellation.LODDescriptors"), LODDescriptors));
+		LODBatch.PatchCount = LODDescriptors.Num();
+		LODBatch.TotalIndexCount = LODIndexCount;
+		DispatchIndexGeneration(GraphBuilder, LODResolutions[0], FIntVector4(1, 1, 1, 1), IndexBuffer, &LODBatch);
+		TotalIndexCount = LODIndexCount;
+		
+		// Cull on the GPU and write one indexed indirect draw per LOD level
+		const int32 PatchListCapacity = Descriptors.Num();
+		FRDGBufferRef IndirectArgsBuffer = GraphBuilder.CreateBuffer(
+			FRDGBufferDesc::CreateIndirectDesc<FRHIDrawIndexedIndirectParameters>(LODResolutions.Num()),
+			TEXT("GPUTessellation.PatchIndirectArgs"));
+		FRDGBufferRef VisiblePatchListBuffer = GraphBuilder.CreateBuffer(
+			FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), LODResolutions.Num() * PatchListCapacity),
+			TEXT("GPUTessellation.VisiblePatchList"));
+		
+		// Every patch is listed here, for shadow passes and views the scene proxy did not cull for; the views
+		// themselves are culled every frame against their own frustum (FGPUTessellationSceneProxy::CullIndirectPatches_RenderThread)
+		FRDGBufferRef CullDataBuffer = CreateStructuredBuffer(GraphBuilder, TEXT("GPUTessellation.PatchCullData"), CullData);
+		AddBuildIndirectArgsPass(
+			GraphBuilder,
+			GraphBuilder.CreateSRV(CullDataBuffer),
+			CullData.Num(),
+			LODIndexRanges,
+			{},
+			PatchListCapacity,
+			IndirectArgsBuffer,
+			VisiblePatchListBuffer);
+		BuildStats.CullingPasses++;
+		
+		// Keep the draw inputs alive for the scene proxy
+		TRefCountPtr<FRDGPooledBuffer> PooledIndirectArgs = GraphBuilder.ConvertToExternalBuffer(IndirectArgsBuffer);
+		TRefCountPtr<FRDGPooledBuffer> PooledVisiblePatchList = GraphBuilder.ConvertToExternalBuffer(VisiblePatchListBuffer);
+		TRefCountPtr<FRDGPooledBuffer> PooledDescriptors = GraphBuilder.ConvertToExternalBuffer(DescriptorBuffer);
+		TRefCountPtr<FRDGPooledBuffer> PooledCullData = GraphBuilder.ConvertToExternalBuffer(CullDataBuffer);
+		FGPUTessellationIndirectDrawBuffers* OutIndirectDraw = &OutPatchBuffers.IndirectDraw;
+		const int32 NumLODs = LODResolutions.Num();
+		const int32 NumPatches = CullData.Num();
+		TArray<FUintVector4> IndexRanges(LODIndexRanges);
+		
+		GraphBuilder.AddPass(
+			RDG_EVENT_NAME("GPUTessellation.CreateIndirectDrawSRVs"),
+			ERDGPassFlags::None,
+			[PooledIndirectArgs, PooledVisiblePatchList, PooledDescriptors, PooledCullData, OutIndirectDraw, NumLODs, NumPatches,
+				IndexRanges = MoveTemp(IndexRanges), PatchListCapacity](FRHICommandListImmediate& RHICmdList)
+			{
+				OutIndirectDraw->IndirectArgsBuffer = PooledIndirectArgs->GetRHI();
+				
+				OutIndirectDraw->VisiblePatchListBuffer = PooledVisiblePatchList->GetRHI();
+				OutIndirectDraw->VisiblePatchListSRV = RHICmdList.CreateShaderResourceView(
+					OutIndirectDraw->VisiblePatchListBuffer,
+					FRHIViewDesc::CreateBufferSRV()
+						.SetType(FRHIViewDesc::EBufferType::Structured)
+				);
+				
+				OutIndirectDraw->PatchDescriptorBuffer = PooledDescriptors->GetRHI();
+				OutIndirectDraw->PatchDescriptorSRV = RHICmdList.CreateShaderResourceView(
+					OutIndirectDraw->PatchDescriptorBuffer,
+					FRHIViewDesc::CreateBufferSRV()
+						.SetType(FRHIViewDesc::EBufferType::Structured)
+				);
+				
+				OutIndirectDraw->PatchCullDataBuffer = PooledCullData;
+				OutIndirectDraw->LODIndexRanges = IndexRanges;
+				OutIndirectDraw->NumPatches = NumPatches;
+				
+				OutIndirectDraw->NumLODs = NumLODs;
+				OutIndirectDraw->PatchListCapacity = PatchListCapacity;
+			});
+		BuildStats.OtherPasses++;
+	}
+	
+	OutPatchBuffers.SharedBuffers.VertexCount = TotalVertexCount;
+	OutPatchBuffers.SharedBuffers.IndexCount = TotalIndexCount;
+	BuildStats.VertexCount += TotalVertexCount;
+	BuildStats.IndexCount += TotalIndexCount;
+	OutPatchBuffers.SharedBuffers.ResolutionX = MaxResolution.X;
+	OutPatchBuffers.SharedBuffers.ResolutionY = MaxResolution.Y;
+	
+	ConvertToPersistentBuffers(GraphBuilder, VertexBuffer, NormalBuffer, UVBuffer, IndexBuffer, OutPatchBuffers.SharedBuffers);
+}
+
+void FGPUTessellationMeshBuilder::AddBuildIndirectArgsPass(
+	FRDGBuilder& GraphBuilder,
+	FRDGBufferSRVRef PatchCullData,
+	int32 NumPatches,
+	TConstArrayView<FUintVector4> LODIndexRanges,
+	TConstArrayView<FPlane> FrustumPlanes,
+	int32 PatchListCapacity,
+	FRDGBufferRef OutIndirectArgs,
+	FRDGBufferRef OutVisiblePatchList)
+{
+	check(LODIndexRanges.Num() > 0 && LODIndexRanges.Num() <= FGPUPatchIndirectArgsCS::MaxLODLevels);
+	
+	// Instance counts are accumulated with atomics
+	FRDGBufferUAVRef IndirectArgsUAV = GraphBuilder.CreateUAV(FRDGBufferUAVDesc(OutIndirectArgs, PF_R32_UINT));
+	AddClearUAVPass(GraphBuilder, IndirectArgsUAV, 0u);
+	
+	FGPUPatchIndirectArgsCS::FParameters* PassParameters = GraphBuilder.AllocParameters<FGPUPatchIndirectArgsCS::FParameters>();
+	PassParameters->NumPatches = NumPatches;
+	PassParameters->NumLODs = LODIndexRanges.Num();
+	PassParameters->PatchListCapacity = PatchListCapacity;
+	// Dropping planes past the limit only culls less
+	PassParameters->NumFrustumPlanes = FMath::Min(FrustumPlanes.Num(), FGPUPatchIndirectArgsCS::MaxFrustumPlanes);
+	for (int32 LODIndex = 0; LODIndex < LODIndexRanges.Num(); ++LODIndex)
+	{
+		PassParameters->LODIndexRanges[LODIndex] = LODIndexRanges[LODIndex];
+	}
+	for (uint32 PlaneIndex = 0; PlaneIndex < PassParameters->NumFrustumPlanes; ++PlaneIndex)
+	{
+		const FPlane& Plane = FrustumPlanes[PlaneIndex];
+		PassParameters->FrustumPlanes[PlaneIndex] = FVector4f(Plane.X, Plane.Y, Plane.Z, Plane.W);
+	}
+	PassParameters->PatchCullData = PatchCullData;
+	PassParameters->OutIndirectArgs = IndirectArgsUAV;
+	PassParameters->OutVisiblePatchList = GraphBuilder.CreateUAV(OutVisiblePatchList);
+	
+	TShaderMapRef<FGPUPatchIndirectArgsCS> ComputeShader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
+	
+	// At least one group so the LOD levels' static arguments are always written
+	FIntVector GroupCount(
+		FMath::DivideAndRoundUp(FMath::Max(NumPatches, LODIndexRanges.Num()), FGPUPatchIndirectArgsCS::ThreadGroupSize),
+		1,
+		1);
+	
+	GraphBuilder.AddPass(
+		RDG_EVENT_NAME("GPUTessellation.BuildPatchIndirectArgs"),
+		PassParameters,
+		ERDGPassFlags::Compute,
+		[PassParameters, ComputeShader, GroupCount](FRHIComputeCommandList& RHICmdList)
+		{
+			FComputeShaderUtils::Dispatch(RHICmdList, ComputeShader, *PassParameters, GroupCount);
+		});
 }
 
 void FGPUTessellationMeshBuilder::GenerateSinglePatch(
@@ -710,7 +1361,7 @@ void FGPUTessellationMeshBuilder::GenerateSinglePatch(
 	const int32 TessellationLevel = PatchInfo.TessellationLevel;
 	if (TessellationLevel <= 0)
 	{
-		UE_LOG(LogTemp, Error, TEXT("GPUTessellation: GenerateSinglePatch - Invalid TessellationLevel=%d (must be > 0)"), 
+		UE_LOG(LogGPUTessellation, Error, TEXT("GPUTessellation: GenerateSinglePatch - Invalid TessellationLevel=%d (must be > 0)"), 
 			TessellationLevel);
 		OutPatchBuffers.Reset();
 		return;
@@ -724,7 +1375,7 @@ void FGPUTessellationMeshBuilder::GenerateSinglePatch(
 	// Validation checks
 	if (Resolution.X < 2 || Resolution.Y < 2)
 	{
-		UE_LOG(LogTemp, Error, TEXT("GPUTessellation: GenerateSinglePatch - Invalid resolution %dx%d (must be at least 2x2)"), 
+		UE_LOG(LogGPUTessellation, Error, TEXT("GPUTessellation: GenerateSinglePatch - Invalid resolution %dx%d (must be at least 2x2)"), 
 			Resolution.X, Resolution.Y);
 		OutPatchBuffers.Reset();
 		return;
@@ -732,7 +1383,7 @@ void FGPUTessellationMeshBuilder::GenerateSinglePatch(
 	
 	if (VertexCount <= 0 || IndexCount <= 0)
 	{
-		UE_LOG(LogTemp, Error, TEXT("GPUTessellation: GenerateSinglePatch - Invalid counts: Verts=%d Indices=%d"), 
+		UE_LOG(LogGPUTessellation, Error, TEXT("GPUTessellation: GenerateSinglePatch - Invalid counts: Verts=%d Indices=%d"), 
 			VertexCount, IndexCount);
 		OutPatchBuffers.Reset();
 		return;
@@ -744,20 +1395,14 @@ void FGPUTessellationMeshBuilder::GenerateSinglePatch(
 	    PatchInfo.PatchSize.X <= 0.0f || PatchInfo.PatchSize.Y <= 0.0f ||
 	    PatchInfo.PatchSize.X > 1.0f || PatchInfo.PatchSize.Y > 1.0f)
 	{
-		UE_LOG(LogTemp, Error, TEXT("GPUTessellation: GenerateSinglePatch - Invalid UV parameters: Offset=(%.3f,%.3f) Size=(%.3f,%.3f)"),
+		UE_LOG(LogGPUTessellation, Error, TEXT("GPUTessellation: GenerateSinglePatch - Invalid UV parameters: Offset=(%.3f,%.3f) Size=(%.3f,%.3f)"),
 			PatchInfo.PatchOffset.X, PatchInfo.PatchOffset.Y, PatchInfo.PatchSize.X, PatchInfo.PatchSize.Y);
 		OutPatchBuffers.Reset();
 		return;
 	}
 	
-	// Debug: Log resolution calculation for first few patches
-	static int32 DebugResCount = 0;
-	if (DebugResCount < 3)
-	{
-		DebugResCount++;
-		UE_LOG(LogTemp, Warning, TEXT("    GeneratePatch: TessLevel=%d -> Resolution=%dx%d (%d verts, %d indices)"),
-			TessellationLevel, Resolution.X, Resolution.Y, VertexCount, IndexCount);
-	}
+	UE_LOG(LogGPUTessellation, VeryVerbose, TEXT("    GeneratePatch: TessLevel=%d -> Resolution=%dx%d (%d verts, %d indices)"),
+		TessellationLevel, Resolution.X, Resolution.Y, VertexCount, IndexCount);
 	
 	// Create RDG buffers for this patch
 	FRDGBufferRef VertexBuffer = nullptr;
@@ -796,15 +1441,8 @@ void FGPUTessellationMeshBuilder::GenerateSinglePatch(
 	
 	FVector PatchTranslation(LocalCenterX, LocalCenterY, 0.0f);
 	
-	// Debug: Log patch transform for first few patches
-	static int32 DebugPatchCount = 0;
-	if (DebugPatchCount < 4)
-	{
-		DebugPatchCount++;
-		FVector WorldCenter = LocalToWorld.TransformPosition(PatchTranslation);
-		UE_LOG(LogTemp, Warning, TEXT("  Patch Transform: PatchLocalSize=(%.1f,%.1f) LocalOffset=%s WorldCenter=%s"),
-			PatchLocalSizeX, PatchLocalSizeY, *PatchTranslation.ToString(), *WorldCenter.ToString());
-	}
+	UE_LOG(LogGPUTessellation, VeryVerbose, TEXT("  Patch Transform: PatchLocalSize=(%.1f,%.1f) LocalOffset=%s WorldCenter=%s"),
+		PatchLocalSizeX, PatchLocalSizeY, *PatchTranslation.ToString(), *LocalToWorld.TransformPosition(PatchTranslation).ToString());
 	
 	// CRITICAL: Create patch-specific settings BUT keep GLOBAL plane size!
 	// This ensures displacement intensity is consistent across all patches
@@ -842,53 +1480,7 @@ void FGPUTessellationMeshBuilder::GenerateSinglePatch(
 	OutPatchBuffers.ResolutionX = Resolution.X;
 	OutPatchBuffers.ResolutionY = Resolution.Y;
 	
-	// Convert RDG buffers to external pooled buffers
-	TRefCountPtr<FRDGPooledBuffer> PooledPositionBuffer = GraphBuilder.ConvertToExternalBuffer(VertexBuffer);
-	TRefCountPtr<FRDGPooledBuffer> PooledNormalBuffer = GraphBuilder.ConvertToExternalBuffer(NormalBuffer);
-	TRefCountPtr<FRDGPooledBuffer> PooledUVBuffer = GraphBuilder.ConvertToExternalBuffer(UVBuffer);
-	TRefCountPtr<FRDGPooledBuffer> PooledIndexBuffer = GraphBuilder.ConvertToExternalBuffer(IndexBuffer);
-	
-	// Create SRVs in RDG pass (after graph execution)
-	GraphBuilder.AddPass(
-		RDG_EVENT_NAME("CreatePatchBufferSRVs"),
-		ERDGPassFlags::None,
-		[&OutPatchBuffers, PooledPositionBuffer, PooledNormalBuffer, PooledUVBuffer, PooledIndexBuffer](FRHICommandList& RHICmdList)
-		{
-			// Extract RHI references
-			OutPatchBuffers.PositionBuffer = PooledPositionBuffer->GetRHI();
-			OutPatchBuffers.NormalBuffer = PooledNormalBuffer->GetRHI();
-			OutPatchBuffers.UVBuffer = PooledUVBuffer->GetRHI();
-			OutPatchBuffers.IndexBufferRHI = PooledIndexBuffer->GetRHI();
-			
-			// Create SRVs
-			OutPatchBuffers.PositionSRV = RHICmdList.CreateShaderResourceView(
-				OutPatchBuffers.PositionBuffer,
-				FRHIViewDesc::CreateBufferSRV()
-					.SetType(FRHIViewDesc::EBufferType::Structured)
-			);
-			
-			OutPatchBuffers.NormalSRV = RHICmdList.CreateShaderResourceView(
-				OutPatchBuffers.NormalBuffer,
-				FRHIViewDesc::CreateBufferSRV()
-					.SetType(FRHIViewDesc::EBufferType::Structured)
-			);
-			
-			OutPatchBuffers.UVSRV = RHICmdList.CreateShaderResourceView(
-				OutPatchBuffers.UVBuffer,
-				FRHIViewDesc::CreateBufferSRV()
-					.SetType(FRHIViewDesc::EBufferType::Structured)
-			);
-			
-			// Setup index buffer wrapper
-			OutPatchBuffers.IndexBuffer.IndexBufferRHI = OutPatchBuffers.IndexBufferRHI;
-			
-			// Initialize the index buffer as a render resource if not already initialized
-			if (!OutPatchBuffers.IndexBuffer.IsInitialized())
-			{
-				OutPatchBuffers.IndexBuffer.InitResource(RHICmdList);
-			}
-		}
-	);
+	ConvertToPersistentBuffers(GraphBuilder, VertexBuffer, NormalBuffer, UVBuffer, IndexBuffer, OutPatchBuffers);
 }
 
 void FGPUTessellationMeshBuilder::CalculatePatchInfo(
@@ -900,9 +1492,22 @@ void FGPUTessellationMeshBuilder::CalculatePatchInfo(
 	int32 PatchCountY,
 	TArray<FGPUTessellationPatchInfo>& OutPatchInfo) const
 {
+	GPUTESSELLATION_SCOPE_CYCLE_COUNTER(STAT_GPUTessellation_PatchInfo, PatchInfo);
+	
 	int32 TotalPatches = PatchCountX * PatchCountY;
 	OutPatchInfo.SetNum(TotalPatches);
 	
+	if (UE_LOG_ACTIVE(LogGPUTessellation, Verbose))
+	{
+		UE_LOG(LogGPUTessellation, Verbose, TEXT("Patch LOD Config: %d levels, %d distances"), 
+			Settings.PatchLevels.Num(), Settings.PatchDistances.Num());
+		for (int32 i = 0; i < FMath::Min(Settings.PatchLevels.Num(), Settings.PatchDistances.Num()); ++i)
+		{
+			UE_LOG(LogGPUTessellation, Verbose, TEXT("  LOD[%d]: Distance <= %.1f uses Level %d (Tess=%d)"), 
+				i, Settings.PatchDistances[i], static_cast<int32>(Settings.PatchLevels[i]), ConvertPatchLevelToTessellation(Settings.PatchLevels[i]));
+		}
+	}
+	
 	// Full plane size in LOCAL space (before transform)
 	float PlaneSizeX = Settings.PlaneSizeX;
 	float PlaneSizeY = Settings.PlaneSizeY;
@@ -943,12 +1548,8 @@ void FGPUTessellationMeshBuilder::CalculatePatchInfo(
 			FVector LocalCenter(LocalCenterX, LocalCenterY, LocalCenterZ);
 			Patch.WorldCenter = LocalToWorld.TransformPosition(LocalCenter);
 			
-			// Debug: Log first few patch calculations
-			if (PatchIndex < 4)
-			{
-				UE_LOG(LogTemp, Warning, TEXT("  CalcPatchInfo[%d]: LocalMin=(%.1f, %.1f) LocalCenter=(%.1f, %.1f) WorldCenter=%s"),
-					PatchIndex, LocalMinX, LocalMinY, LocalCenterX, LocalCenterY, *Patch.WorldCenter.ToString());
-			}
+			UE_LOG(LogGPUTessellation, VeryVerbose, TEXT("  CalcPatchInfo[%d]: LocalMin=(%.1f, %.1f) LocalCenter=(%.1f, %.1f) WorldCenter=%s"),
+				PatchIndex, LocalMinX, LocalMinY, LocalCenterX, LocalCenterY, *Patch.WorldCenter.ToString());
 			
 			// Calculate world space bounds - need to transform all 8 corners to handle rotation/scale
 			// HalfExtent on XY plane with Z for displacement
@@ -985,23 +1586,18 @@ void FGPUTessellationMeshBuilder::CalculatePatchInfo(
 			Patch.ResolutionX = PatchResolution.X;
 			Patch.ResolutionY = PatchResolution.Y;
 			
-			// Debug: Log ALL patches if first one has issues, or first 8 patches
-			// Also log camera and patch positions to verify distance calculation
-			if (PatchIndex < 8 || (PatchIndex == 0 && Patch.TessellationLevel <= 0))
-			{
-				UE_LOG(LogTemp, Warning, TEXT("    Patch[%d]: PatchCenter=%s CameraPos=%s Distance=%.1f -> LOD:%d (Tess=%d)"), 
-					PatchIndex, 
-					*Patch.WorldCenter.ToString(), 
-					*CameraPosition.ToString(),
-					Distance, 
-					Patch.TessellationLevel, 
-					Patch.TessellationLevel);
-			}
+			// Camera and patch positions, to verify the distance calculation
+			UE_LOG(LogGPUTessellation, VeryVerbose, TEXT("    Patch[%d]: PatchCenter=%s CameraPos=%s Distance=%.1f -> Tess=%d"), 
+				PatchIndex, 
+				*Patch.WorldCenter.ToString(), 
+				*CameraPosition.ToString(),
+				Distance, 
+				Patch.TessellationLevel);
 			
 			// CRITICAL ERROR CHECK: If we got an invalid tessellation level, something is very wrong
 			if (Patch.TessellationLevel <= 0)
 			{
-				UE_LOG(LogTemp, Error, TEXT("    Patch[%d]: INVALID TessellationLevel=%d! Distance=%.1f CameraPos=%s PatchCenter=%s"), 
+				UE_LOG(LogGPUTessellation, Error, TEXT("    Patch[%d]: INVALID TessellationLevel=%d! Distance=%.1f CameraPos=%s PatchCenter=%s"), 
 					PatchIndex, Patch.TessellationLevel, Distance, 
 					*CameraPosition.ToString(), *Patch.WorldCenter.ToString());
 			}
@@ -1012,7 +1608,7 @@ void FGPUTessellationMeshBuilder::CalculatePatchInfo(
 				Patch.bVisible = ViewFrustum->IntersectBox(Patch.WorldCenter, Patch.WorldBounds.GetExtent());
 				if (!Patch.bVisible)
 				{
-					UE_LOG(LogTemp, Warning, TEXT("    Patch[%d] CULLED by frustum: Center=%s Extent=%s"), 
+					UE_LOG(LogGPUTessellation, VeryVerbose, TEXT("    Patch[%d] CULLED by frustum: Center=%s Extent=%s"), 
 						PatchIndex, *Patch.WorldCenter.ToString(), *Patch.WorldBounds.GetExtent().ToString());
 				}
 			}
@@ -1096,25 +1692,11 @@ int32 FGPUTessellationMeshBuilder::CalculatePatchTessellationLevel(
 	// PatchLevels/PatchDistances are for DistanceBasedPatches mode (per-patch LOD)
 	if (Settings.PatchLevels.Num() == 0)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("CalculatePatchTessellationLevel: No PatchLevels config, using default 16"));
+		UE_LOG(LogGPUTessellation, Verbose, TEXT("CalculatePatchTessellationLevel: No PatchLevels config, using default 16"));
 		return 16; // Default
 	}
 	
-	// Debug: Log LOD config (only once)
-	static bool bLoggedConfig = false;
-	if (!bLoggedConfig)
-	{
-		bLoggedConfig = true;
-	UE_LOG(LogTemp, Warning, TEXT("Patch LOD Config: %d levels, %d distances"), 
-		Settings.PatchLevels.Num(), Settings.PatchDistances.Num());
-	for (int32 i = 0; i < FMath::Min(Settings.PatchLevels.Num(), Settings.PatchDistances.Num()); ++i)
-	{
-		const int32 LevelInt = static_cast<int32>(Settings.PatchLevels[i]);
-		const int32 TessInt = ConvertPatchLevelToTessellation(Settings.PatchLevels[i]);
-		UE_LOG(LogTemp, Warning, TEXT("  LOD[%d]: Distance <= %.1f uses Level %d (Tess=%d)"), 
-			i, Settings.PatchDistances[i], LevelInt, TessInt);
-	}
-}	// CORRECT LOGIC: Find which distance bracket we fall into
+	// CORRECT LOGIC: Find which distance bracket we fall into
 	// PatchDistances should be ordered from smallest to largest
 	// PatchLevels should be ordered from highest quality to lowest
 	//
@@ -0,0 +1,252 @@
+// Licensed under the MIT License. See LICENSE file in the project root.
+
+#include "GPUTessellationMeshCache.h"
+#include "GPUTessellationStats.h"
+#include "GPUTessellationLog.h"
+#include "Engine/Texture.h"
+#include "Engine/TextureRenderTarget.h"
+#include "RenderingThread.h"
+#include "HAL/IConsoleManager.h"
+
+#include <atomic>
+
+static TAutoConsoleVariable<int32> CVarGPUTessellationMeshCache(
+	TEXT("r.GPUTessellation.MeshCache"),
+	1,
+	TEXT("Share generated single meshes between components with the same settings and textures.\n")
+	TEXT(" 0: every component generates and holds its own buffers\n")
+	TEXT(" 1: identical components share one set of buffers (default)"),
+	ECVF_RenderThreadSafe);
+
+namespace GPUTessellationMeshCache
+{
+	/** Bytes held by more than one proxy, counted once per extra user; read by the memory report */
+	static std::atomic<uint64> SharedBytes(0);
+
+	/** RHI texture the pipeline samples for a texture, or null if it falls back to the default texture */
+	static FRHITexture* GetSampledTexture(UTexture* Texture)
+	{
+		const FTextureResource* Resource = Texture ? Texture->GetResource() : nullptr;
+		return Resource ? Resource->TextureRHI.GetReference() : nullptr;
+	}
+}
+
+bool FGPUTessellationMeshKey::operator==(const FGPUTessellationMeshKey& Other) const
+{
+	return Hash == Other.Hash
+		&& TessellationFactor == Other.TessellationFactor
+		&& PlaneSizeX == Other.PlaneSizeX
+		&& PlaneSizeY == Other.PlaneSizeY
+		&& DisplacementIntensity == Other.DisplacementIntensity
+		&& DisplacementOffset == Other.DisplacementOffset
+		&& bUseSineWaveDisplacement == Other.bUseSineWaveDisplacement
+		&& NormalCalculationMethod == Other.NormalCalculationMethod
+		&& bInvertNormals == Other.bInvertNormals
+		&& NormalSmoothingFactor == Other.NormalSmoothingFactor
+		&& UVOffset == Other.UVOffset
+		&& UVScale == Other.UVScale
+		&& DisplacementTexture == Other.DisplacementTexture
+		&& SubtractTexture == Other.SubtractTexture
+		&& NormalMapTexture == Other.NormalMapTexture;
+}
+
+FGPUTessellationCachedMesh::FGPUTessellationCachedMesh(ERHIFeatureLevel::Type FeatureLevel)
+	: InstancedVertexFactory(FeatureLevel)
+{
+}
+
+FGPUTessellationCachedMesh::~FGPUTessellationCachedMesh()
+{
+	check(IsInRenderingThread());
+
+	if (Key.IsSet())
+	{
+		FGPUTessellationMeshCache::Get().Unregister(*this);
+	}
+	InstancedVertexFactory.ReleaseResource();
+	Buffers.Reset();
+}
+
+FGPUTessellationMeshCache& FGPUTessellationMeshCache::Get()
+{
+	static FGPUTessellationMeshCache Cache;
+	return Cache;
+}
+
+bool FGPUTessellationMeshCache::MakeKey(const FGPUTessellationSettings& EffectiveSettings, UTexture* DisplacementTexture, UTexture* SubtractTexture,
+	UTexture* NormalMapTexture, FGPUTessellationMeshKey& OutKey)
+{
+	check(IsInRenderingThread());
+
+	if (CVarGPUTessellationMeshCache.GetValueOnRenderThread() == 0)
+	{
+		return false;
+	}
+
+	// Render targets change contents without changing identity
+	for (const UTexture* Texture : { DisplacementTexture, SubtractTexture, NormalMapTexture })
+	{
+		if (Texture && Texture->IsA<UTextureRenderTarget>())
+		{
+			return false;
+		}
+	}
+
+	OutKey.TessellationFactor = EffectiveSettings.TessellationFactor;
+	OutKey.PlaneSizeX = EffectiveSettings.PlaneSizeX;
+	OutKey.PlaneSizeY = EffectiveSettings.PlaneSizeY;
+	OutKey.DisplacementIntensity = EffectiveSettings.DisplacementIntensity;
+	OutKey.DisplacementOffset = EffectiveSettings.DisplacementOffset;
+	OutKey.bUseSineWaveDisplacement = EffectiveSettings.bUseSineWaveDisplacement;
+	OutKey.NormalCalculationMethod = EffectiveSettings.NormalCalculationMethod;
+	OutKey.bInvertNormals = EffectiveSettings.bInvertNormals;
+	OutKey.NormalSmoothingFactor = EffectiveSettings.NormalSmoothingFactor;
+	OutKey.UVOffset = EffectiveSettings.UVOffset;
+	OutKey.UVScale = EffectiveSettings.UVScale;
+	OutKey.DisplacementTexture = GPUTessellationMeshCache::GetSampledTexture(DisplacementTexture);
+	OutKey.SubtractTexture = GPUTessellationMeshCache::GetSampledTexture(SubtractTexture);
+	OutKey.NormalMapTexture = GPUTessellationMeshCache::GetSampledTexture(NormalMapTexture);
+
+	uint32 Hash = GetTypeHash(OutKey.TessellationFactor);
+	Hash = HashCombineFast(Hash, GetTypeHash(OutKey.PlaneSizeX));
+	Hash = HashCombineFast(Hash, GetTypeHash(OutKey.PlaneSizeY));
+	Hash = HashCombineFast(Hash, GetTypeHash(OutKey.DisplacementIntensity));
+	Hash = HashCombineFast(Hash, GetTypeHash(OutKey.DisplacementOffset));
+	Hash = HashCombineFast(Hash, GetTypeHash(OutKey.bUseSineWaveDisplacement));
+	Hash = HashCombineFast(Hash, GetTypeHash(OutKey.NormalCalculationMethod));
+	Hash = HashCombineFast(Hash, GetTypeHash(OutKey.bInvertNormals));
+	Hash = HashCombineFast(Hash, GetTypeHash(OutKey.NormalSmoothingFactor));
+	Hash = HashCombineFast(Hash, GetTypeHash(OutKey.UVOffset));
+	Hash = HashCombineFast(Hash, GetTypeHash(OutKey.UVScale));
+	Hash = HashCombineFast(Hash, PointerHash(OutKey.DisplacementTexture.GetReference()));
+	Hash = HashCombineFast(Hash, PointerHash(OutKey.SubtractTexture.GetReference()));
+	Hash = HashCombineFast(Hash, PointerHash(OutKey.NormalMapTexture.GetReference()));
+	OutKey.Hash = Hash;
+	return true;
+}
+
+TSharedPtr<FGPUTessellationCachedMesh> FGPUTessellationMeshCache::Find(const FGPUTessellationMeshKey& Key)
+{
+	check(IsInRenderingThread());
+
+	const TWeakPtr<FGPUTessellationCachedMesh>* Entry = Meshes.Find(Key);
+	TSharedPtr<FGPUTessellationCachedMesh> Mesh = Entry ? Entry->Pin() : nullptr;
+	if (Mesh.IsValid())
+	{
+		++NumHits;
+		GPUTESSELLATION_INC_COUNTER(STAT_GPUTessellation_MeshCacheHits, MeshCacheHits, 1);
+	}
+	else
+	{
+		++NumMisses;
+		GPUTESSELLATION_INC_COUNTER(STAT_GPUTessellation_MeshCacheMisses, MeshCacheMisses, 1);
+	}
+	return Mesh;
+}
+
+void FGPUTessellationMeshCache::Register(const TSharedPtr<FGPUTessellationCachedMesh>& Mesh, const FGPUTessellationMeshKey& Key)
+{
+	check(IsInRenderingThread());
+	check(!Mesh->Key.IsSet());
+
+	TWeakPtr<FGPUTessellationCachedMesh>& Entry = Meshes.FindOrAdd(Key);
+	if (!Entry.IsValid())
+	{
+		Entry = Mesh;
+		Mesh->Key = Key;
+		SET_DWORD_STAT(STAT_GPUTessellation_CachedMeshes, Meshes.Num());
+	}
+}
+
+void FGPUTessellationMeshCache::Unregister(FGPUTessellationCachedMesh& Mesh)
+{
+	check(IsInRenderingThread());
+
+	if (!Mesh.Key.IsSet())
+	{
+		return;
+	}
+
+	// The entry may already point at another mesh if this one was evicted
+	const TWeakPtr<FGPUTessellationCachedMesh>* Entry = Meshes.Find(*Mesh.Key);
+	if (Entry && (!Entry->IsValid() || Entry->Pin().Get() == &Mesh))
+	{
+		Meshes.Remove(*Mesh.Key);
+		SET_DWORD_STAT(STAT_GPUTessellation_CachedMeshes, Meshes.Num());
+	}
+	Mesh.Key.Reset();
+}
+
+void FGPUTessellationMeshCache::Evict(const FGPUTessellationMeshKey& Key)
+{
+	check(IsInRenderingThread());
+
+	if (const TWeakPtr<FGPUTessellationCachedMesh>* Entry = Meshes.Find(Key))
+	{
+		if (TSharedPtr<FGPUTessellationCachedMesh> Mesh = Entry->Pin())
+		{
+			Mesh->Key.Reset();
+		}
+		Meshes.Remove(Key);
+		SET_DWORD_STAT(STAT_GPUTessellation_CachedMeshes, Meshes.Num());
+	}
+}
+
+void FGPUTessellationMeshCache::UpdateStats()
+{
+	check(IsInRenderingThread());
+
+	uint64 Bytes = 0;
+	for (const TPair<FGPUTessellationMeshKey, TWeakPtr<FGPUTessellationCachedMesh>>& Entry : Meshes)
+	{
+		if (const TSharedPtr<FGPUTessellationCachedMesh> Mesh = Entry.Value.Pin())
+		{
+			// The pin above is not a user
+			const int32 Users = Mesh.GetSharedReferenceCount() - 1;
+			Bytes += Mesh->Buffers.GetMemory().GetTotalBytes() * (uint64)FMath::Max(Users - 1, 0);
+		}
+	}
+
+	GPUTessellationMeshCache::SharedBytes.store(Bytes, std::memory_order_relaxed);
+	SET_MEMORY_STAT(STAT_GPUTessellation_SharedMemory, Bytes);
+}
+
+uint64 FGPUTessellationMeshCache::GetSharedBytes()
+{
+	return GPUTessellationMeshCache::SharedBytes.load(std::memory_order_relaxed);
+}
+
+void FGPUTessellationMeshCache::LogReport() const
+{
+	check(IsInRenderingThread());
+
+	const double BytesToKB = 1.0 / 1024.0;
+	const uint64 NumLookups = NumHits + NumMisses;
+	UE_LOG(LogGPUTessellation, Log, TEXT("GPUTessellation.MeshCacheReport: %d meshes, %llu hits, %llu misses (%.1f%% hit rate), %.1f KB shared"),
+		Meshes.Num(), NumHits, NumMisses, NumLookups > 0 ? 100.0 * NumHits / NumLookups : 0.0, GetSharedBytes() * BytesToKB);
+	UE_LOG(LogGPUTessellation, Log, TEXT("  %6s %10s %8s  Key"), TEXT("Users"), TEXT("KB"), TEXT("Factor"));
+	for (const TPair<FGPUTessellationMeshKey, TWeakPtr<FGPUTessellationCachedMesh>>& Entry : Meshes)
+	{
+		if (const TSharedPtr<FGPUTessellationCachedMesh> Mesh = Entry.Value.Pin())
+		{
+			UE_LOG(LogGPUTessellation, Log, TEXT("  %6d %10.1f %8d  %08x"),
+				Mesh.GetSharedReferenceCount() - 1, Mesh->Buffers.GetMemory().GetTotalBytes() * BytesToKB, Entry.Key.TessellationFactor, Entry.Key.Hash);
+		}
+	}
+}
+
+/**
+ * Log the mesh cache from the render thread, which owns it
+ */
+static void MeshCacheReportCommand()
+{
+	ENQUEUE_RENDER_COMMAND(GPUTessellationMeshCacheReport)([](FRHICommandListImmediate&)
+	{
+		FGPUTessellationMeshCache::Get().LogReport();
+	});
+}
+
+static FAutoConsoleCommand GMeshCacheReportCommand(
+	TEXT("GPUTessellation.MeshCacheReport"),
+	TEXT("Log every shared tessellation mesh with its users and size, and the cache hit rate"),
+	FConsoleCommandDelegate::CreateStatic(&MeshCacheReportCommand));
@@ -0,0 +1,475 @@
+// Licensed under the MIT License. See LICENSE file in the project root.
+
+#include "GPUTessellationMeshBuilder.h"
+#include "GPUTessellationCPUBackend.h"
+#include "GPUTessellationComputeShaders.h"
+#include "GPUTessellationStats.h"
+#include "GPUTessellationLog.h"
+#include "Async/Async.h"
+#include "Containers/Ticker.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/App.h"
+#include "RenderGraphBuilder.h"
+#include "RenderGraphUtils.h"
+#include "ShaderParameterStruct.h"
+#include "RenderingThread.h"
+#include "RHIGPUReadback.h"
+
+#include <atomic>
+
+static TAutoConsoleVariable<int32> CVarGPUTessellationInterleavedReadback(
+	TEXT("r.GPUTessellation.InterleavedReadback"),
+	1,
+	TEXT("Pack positions, normals and UVs into one staging buffer for mesh readback (one copy and one lock).\n")
+	TEXT(" 0: copy each attribute separately\n")
+	TEXT(" 1: interleave (default)"),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<int32> CVarGPUTessellationReadbackPoolSize(
+	TEXT("r.GPUTessellation.ReadbackPoolSize"),
+	8,
+	TEXT("Number of idle mesh readback staging buffers kept for reuse."),
+	ECVF_RenderThreadSafe);
+
+/** Bytes per interleaved vertex: two float4 (see GPUReadbackPack.usf) */
+static constexpr uint32 PackedVertexStride = sizeof(FVector4f) * 2;
+
+/**
+ * Idle staging buffers shared by all mesh readbacks (render thread only)
+ * Reused buffers keep their staging allocation, so steady-state extraction allocates nothing
+ */
+class FGPUTessellationReadbackPool : public FRenderResource
+{
+public:
+	FRHIGPUBufferReadback* Acquire()
+	{
+		check(IsInRenderingThread());
+		INC_DWORD_STAT(STAT_GPUTessellation_ReadbacksInFlight);
+		
+		if (FreeReadbacks.Num() > 0)
+		{
+			DEC_DWORD_STAT(STAT_GPUTessellation_PooledReadbacks);
+			return FreeReadbacks.Pop(EAllowShrinking::No);
+		}
+		return new FRHIGPUBufferReadback(TEXT("GPUTessellation.MeshReadback"));
+	}
+
+	void Release(FRHIGPUBufferReadback* Readback)
+	{
+		check(IsInRenderingThread());
+		DEC_DWORD_STAT(STAT_GPUTessellation_ReadbacksInFlight);
+		
+		if (FreeReadbacks.Num() < CVarGPUTessellationReadbackPoolSize.GetValueOnRenderThread())
+		{
+			INC_DWORD_STAT(STAT_GPUTessellation_PooledReadbacks);
+			FreeReadbacks.Add(Readback);
+		}
+		else
+		{
+			delete Readback;
+		}
+	}
+
+	//~ Begin FRenderResource Interface
+	virtual void ReleaseRHI() override
+	{
+		for (FRHIGPUBufferReadback* Readback : FreeReadbacks)
+		{
+			delete Readback;
+		}
+		FreeReadbacks.Empty();
+		SET_DWORD_STAT(STAT_GPUTessellation_PooledReadbacks, 0);
+	}
+	//~ End FRenderResource Interface
+
+private:
+	TArray<FRHIGPUBufferReadback*> FreeReadbacks;
+};
+
+static TGlobalResource<FGPUTessellationReadbackPool> GGPUTessellationReadbackPool;
+
+FGPUTessellationMeshReadback::FGPUTessellationMeshReadback()
+{
+}
+
+FGPUTessellationMeshReadback::~FGPUTessellationMeshReadback()
+{
+	if (IsInRenderingThread())
+	{
+		Release();
+	}
+	else
+	{
+		// Abandoned before it was read (shutdown) - the pool is render thread only
+		delete Vertices;
+		delete Normals;
+		delete UVs;
+		delete Indices;
+	}
+}
+
+bool FGPUTessellationMeshReadback::IsReady() const
+{
+	const FRHIGPUBufferReadback* const Readbacks[] = { Vertices, Normals, UVs, Indices };
+	bool bAnyPending = false;
+	for (const FRHIGPUBufferReadback* Readback : Readbacks)
+	{
+		if (Readback)
+		{
+			if (!Readback->IsReady())
+			{
+				return false;
+			}
+			bAnyPending = true;
+		}
+	}
+	return bAnyPending;
+}
+
+uint32 FGPUTessellationMeshReadback::GetNumBytes() const
+{
+	const uint32 VertexCount = ResolutionX * ResolutionY;
+	if (Content == EGPUTessellationReadbackContent::PositionsOnly)
+	{
+		return VertexCount * sizeof(FVector3f);
+	}
+
+	const uint32 IndexCount = (ResolutionX - 1) * (ResolutionY - 1) * 6;
+	const uint32 VertexStride = bInterleaved ? PackedVertexStride : sizeof(FVector3f) * 2 + sizeof(FVector2f);
+	return VertexCount * VertexStride + IndexCount * sizeof(uint32);
+}
+
+/** Copy one staging buffer into an array already sized for it */
+template<typename ElementType>
+static void ReadStagingBuffer(FRHIGPUBufferReadback* Readback, TArray<ElementType>& OutData)
+{
+	const uint32 NumBytes = OutData.Num() * sizeof(ElementType);
+	if (const void* Data = Readback->Lock(NumBytes))
+	{
+		FMemory::Memcpy(OutData.GetData(), Data, NumBytes);
+		Readback->Unlock();
+	}
+}
+
+void FGPUTessellationMeshReadback::Read(FGPUTessellatedMeshData& OutMeshData)
+{
+	check(IsInRenderingThread());
+
+	const int32 VertexCount = ResolutionX * ResolutionY;
+	const int32 IndexCount = (ResolutionX - 1) * (ResolutionY - 1) * 6;
+	const bool bFull = Content == EGPUTessellationReadbackContent::Full;
+
+	OutMeshData.Reset();
+	if (Vertices && VertexCount > 0)
+	{
+		OutMeshData.Vertices.SetNumUninitialized(VertexCount);
+		OutMeshData.ResolutionX = ResolutionX;
+		OutMeshData.ResolutionY = ResolutionY;
+		if (bFull)
+		{
+			OutMeshData.Normals.SetNumUninitialized(VertexCount);
+			OutMeshData.UVs.SetNumUninitialized(VertexCount);
+			OutMeshData.Indices.SetNumUninitialized(IndexCount);
+		}
+
+		if (bInterleaved)
+		{
+			// One lock for all vertex attributes
+			if (const FVector4f* Packed = static_cast<const FVector4f*>(Vertices->Lock(VertexCount * PackedVertexStride)))
+			{
+				for (int32 VertexIndex = 0; VertexIndex < VertexCount; ++VertexIndex)
+				{
+					const FVector4f& A = Packed[VertexIndex * 2 + 0];
+					const FVector4f& B = Packed[VertexIndex * 2 + 1];
+					OutMeshData.Vertices[VertexIndex] = FVector3f(A.X, A.Y, A.Z);
+					OutMeshData.Normals[VertexIndex] = FVector3f(A.W, B.X, B.Y);
+					OutMeshData.UVs[VertexIndex] = FVector2f(B.Z, B.W);
+				}
+				Vertices->Unlock();
+			}
+		}
+		else
+		{
+			ReadStagingBuffer(Vertices, OutMeshData.Vertices);
+			if (bFull)
+			{
+				ReadStagingBuffer(Normals, OutMeshData.Normals);
+				ReadStagingBuffer(UVs, OutMeshData.UVs);
+			}
+		}
+
+		if (bFull)
+		{
+			ReadStagingBuffer(Indices, OutMeshData.Indices);
+		}
+
+		INC_DWORD_STAT_BY(STAT_GPUTessellation_ReadbackBytes, GetNumBytes());
+		SET_FLOAT_STAT(STAT_GPUTessellation_ReadbackLatency, FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - EnqueueCycles));
+	}
+
+	Release();
+}
+
+void FGPUTessellationMeshReadback::Release()
+{
+	FRHIGPUBufferReadback** const Readbacks[] = { &Vertices, &Normals, &UVs, &Indices };
+	for (FRHIGPUBufferReadback** Readback : Readbacks)
+	{
+		if (*Readback)
+		{
+			GGPUTessellationReadbackPool.Release(*Readback);
+			*Readback = nullptr;
+		}
+	}
+}
+
+void FGPUTessellationMeshBuilder::EnqueueMeshReadback(
+	FRDGBuilder& GraphBuilder,
+	FIntPoint Resolution,
+	FRDGBufferRef VertexBuffer,
+	FRDGBufferRef NormalBuffer,
+	FRDGBufferRef UVBuffer,
+	FRDGBufferRef IndexBuffer,
+	EGPUTessellationReadbackContent Content,
+	FGPUTessellationMeshReadback& OutReadback)
+{
+	// A readback still holding buffers from an earlier request gives them back first
+	OutReadback.Release();
+
+	const int32 VertexCount = Resolution.X * Resolution.Y;
+	const int32 IndexCount = (Resolution.X - 1) * (Resolution.Y - 1) * 6;
+	const bool bFull = Content == EGPUTessellationReadbackContent::Full;
+
+	OutReadback.Content = Content;
+	OutReadback.bInterleaved = bFull && CVarGPUTessellationInterleavedReadback.GetValueOnRenderThread() != 0;
+	OutReadback.ResolutionX = Resolution.X;
+	OutReadback.ResolutionY = Resolution.Y;
+	OutReadback.EnqueueCycles = FPlatformTime::Cycles64();
+	OutReadback.Vertices = GGPUTessellationReadbackPool.Acquire();
+
+	if (OutReadback.bInterleaved)
+	{
+		FRDGBufferRef PackedBuffer = GraphBuilder.CreateBuffer(
+			FRDGBufferDesc::CreateStructuredDesc(sizeof(FVector4f), VertexCount * 2),
+			TEXT("GPUTessellation.PackedReadback"));
+
+		FGPUReadbackPackCS::FParameters* PassParameters = GraphBuilder.AllocParameters<FGPUReadbackPackCS::FParameters>();
+		PassParameters->ResolutionX = Resolution.X;
+		PassParameters->ResolutionY = Resolution.Y;
+		PassParameters->InputPositions = GraphBuilder.CreateSRV(VertexBuffer);
+		PassParameters->InputNormals = GraphBuilder.CreateSRV(NormalBuffer);
+		PassParameters->InputUVs = GraphBuilder.CreateSRV(UVBuffer);
+		PassParameters->OutputPacked = GraphBuilder.CreateUAV(PackedBuffer);
+
+		TShaderMapRef<FGPUReadbackPackCS> ComputeShader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
+		FIntVector GroupCount(
+			FMath::DivideAndRoundUp(Resolution.X, 8),
+			FMath::DivideAndRoundUp(Resolution.Y, 8),
+			1);
+
+		GraphBuilder.AddPass(
+			RDG_EVENT_NAME("GPUTessellation.PackReadback"),
+			PassParameters,
+			ERDGPassFlags::Compute,
+			[PassParameters, ComputeShader, GroupCount](FRHIComputeCommandList& RHICmdList)
+			{
+				FComputeShaderUtils::Dispatch(RHICmdList, ComputeShader, *PassParameters, GroupCount);
+			});
+
+		AddEnqueueCopyPass(GraphBuilder, OutReadback.Vertices, PackedBuffer, VertexCount * PackedVertexStride);
+	}
+	else
+	{
+		AddEnqueueCopyPass(GraphBuilder, OutReadback.Vertices, VertexBuffer, sizeof(FVector3f) * VertexCount);
+		if (bFull)
+		{
+			OutReadback.Normals = GGPUTessellationReadbackPool.Acquire();
+			OutReadback.UVs = GGPUTessellationReadbackPool.Acquire();
+			AddEnqueueCopyPass(GraphBuilder, OutReadback.Normals, NormalBuffer, sizeof(FVector3f) * VertexCount);
+			AddEnqueueCopyPass(GraphBuilder, OutReadback.UVs, UVBuffer, sizeof(FVector2f) * VertexCount);
+		}
+	}
+
+	if (bFull)
+	{
+		OutReadback.Indices = GGPUTessellationReadbackPool.Acquire();
+		AddEnqueueCopyPass(GraphBuilder, OutReadback.Indices, IndexBuffer, sizeof(uint32) * IndexCount);
+	}
+}
+
+void FGPUTessellationMeshBuilder::EnqueueMeshReadback(
+	FRDGBuilder& GraphBuilder,
+	const FGPUTessellationBuffers& GPUBuffers,
+	FGPUTessellationMeshReadback& OutReadback)
+{
+	// Buffers converted earlier in this graph register as the same RDG buffers
+	EnqueueMeshReadback(GraphBuilder, FIntPoint(GPUBuffers.ResolutionX, GPUBuffers.ResolutionY),
+		GraphBuilder.RegisterExternalBuffer(GPUBuffers.PooledPositionBuffer),
+		GraphBuilder.RegisterExternalBuffer(GPUBuffers.PooledNormalBuffer),
+		GraphBuilder.RegisterExternalBuffer(GPUBuffers.PooledUVBuffer),
+		GraphBuilder.RegisterExternalBuffer(GPUBuffers.PooledIndexBuffer),
+		EGPUTessellationReadbackContent::Full, OutReadback);
+}
+
+void FGPUTessellationMeshBuilder::ExecuteTessellationPipeline(
+	FRDGBuilder& GraphBuilder,
+	const FGPUTessellationSettings& Settings,
+	const FMatrix& LocalToWorld,
+	const FVector& CameraPosition,
+	UTexture* DisplacementTexture,
+	UTexture* SubtractTexture,
+	UTexture* NormalMapTexture,
+	FGPUTessellationMeshReadback& OutReadback,
+	EGPUTessellationReadbackContent Content)
+{
+	// Calculate resolution
+	FIntPoint Resolution = CalculateResolution(Settings.TessellationFactor);
+
+	// Create RDG buffers
+	FRDGBufferRef VertexBuffer = nullptr;
+	FRDGBufferRef NormalBuffer = nullptr;
+	FRDGBufferRef UVBuffer = nullptr;
+	FRDGBufferRef IndexBuffer = nullptr;
+
+	// Steps 1-3: same passes as the other pipeline versions
+	DispatchVertexGeneration(GraphBuilder, Settings, Resolution, LocalToWorld, FVector::ZeroVector, VertexBuffer, NormalBuffer, UVBuffer);
+	DispatchDisplacement(GraphBuilder, Settings, Resolution, DisplacementTexture, SubtractTexture, VertexBuffer, NormalBuffer, UVBuffer);
+	if (Content == EGPUTessellationReadbackContent::Full)
+	{
+		if (Settings.NormalCalculationMethod != EGPUTessellationNormalMethod::Disabled)
+		{
+			DispatchNormalCalculation(GraphBuilder, Settings, Resolution, DisplacementTexture, SubtractTexture, NormalMapTexture, VertexBuffer, NormalBuffer, UVBuffer);
+		}
+
+		// Step 4: Indices are implied by the resolution for positions-only readbacks
+		DispatchIndexGeneration(GraphBuilder, Resolution, FIntVector4(1, 1, 1, 1), IndexBuffer);
+	}
+
+	// Step 5: Copy into staging buffers - nothing waits for them here
+	EnqueueMeshReadback(GraphBuilder, Resolution, VertexBuffer, NormalBuffer, UVBuffer, IndexBuffer, Content, OutReadback);
+}
+
+/**
+ * One in-flight GenerateMeshAsync request
+ * The game thread ticks it once per frame; every tick queues at most one render thread poll of the readback
+ */
+class FGPUTessellationMeshExtraction : public TSharedFromThis<FGPUTessellationMeshExtraction, ESPMode::ThreadSafe>
+{
+public:
+	FGPUTessellationMeshExtraction()
+		: bComplete(false)
+		, bPollQueued(false)
+	{
+	}
+
+	/** Game thread: returns false (stop ticking) once the promise is fulfilled */
+	bool Tick()
+	{
+		if (bComplete.load(std::memory_order_acquire))
+		{
+			Promise.SetValue(MoveTemp(MeshData));
+			return false;
+		}
+
+		if (!bPollQueued.exchange(true))
+		{
+			ENQUEUE_RENDER_COMMAND(PollGPUTessellationMeshExtraction)(
+				[Extraction = AsShared()](FRHICommandListImmediate& RHICmdList)
+				{
+					if (Extraction->Readback.IsReady())
+					{
+						Extraction->Readback.Read(Extraction->MeshData);
+						Extraction->bComplete.store(true, std::memory_order_release);
+					}
+					Extraction->bPollQueued.store(false);
+				});
+		}
+		return true;
+	}
+
+	TPromise<FGPUTessellatedMeshData> Promise;
+
+	/** Render thread until bComplete */
+	FGPUTessellationMeshReadback Readback;
+	FGPUTessellatedMeshData MeshData;
+
+	std::atomic<bool> bComplete;
+	std::atomic<bool> bPollQueued;
+};
+
+TFuture<FGPUTessellatedMeshData> FGPUTessellationMeshBuilder::GenerateMeshAsync(
+	const FGPUTessellationSettings& Settings,
+	const FMatrix& LocalToWorld,
+	UTexture* DisplacementTexture,
+	UTexture* SubtractTexture,
+	UTexture* NormalMapTexture,
+	EGPUTessellationReadbackContent Content)
+{
+	check(IsInGameThread());
+
+	TSharedRef<FGPUTessellationMeshExtraction, ESPMode::ThreadSafe> Extraction = MakeShared<FGPUTessellationMeshExtraction, ESPMode::ThreadSafe>();
+	TFuture<FGPUTessellatedMeshData> Future = Extraction->Promise.GetFuture();
+
+	if (FGPUTessellationCPUBackend::IsActive())
+	{
+		// Texture data is copied here; the pipeline itself runs on a worker thread
+		TSharedRef<FGPUTessellationCPUTextures, ESPMode::ThreadSafe> Textures = MakeShared<FGPUTessellationCPUTextures, ESPMode::ThreadSafe>();
+		if (!Textures->Build(Settings, DisplacementTexture, SubtractTexture, NormalMapTexture))
+		{
+			UE_LOG(LogGPUTessellation, Warning, TEXT("GenerateMeshAsync: textures cannot be read on the CPU, returning empty mesh data"));
+			Extraction->Promise.SetValue(FGPUTessellatedMeshData());
+			return Future;
+		}
+
+		Async(EAsyncExecution::ThreadPool, [Extraction, Textures, Settings, Content]()
+		{
+			FGPUTessellationCPUBackend::ExecuteTessellationPipeline(Settings, *Textures, Extraction->MeshData, Content);
+
+			// Fulfilled on the game thread like the GPU path, so continuations may touch UObjects
+			AsyncTask(ENamedThreads::GameThread, [Extraction]()
+			{
+				Extraction->Promise.SetValue(MoveTemp(Extraction->MeshData));
+			});
+		});
+		return Future;
+	}
+
+	ENQUEUE_RENDER_COMMAND(GenerateTessellatedMeshAsync)(
+		[Extraction, Settings, LocalToWorld, DisplacementTexture, SubtractTexture, NormalMapTexture, Content](FRHICommandListImmediate& RHICmdList)
+		{
+			FGPUTessellationMeshBuilder MeshBuilder;
+			FRDGBuilder GraphBuilder(RHICmdList);
+
+			MeshBuilder.ExecuteTessellationPipeline(GraphBuilder, Settings, LocalToWorld, FVector::ZeroVector,
+				DisplacementTexture, SubtractTexture, NormalMapTexture, Extraction->Readback, Content);
+
+			GraphBuilder.Execute();
+		});
+
+	FTSTicker::GetCoreTicker().AddTicker(
+		TEXT("GPUTessellationMeshExtraction"),
+		0.0f,
+		[Extraction](float DeltaTime)
+		{
+			return Extraction->Tick();
+		});
+
+	return Future;
+}
+
+void FGPUTessellationMeshBuilder::GenerateMeshAsync(
+	const FGPUTessellationSettings& Settings,
+	const FMatrix& LocalToWorld,
+	UTexture* DisplacementTexture,
+	UTexture* SubtractTexture,
+	UTexture* NormalMapTexture,
+	FOnGPUTessellationMeshExtracted OnComplete,
+	EGPUTessellationReadbackContent Content)
+{
+	// The promise is fulfilled on the game thread, so the continuation runs there too
+	GenerateMeshAsync(Settings, LocalToWorld, DisplacementTexture, SubtractTexture, NormalMapTexture, Content).Then(
+		[OnComplete = MoveTemp(OnComplete)](TFuture<FGPUTessellatedMeshData> Future)
+		{
+			OnComplete.ExecuteIfBound(Future.Get());
+		});
+}
@@ -0,0 +1,209 @@
+// Licensed under the MIT License. See LICENSE file in the project root.
+
+#include "GPUTessellationRegenerationSubsystem.h"
+#include "GPUTessellationSceneProxy.h"
+#include "GPUTessellationStats.h"
+#include "GPUTessellationLog.h"
+#include "SceneViewExtension.h"
+#include "RenderGraphBuilder.h"
+#include "RenderingThread.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarGPUTessellationBatchRegeneration(
+	TEXT("r.GPUTessellation.BatchRegeneration"),
+	1,
+	TEXT("Record the regenerations of every tessellation component in a world into one render graph per frame.\n")
+	TEXT(" 0: every regeneration builds and executes its own graph right away\n")
+	TEXT(" 1: batch them into one graph, executed before the world renders (default)"),
+	ECVF_RenderThreadSafe);
+
+/**
+ * Flushes the owning world's regeneration batch when one of its view families begins rendering, and culls the
+ * batch's indirect patches for each of its views
+ */
+class FGPUTessellationRegenerationViewExtension : public FWorldSceneViewExtension
+{
+public:
+	FGPUTessellationRegenerationViewExtension(const FAutoRegister& AutoRegister, UWorld* InWorld, UGPUTessellationRegenerationSubsystem* InSubsystem,
+		TSharedPtr<FGPUTessellationRegenerationBatch, ESPMode::ThreadSafe> InRegenerationBatch)
+		: FWorldSceneViewExtension(AutoRegister, InWorld)
+		, Subsystem(InSubsystem)
+		, RegenerationBatch(MoveTemp(InRegenerationBatch))
+	{
+	}
+
+	//~ Begin ISceneViewExtension Interface
+	virtual void SetupViewFamily(FSceneViewFamily& InViewFamily) override {}
+	virtual void SetupView(FSceneViewFamily& InViewFamily, FSceneView& InView) override {}
+	virtual void BeginRenderViewFamily(FSceneViewFamily& InViewFamily) override
+	{
+		// Game thread, after the world's end of frame updates were sent
+		if (UGPUTessellationRegenerationSubsystem* RegenerationSubsystem = Subsystem.Get())
+		{
+			RegenerationSubsystem->FlushRegenerations();
+		}
+	}
+	virtual void PreRenderView_RenderThread(FRDGBuilder& GraphBuilder, FSceneView& InView) override
+	{
+		// Render thread, before the view gathers mesh elements
+		RegenerationBatch->CullIndirectPatches_RenderThread(GraphBuilder, InView);
+	}
+	//~ End ISceneViewExtension Interface
+
+private:
+	TWeakObjectPtr<UGPUTessellationRegenerationSubsystem> Subsystem;
+
+	/** Render thread side of the subsystem, kept alive for views still rendering after it deinitialized */
+	TSharedPtr<FGPUTessellationRegenerationBatch, ESPMode::ThreadSafe> RegenerationBatch;
+};
+
+void FGPUTessellationRegenerationBatch::Add_RenderThread(FGPUTessellationSceneProxy* Proxy)
+{
+	check(IsInRenderingThread());
+
+	if (!Proxy->bRegenerationBatched)
+	{
+		Proxy->bRegenerationBatched = true;
+		PendingProxies.Add(Proxy);
+	}
+}
+
+void FGPUTessellationRegenerationBatch::Remove_RenderThread(FGPUTessellationSceneProxy* Proxy)
+{
+	check(IsInRenderingThread());
+
+	if (Proxy->bRegenerationBatched)
+	{
+		Proxy->bRegenerationBatched = false;
+		PendingProxies.RemoveSingle(Proxy);
+	}
+}
+
+void FGPUTessellationRegenerationBatch::Flush_RenderThread(FRHICommandListImmediate& RHICmdList)
+{
+	check(IsInRenderingThread());
+
+	if (PendingProxies.Num() == 0)
+	{
+		return;
+	}
+
+	// Proxies may queue themselves again while finishing (multi-frame patch fills); those go in the next flush
+	TArray<FGPUTessellationSceneProxy*> Proxies = MoveTemp(PendingProxies);
+	PendingProxies.Reset();
+	for (FGPUTessellationSceneProxy* Proxy : Proxies)
+	{
+		Proxy->bRegenerationBatched = false;
+	}
+
+	Execute_RenderThread(RHICmdList, Proxies);
+}
+
+void FGPUTessellationRegenerationBatch::Execute_RenderThread(FRHICommandListImmediate& RHICmdList, TConstArrayView<FGPUTessellationSceneProxy*> Proxies)
+{
+	check(IsInRenderingThread());
+
+	GPUTESSELLATION_SCOPE_CYCLE_COUNTER(STAT_GPUTessellation_RegenerationBatch, RegenerationBatch);
+
+	FRDGBuilder GraphBuilder(RHICmdList, RDG_EVENT_NAME("GPUTessellation.Regeneration (%d components)", Proxies.Num()));
+	for (FGPUTessellationSceneProxy* Proxy : Proxies)
+	{
+		RDG_EVENT_SCOPE(GraphBuilder, "%s", *Proxy->GetOwnerName().ToString());
+		Proxy->AddRegenerationPasses_RenderThread(GraphBuilder);
+	}
+	GraphBuilder.Execute();
+
+	for (FGPUTessellationSceneProxy* Proxy : Proxies)
+	{
+		Proxy->FinishRegeneration_RenderThread(RHICmdList);
+	}
+
+	GPUTESSELLATION_INC_COUNTER(STAT_GPUTessellation_RegenerationGraphs, RegenerationGraphs, 1);
+	GPUTESSELLATION_INC_COUNTER(STAT_GPUTessellation_BatchedRegenerations, BatchedRegenerations, Proxies.Num());
+
+	UE_LOG(LogGPUTessellation, VeryVerbose, TEXT("GPUTessellation: Executed one regeneration graph for %d components"), Proxies.Num());
+}
+
+void FGPUTessellationRegenerationBatch::AddIndirectPatchProxy_RenderThread(FGPUTessellationSceneProxy* Proxy)
+{
+	check(IsInRenderingThread());
+	IndirectPatchProxies.AddUnique(Proxy);
+}
+
+void FGPUTessellationRegenerationBatch::RemoveIndirectPatchProxy_RenderThread(FGPUTessellationSceneProxy* Proxy)
+{
+	check(IsInRenderingThread());
+	IndirectPatchProxies.RemoveSingleSwap(Proxy);
+}
+
+void FGPUTessellationRegenerationBatch::CullIndirectPatches_RenderThread(FRDGBuilder& GraphBuilder, const FSceneView& View)
+{
+	check(IsInRenderingThread());
+
+	for (FGPUTessellationSceneProxy* Proxy : IndirectPatchProxies)
+	{
+		Proxy->CullIndirectPatches_RenderThread(GraphBuilder, View);
+	}
+}
+
+bool FGPUTessellationRegenerationBatch::IsEnabled_RenderThread()
+{
+	return CVarGPUTessellationBatchRegeneration.GetValueOnRenderThread() != 0;
+}
+
+bool FGPUTessellationRegenerationBatch::IsEnabled_GameThread()
+{
+	return CVarGPUTessellationBatchRegeneration.GetValueOnGameThread() != 0;
+}
+
+void UGPUTessellationRegenerationSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	RegenerationBatch = MakeShared<FGPUTessellationRegenerationBatch, ESPMode::ThreadSafe>();
+	ViewExtension = FSceneViewExtensions::NewExtension<FGPUTessellationRegenerationViewExtension>(GetWorld(), this, RegenerationBatch);
+}
+
+void UGPUTessellationRegenerationSubsystem::Deinitialize()
+{
+	// Scene proxies still holding the batch keep it alive; flush what they queued
+	FlushRegenerations();
+
+	ViewExtension.Reset();
+	RegenerationBatch.Reset();
+
+	Super::Deinitialize();
+}
+
+void UGPUTessellationRegenerationSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// No view family began rendering last frame (minimized window, no viewport); flush before the queue builds up
+	if (LastFlushFrame + 1 < GFrameCounter)
+	{
+		FlushRegenerations();
+	}
+}
+
+TStatId UGPUTessellationRegenerationSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UGPUTessellationRegenerationSubsystem, STATGROUP_Tickables);
+}
+
+void UGPUTessellationRegenerationSubsystem::FlushRegenerations()
+{
+	check(IsInGameThread());
+
+	if (!RegenerationBatch.IsValid() || LastFlushFrame == GFrameCounter)
+	{
+		return;
+	}
+	LastFlushFrame = GFrameCounter;
+
+	ENQUEUE_RENDER_COMMAND(FlushGPUTessellationRegenerations)(
+		[Batch = RegenerationBatch](FRHICommandListImmediate& RHICmdList)
+		{
+			Batch->Flush_RenderThread(RHICmdList);
+		});
+}
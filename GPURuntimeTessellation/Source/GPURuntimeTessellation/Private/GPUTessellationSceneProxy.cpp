@@ -4,6 +4,11 @@
 #include "GPUTessellationComponent.h"
 #include "GPUTessellationMeshBuilder.h"
 #include "GPUTessellationVertexFactory.h"
+#include "GPUTessellationStats.h"
+#include "GPUTessellationLog.h"
+#include "GPUTessellationRegenerationSubsystem.h"
+#include "GPUTessellationMeshCache.h"
+#include "GPUTessellationDiskCache.h"
 #include "Materials/Material.h"
 #include "Materials/MaterialRenderProxy.h"
 #include "Engine/Engine.h"
@@ -15,23 +20,110 @@
 #include "RayTracingInstance.h"
 #include "DrawDebugHelpers.h"
 #include "PrimitiveUniformShaderParameters.h"
+#include "DynamicBufferAllocator.h"
+#include "RenderGraphUtils.h"
+#include "RHIGPUReadback.h"
+#include "HAL/IConsoleManager.h"
+
+FGPUTessellationProxyLayout FGPUTessellationProxyLayout::Make(const FGPUTessellationSettings& Settings, int32 LODTessellationFactor)
+{
+	FGPUTessellationProxyLayout Layout;
+	Layout.bPatchMode = Settings.LODMode == EGPUTessellationLODMode::DistanceBasedPatches;
+	if (Layout.bPatchMode)
+	{
+		Layout.PatchCount = FIntPoint(Settings.PatchCountX, Settings.PatchCountY);
+	}
+	else
+	{
+		const int32 TessellationFactor = (Settings.LODMode != EGPUTessellationLODMode::Disabled) ? LODTessellationFactor : Settings.TessellationFactor;
+		Layout.Resolution = FGPUTessellationMeshBuilder::CalculateResolution(static_cast<float>(TessellationFactor));
+	}
+	return Layout;
+}
+
+static TAutoConsoleVariable<int32> CVarGPUTessellationPatchesPerFrame(
+	TEXT("r.GPUTessellation.PatchesPerFrame"),
+	0,
+	TEXT("Most patches generated per frame while regenerating spatial patches.\n")
+	TEXT("The previous patch set keeps rendering until every patch is generated.\n")
+	TEXT("Batched patches (r.GPUTessellation.BatchedPatches) always generate in one frame.\n")
+	TEXT(" 0: generate every patch in the first frame (default)"),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<int32> CVarGPUTessellationIndirectPatchStats(
+	TEXT("r.GPUTessellation.IndirectPatchStats"),
+	0,
+	TEXT("Read back the arguments of every view's indirect patch culling and count its visible and culled patches.\n")
+	TEXT("The counts show up in 'stat GPUTessellation' a few frames late.\n")
+	TEXT(" 0: off (default)\n")
+	TEXT(" 1: on"),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<int32> CVarGPUTessellationInstancing(
+	TEXT("r.GPUTessellation.Instancing"),
+	0,
+	TEXT("Draw the still proxies sharing a cached single mesh in one instanced call per view (experimental).\n")
+	TEXT("Proxies gathered later grow a mesh batch already added by the first one, which relies on serial gathering and\n")
+	TEXT("on mesh passes being built after it. Every instance uses the first proxy's primitive data and bounds.\n")
+	TEXT(" 0: every proxy draws its own copy (default)\n")
+	TEXT(" 1: the first proxy gathered for a view also draws every compatible proxy of its mesh gathered after it"),
+	ECVF_RenderThreadSafe);
 
 FGPUTessellationSceneProxy::FGPUTessellationSceneProxy(UGPUTessellationComponent* Component)
 	: FPrimitiveSceneProxy(Component)
 	, MaterialProxy(nullptr)
-	, Settings(Component->TessellationSettings)
+	, Settings(Component->GetRenderSettings())
 	, CachedLocalToWorld(Component->GetComponentTransform().ToMatrixWithScale())
 	, CachedDisplacementTexture(Component->DisplacementTexture)
 	, CachedSubtractTexture(Component->SubtractTexture)
 	, CachedNormalMapTexture(Component->NormalMapTexture)
 	, VertexFactory(GetScene().GetFeatureLevel())
+	, FrontPatchSetIndex(0)
+	, bHasQueuedRegeneration(false)
+	, QueuedCameraPosition(FVector::ZeroVector)
+	, QueuedLocalToWorld(FMatrix::Identity)
+	, QueuedTrigger(EGPUTessellationRegenerationTrigger::ProxyRecreated)
+	, bHasQueuedMeshRegeneration(false)
+	, bQueuedFullGeneration(false)
+	, bQueuedContentChanged(false)
+	, bTextureContentsModified(false)
+	, bWaitingForDiskCache(false)
+	, bMeshGenerationRecorded(false)
+	, bPatchStepRecorded(false)
+	, bPatchStepCompletesBackSet(false)
+	, bRegenerationBatched(false)
+	, bBackSetInProgress(false)
+	, BackSetLocalToWorld(FMatrix::Identity)
+	, BackSetTrigger(EGPUTessellationRegenerationTrigger::ProxyRecreated)
+	, bPatchRegenerationPending(false)
+	, TrackedVertexCount(0)
+	, TrackedSingleMesh(nullptr)
+	, TrackedSingleMeshBytes(0)
 	, bMeshValid(false)
 	, bUsePatchMode(Settings.LODMode == EGPUTessellationLODMode::DistanceBasedPatches)
+	, Layout(FGPUTessellationProxyLayout::Make(Settings, Component->GetLODTessellationFactor()))
 	, bEnableDebugLogging(Component->bEnableDebugLogging)
 	, bShowPatchDebugVisualization(Component->bShowPatchDebugVisualization)
 	, LastLogTime(0.0)
 	, LastCameraPosition(FVector::ZeroVector)
+	, LastRenderedPatchCount(INDEX_NONE)
+	, bLoggedViewRelevance(false)
+	, TrackedLocalToWorld(FMatrix::Identity)
+	, PreviousLocalToWorld(FMatrix::Identity)
+	, LastTransformChangeFrame(0)
+	, bTransformTracked(false)
 {
+	PatchSets[0] = MakeUnique<FGPUTessellationPatchRenderSet>(GetScene().GetFeatureLevel());
+	PatchSets[1] = MakeUnique<FGPUTessellationPatchRenderSet>(GetScene().GetFeatureLevel());
+	
+	if (UWorld* World = Component->GetWorld())
+	{
+		if (UGPUTessellationRegenerationSubsystem* RegenerationSubsystem = World->GetSubsystem<UGPUTessellationRegenerationSubsystem>())
+		{
+			RegenerationBatch = RegenerationSubsystem->GetRegenerationBatch();
+		}
+	}
+	
 	// Throttled debug logging
 	if (bEnableDebugLogging)
 	{
@@ -44,13 +136,13 @@ FGPUTessellationSceneProxy::FGPUTessellationSceneProxy(UGPUTessellationComponent
 			const FBoxSphereBounds CompBounds = Component->Bounds;
 			const FBoxSphereBounds RecalcBounds = Component->CalcBounds(ComponentTransform);
 			
-			UE_LOG(LogTemp, Warning, TEXT("GPUTessellation: Scene Proxy Constructor:"));
-			UE_LOG(LogTemp, Warning, TEXT("  Component->Bounds: %s"), *CompBounds.ToString());
-			UE_LOG(LogTemp, Warning, TEXT("  CalcBounds(Transform): %s"), *RecalcBounds.ToString());
-			UE_LOG(LogTemp, Warning, TEXT("  Transform Location: %s Scale: %s"), 
+			UE_LOG(LogGPUTessellation, Log, TEXT("GPUTessellation: Scene Proxy Constructor:"));
+			UE_LOG(LogGPUTessellation, Log, TEXT("  Component->Bounds: %s"), *CompBounds.ToString());
+			UE_LOG(LogGPUTessellation, Log, TEXT("  CalcBounds(Transform): %s"), *RecalcBounds.ToString());
+			UE_LOG(LogGPUTessellation, Log, TEXT("  Transform Location: %s Scale: %s"), 
 				*ComponentTransform.GetLocation().ToString(), *ComponentTransform.GetScale3D().ToString());
 			const float TotalDisp = Settings.DisplacementIntensity + FMath::Abs(Settings.DisplacementOffset);
-			UE_LOG(LogTemp, Warning, TEXT("  Settings: PlaneSizeX:%.1f PlaneSizeY:%.1f Disp:%.1f"),
+			UE_LOG(LogGPUTessellation, Log, TEXT("  Settings: PlaneSizeX:%.1f PlaneSizeY:%.1f Disp:%.1f"),
 				Settings.PlaneSizeX, Settings.PlaneSizeY, TotalDisp);
 		}
 	}
@@ -69,29 +161,20 @@ FGPUTessellationSceneProxy::FGPUTessellationSceneProxy(UGPUTessellationComponent
 	
 	if (bEnableDebugLogging)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("GPUTessellation: Material setup - HasMaterial:%d"), MaterialProxy != nullptr);
+		UE_LOG(LogGPUTessellation, Log, TEXT("GPUTessellation: Material setup - HasMaterial:%d"), MaterialProxy != nullptr);
 	}
 
 	// Generate initial mesh data (PURE GPU - NO CPU READBACK!)
 	FGPUTessellationMeshBuilder MeshBuilder;
 	FVector CameraPosition = FVector::ZeroVector;
 
-	// Get camera position if available
-	if (UWorld* World = Component->GetWorld())
-	{
-		if (APlayerController* PC = World->GetFirstPlayerController())
-		{
-			if (PC->PlayerCameraManager)
-			{
-				CameraPosition = PC->PlayerCameraManager->GetCameraLocation();
-			}
-		}
-	}
+	// Get camera position if available (the view nearest to the component this frame)
+	const bool bFoundCamera = Component->GetLODViewLocation(CameraPosition);
 	
 	// CRITICAL: If camera position is not available, DO NOT use component location!
 	// Using component location makes patches appear sorted by distance from plane center, not camera.
 	// Better to use a reasonable default camera position (above and away from plane)
-	if (CameraPosition.IsZero() || !CameraPosition.ContainsNaN())
+	if (!bFoundCamera || CameraPosition.ContainsNaN())
 	{
 		// Use a reasonable default: above the component, looking down
 		FVector ComponentLocation = Component->GetComponentLocation();
@@ -99,13 +182,13 @@ FGPUTessellationSceneProxy::FGPUTessellationSceneProxy(UGPUTessellationComponent
 		
 		if (bEnableDebugLogging)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("GPUTessellation: Camera position unavailable, using default position above component: %s"), 
+			UE_LOG(LogGPUTessellation, Log, TEXT("GPUTessellation: Camera position unavailable, using default position above component: %s"), 
 				*CameraPosition.ToString());
 		}
 	}
 	else if (bEnableDebugLogging)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("GPUTessellation: Camera position: %s (Component at: %s)"), 
+		UE_LOG(LogGPUTessellation, Log, TEXT("GPUTessellation: Camera position: %s (Component at: %s)"), 
 			*CameraPosition.ToString(), *Component->GetComponentLocation().ToString());
 	}
 
@@ -113,16 +196,16 @@ FGPUTessellationSceneProxy::FGPUTessellationSceneProxy(UGPUTessellationComponent
 	FGPUTessellationSettings EffectiveSettings = Settings;
 	if (Settings.LODMode != EGPUTessellationLODMode::Disabled)
 	{
-		// When LOD is enabled, use LastAppliedTessFactor instead of TessellationFactor
-		EffectiveSettings.TessellationFactor = Component->LastAppliedTessFactor;
+		// When LOD is enabled, use the applied LOD factor (with the budget bias) instead of TessellationFactor
+		EffectiveSettings.TessellationFactor = Component->GetLODTessellationFactor();
 		
 		if (bEnableDebugLogging)
 		{
 			const int32 OriginalFactor = Settings.TessellationFactor;
 			const int32 MinFactor = Settings.MinTessellationFactor;
 			const int32 MaxFactor = Settings.MaxTessellationFactor;
-			UE_LOG(LogTemp, Warning, TEXT("GPUTessellation: SceneProxy using LOD-adjusted TessellationFactor: %d (Original: %d, Min: %d, Max: %d)"),
-				Component->LastAppliedTessFactor, OriginalFactor, MinFactor, MaxFactor);
+			UE_LOG(LogGPUTessellation, Log, TEXT("GPUTessellation: SceneProxy using LOD-adjusted TessellationFactor: %d (Original: %d, Min: %d, Max: %d)"),
+				EffectiveSettings.TessellationFactor, OriginalFactor, MinFactor, MaxFactor);
 		}
 	}
 	
@@ -130,115 +213,43 @@ FGPUTessellationSceneProxy::FGPUTessellationSceneProxy(UGPUTessellationComponent
 	if (bUsePatchMode)
 	{
 		// SPATIAL PATCH MODE: Generate multiple patches with per-patch LOD
+		// The first regeneration fills the back set and swaps it in once complete
 		ENQUEUE_RENDER_COMMAND(GeneratePatchedMesh)(
-			[this, EffectiveSettings, LocalToWorld = Component->GetComponentTransform().ToMatrixWithScale(), CameraPosition,
-			 DisplacementTexture = Component->DisplacementTexture, SubtractTexture = Component->SubtractTexture,
-			 NormalMapTexture = Component->NormalMapTexture,
-			 bDebugLog = this->bEnableDebugLogging]
+			[this, LocalToWorld = Component->GetComponentTransform().ToMatrixWithScale(), CameraPosition,
+			 Trigger = Component->PendingRegenerationTrigger, bDebugLog = this->bEnableDebugLogging]
 			(FRHICommandListImmediate& RHICmdList)
 			{
 				if (bDebugLog)
 				{
-					UE_LOG(LogTemp, Warning, TEXT("GPUTessellation: Starting PATCH generation on render thread - Patches:%dx%d"),
-						EffectiveSettings.PatchCountX, EffectiveSettings.PatchCountY);
-				}
-				
-				FGPUTessellationMeshBuilder MeshBuilder;
-				FRDGBuilder GraphBuilder(RHICmdList);
-				
-				// For frustum culling, we'd need the view frustum here
-				// For now, pass nullptr (culling will be disabled in first frame)
-				const FConvexVolume* ViewFrustum = nullptr;
-				
-				// Execute patch tessellation pipeline
-				MeshBuilder.ExecutePatchTessellationPipeline(
-					GraphBuilder,
-					EffectiveSettings,
-					LocalToWorld,
-					CameraPosition,
-					ViewFrustum,
-					EffectiveSettings.PatchCountX,
-					EffectiveSettings.PatchCountY,
-					DisplacementTexture,
-					SubtractTexture,
-					NormalMapTexture,
-					GPUPatchBuffers
-				);
-				
-				GraphBuilder.Execute();
-				
-				if (bDebugLog)
-				{
-					int32 TotalPatches = GPUPatchBuffers.GetTotalPatchCount();
-					int32 ValidPatches = 0;
-					for (const FGPUTessellationBuffers& Patch : GPUPatchBuffers.PatchBuffers)
-					{
-						if (Patch.IsValid()) ValidPatches++;
-					}
-					UE_LOG(LogTemp, Warning, TEXT("GPUTessellation: Patches generated - Total:%d Valid:%d"),
-						TotalPatches, ValidPatches);
+					UE_LOG(LogGPUTessellation, Log, TEXT("GPUTessellation: Starting PATCH generation on render thread - Patches:%dx%d"),
+						Settings.PatchCountX, Settings.PatchCountY);
 				}
 				
-				// Initialize vertex factories for all patches
-				InitializePatchVertexFactories(RHICmdList);
-				
-				bMeshValid = GPUPatchBuffers.IsValid();
+				RequestPatchRegeneration_RenderThread(CameraPosition, LocalToWorld, Trigger);
+				AdvancePatchRegeneration_RenderThread(RHICmdList);
 				
 				if (bDebugLog)
 				{
-					UE_LOG(LogTemp, Warning, TEXT("GPUTessellation: Patch mode initialized - MeshValid:%d"), bMeshValid);
+					UE_LOG(LogGPUTessellation, Log, TEXT("GPUTessellation: Patch mode initialized - MeshValid:%d Pending:%d"),
+						bMeshValid, IsPatchRegenerationPending());
 				}
 			});
 	}
 	else
 	{
-		// SINGLE MESH MODE: Generate one mesh (original behavior)
+		// SINGLE MESH MODE: Generate one mesh (original behavior), recorded with the frame's regeneration batch
 		ENQUEUE_RENDER_COMMAND(GenerateTessellatedMesh)(
-			[this, EffectiveSettings, LocalToWorld = Component->GetComponentTransform().ToMatrixWithScale(), CameraPosition, 
-			 DisplacementTexture = Component->DisplacementTexture, SubtractTexture = Component->SubtractTexture,
-			 NormalMapTexture = Component->NormalMapTexture,
-			 bDebugLog = this->bEnableDebugLogging]
+			[this, EffectiveSettings, LocalToWorld = Component->GetComponentTransform().ToMatrixWithScale(), CameraPosition,
+			 Trigger = Component->PendingRegenerationTrigger, bDebugLog = this->bEnableDebugLogging]
 			(FRHICommandListImmediate& RHICmdList)
 			{
 				if (bDebugLog)
 				{
-					UE_LOG(LogTemp, Warning, TEXT("GPUTessellation: Starting mesh generation on render thread with TessFactor:%d"), 
+					UE_LOG(LogGPUTessellation, Log, TEXT("GPUTessellation: Queueing mesh generation on render thread with TessFactor:%d"), 
 						EffectiveSettings.TessellationFactor);
 				}
 				
-				FGPUTessellationMeshBuilder MeshBuilder;
-				FRDGBuilder GraphBuilder(RHICmdList);
-				
-				// Execute tessellation pipeline
-				MeshBuilder.ExecuteTessellationPipeline(GraphBuilder, EffectiveSettings, LocalToWorld, CameraPosition, 
-					DisplacementTexture, SubtractTexture, NormalMapTexture, GPUBuffers);
-				
-				GraphBuilder.Execute();
-				
-				if (bDebugLog)
-				{
-					UE_LOG(LogTemp, Warning, TEXT("GPUTessellation: After Execute - VertexCount:%d IndexCount:%d PositionBuffer:%d NormalBuffer:%d"),
-						GPUBuffers.VertexCount, GPUBuffers.IndexCount, 
-						GPUBuffers.PositionBuffer.IsValid(), GPUBuffers.NormalBuffer.IsValid());
-				}
-				
-				// Initialize vertex factory if buffers are valid
-				if (GPUBuffers.IsValid())
-				{
-					bMeshValid = true;
-					VertexFactory.SetBuffers(GPUBuffers.PositionSRV, GPUBuffers.NormalSRV, GPUBuffers.UVSRV);
-					VertexFactory.InitResource(RHICmdList);
-					
-					if (bDebugLog)
-					{
-						UE_LOG(LogTemp, Warning, TEXT("GPUTessellation: Mesh initialized - %d vertices, %d indices, Resolution: %dx%d"), 
-							GPUBuffers.VertexCount, GPUBuffers.IndexCount, GPUBuffers.ResolutionX, GPUBuffers.ResolutionY);
-					}
-				}
-				else
-				{
-					UE_LOG(LogTemp, Error, TEXT("GPUTessellation: Failed to initialize - buffers invalid"));
-				}
+				RequestMeshRegeneration_RenderThread(RHICmdList, EffectiveSettings, LocalToWorld, CameraPosition, Trigger, true, {});
 			});
 	}
 	// Set primitive properties
@@ -250,27 +261,102 @@ FGPUTessellationSceneProxy::FGPUTessellationSceneProxy(UGPUTessellationComponent
 	
 	if (bEnableDebugLogging)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("GPUTessellation: Scene proxy created - WillEverBeLit:%d CastShadow:%d"), 
+		UE_LOG(LogGPUTessellation, Log, TEXT("GPUTessellation: Scene proxy created - WillEverBeLit:%d CastShadow:%d"), 
 			bWillEverBeLit, bCastDynamicShadow);
 	}
 }
 
 FGPUTessellationSceneProxy::~FGPUTessellationSceneProxy()
 {
-	GPUBuffers.Reset();
-	GPUPatchBuffers.Reset();
+	if (RegenerationBatch.IsValid())
+	{
+		RegenerationBatch->Remove_RenderThread(this);
+		RegenerationBatch->RemoveIndirectPatchProxy_RenderThread(this);
+	}
+	
 	VertexFactory.ReleaseResource();
 	
-	// Release and delete all patch vertex factories
-	for (FGPUTessellationVertexFactory* VF : PatchVertexFactories)
+	// The buffers outlive this proxy if another one still shares them
+	const bool bHadSingleMesh = SingleMesh.IsValid() || PendingSingleMesh.IsValid();
+	SetSingleMesh_RenderThread(nullptr);
+	PendingSingleMesh.Reset();
+	if (bHadSingleMesh)
 	{
-		if (VF)
+		FGPUTessellationMeshCache::Get().UpdateStats();
+	}
+	
+	// Release both patch sets and their vertex factories
+	PatchSets[0].Reset();
+	PatchSets[1].Reset();
+	
+	GPUTessellationStats::UpdateBufferMemory(TrackedBufferMemory, FGPUTessellationBufferMemory());
+}
+
+uint32 FGPUTessellationSceneProxy::GetAllocatedSize() const
+{
+	// GPU buffers count toward the footprint of every proxy drawing them, shared ones included
+	uint64 AllocatedSize = FPrimitiveSceneProxy::GetAllocatedSize() + GetBufferMemory().GetTotalBytes();
+	for (const TUniquePtr<FGPUTessellationPatchRenderSet>& PatchSet : PatchSets)
+	{
+		if (PatchSet)
 		{
-			VF->ReleaseResource();
-			delete VF;
+			AllocatedSize += PatchSet->Buffers.PatchInfo.GetAllocatedSize() + PatchSet->Buffers.PatchBuffers.GetAllocatedSize() +
+				PatchSet->PatchVertexFactories.GetAllocatedSize() + PatchSet->PatchVertexFactories.Num() * sizeof(FGPUTessellationVertexFactory);
 		}
 	}
-	PatchVertexFactories.Empty();
+	return (uint32)FMath::Min<uint64>(AllocatedSize, MAX_uint32);
+}
+
+FGPUTessellationBufferMemory FGPUTessellationSceneProxy::GetBufferMemory() const
+{
+	FScopeLock Lock(&TrackedBufferMemoryLock);
+	return TrackedBufferMemory;
+}
+
+int64 FGPUTessellationSceneProxy::GetRenderedVertexCount() const
+{
+	FScopeLock Lock(&TrackedBufferMemoryLock);
+	return TrackedVertexCount;
+}
+
+const FGPUTessellationCachedMesh* FGPUTessellationSceneProxy::GetSingleMeshMemory(uint64& OutBytes) const
+{
+	FScopeLock Lock(&TrackedBufferMemoryLock);
+	OutBytes = TrackedSingleMeshBytes;
+	return TrackedSingleMesh;
+}
+
+void FGPUTessellationSceneProxy::UpdateBufferMemoryStats_RenderThread()
+{
+	check(IsInRenderingThread());
+	
+	// Shared buffers count toward every proxy drawing them; the mesh cache reports the overlap
+	FGPUTessellationBufferMemory BufferMemory;
+	int64 VertexCount = 0;
+	if (SingleMesh.IsValid())
+	{
+		BufferMemory = SingleMesh->Buffers.GetMemory();
+		VertexCount = SingleMesh->Buffers.VertexCount;
+	}
+	if (PatchSets[FrontPatchSetIndex.load(std::memory_order_relaxed)])
+	{
+		VertexCount += GetFrontPatchSet().Buffers.GetVertexCount();
+	}
+	for (const TUniquePtr<FGPUTessellationPatchRenderSet>& PatchSet : PatchSets)
+	{
+		if (PatchSet)
+		{
+			BufferMemory += PatchSet->Buffers.GetMemory();
+		}
+	}
+	
+	GPUTessellationStats::UpdateBufferMemory(TrackedBufferMemory, BufferMemory);
+	
+	FScopeLock Lock(&TrackedBufferMemoryLock);
+	TrackedBufferMemory = BufferMemory;
+	TrackedVertexCount = VertexCount;
+	TrackedSingleMesh = SingleMesh.Get();
+	TrackedSingleMeshBytes = SingleMesh.IsValid() ? SingleMesh->Buffers.GetMemory().GetTotalBytes() : 0;
 }
 
 SIZE_T FGPUTessellationSceneProxy::GetTypeHash() const
@@ -285,7 +371,7 @@ void FGPUTessellationSceneProxy::GetDynamicMeshElements(
 	uint32 VisibilityMap,
 	FMeshElementCollector& Collector) const
 {
-	QUICK_SCOPE_CYCLE_COUNTER(STAT_GPUTessellationSceneProxy_GetDynamicMeshElements);
+	GPUTESSELLATION_SCOPE_CYCLE_COUNTER(STAT_GPUTessellation_GetDynamicMeshElements, GetDynamicMeshElements);
 	
 	// Throttled debug logging
 	if (bEnableDebugLogging)
@@ -296,13 +382,20 @@ void FGPUTessellationSceneProxy::GetDynamicMeshElements(
 			LastLogTime = CurrentTime;
 			if (bUsePatchMode)
 			{
-				UE_LOG(LogTemp, Warning, TEXT("GPUTessellation: GetDynamicMeshElements PATCH MODE - Valid:%d Material:%d TotalPatches:%d VisibilityMap:0x%X"), 
-					bMeshValid, MaterialProxy != nullptr, GPUPatchBuffers.GetTotalPatchCount(), VisibilityMap);
+				UE_LOG(LogGPUTessellation, Log, TEXT("GPUTessellation: GetDynamicMeshElements PATCH MODE - Valid:%d Material:%d TotalPatches:%d VisibilityMap:0x%X"), 
+					bMeshValid, MaterialProxy != nullptr, GetFrontPatchSet().Buffers.GetTotalPatchCount(), VisibilityMap);
 			}
 			else
 			{
-				UE_LOG(LogTemp, Warning, TEXT("GPUTessellation: GetDynamicMeshElements SINGLE MESH - Valid:%d Material:%d Buffers:%d VertexCount:%d IndexCount:%d"), 
-					bMeshValid, MaterialProxy != nullptr, GPUBuffers.IsValid(), GPUBuffers.VertexCount, GPUBuffers.IndexCount);
+				const bool bHasSingleMesh = SingleMesh.IsValid();
+				UE_LOG(LogGPUTessellation, Log, TEXT("GPUTessellation: GetDynamicMeshElements SINGLE MESH - Valid:%d Material:%d Buffers:%d VertexCount:%d IndexCount:%d Users:%d"), 
+					bMeshValid, MaterialProxy != nullptr, bHasSingleMesh && SingleMesh->Buffers.IsValid(), bHasSingleMesh ? SingleMesh->Buffers.VertexCount : 0,
+					bHasSingleMesh ? SingleMesh->Buffers.IndexCount : 0, SingleMesh.GetSharedReferenceCount());
+			}
+			if (Views.Num() > 0 && Views[0])
+			{
+				UE_LOG(LogGPUTessellation, Log, TEXT("GPUTessellation: Current Camera Position from View: %s"), 
+					*Views[0]->ViewMatrices.GetViewOrigin().ToString());
 			}
 		}
 	}
@@ -315,32 +408,16 @@ void FGPUTessellationSceneProxy::GetDynamicMeshElements(
 	// CRITICAL FIX: Get camera position from the current View!
 	// For patch LOD, we need the ACTUAL camera position from the view being rendered
 	FVector CurrentCameraPosition = FVector::ZeroVector;
-	const FConvexVolume* ViewFrustum = nullptr;
 	if (Views.Num() > 0 && Views[0])
 	{
 		// Use View's actual camera position (ViewMatrices.GetViewOrigin())
 		CurrentCameraPosition = Views[0]->ViewMatrices.GetViewOrigin();
-		ViewFrustum = &Views[0]->ViewFrustum;
 		
 		// Store for potential future use
 		LastCameraPosition = CurrentCameraPosition;
-		
-		if (bEnableDebugLogging)
-		{
-			static double LastCameraPosLogTime = 0.0;
-			double CurrentTime = FPlatformTime::Seconds();
-			if (CurrentTime - LastCameraPosLogTime >= 2.0)
-			{
-				LastCameraPosLogTime = CurrentTime;
-				UE_LOG(LogTemp, Warning, TEXT("GPUTessellation: Current Camera Position from View: %s"), 
-					*CurrentCameraPosition.ToString());
-			}
-		}
 	}
 
-	// NOTE: Patch regeneration per-frame causes RDG nesting issues
-	// The patches are generated once in constructor, but LOD calculation uses camera position
-	// TODO: Implement proper per-frame LOD update without nested RDG builders
+	// Patch LOD updates never regenerate here: see UpdateDynamicData_RenderThread and FGPUTessellationRegenerationBatch
 	
 	// Set up wireframe material (if needed)
 	auto WireframeMaterialInstance = new FColoredMaterialRenderProxy(
@@ -350,7 +427,12 @@ void FGPUTessellationSceneProxy::GetDynamicMeshElements(
 	Collector.RegisterOneFrameMaterialProxy(WireframeMaterialInstance);
 
 	// Render based on mode
-	if (bUsePatchMode)
+	if (bUsePatchMode && GetFrontPatchSet().Buffers.bIndirect)
+	{
+		// SPATIAL PATCH RENDERING: GPU culled, one indirect draw per LOD level
+		RenderIndirectPatches(Views, ViewFamily, VisibilityMap, Collector, WireframeMaterialInstance);
+	}
+	else if (bUsePatchMode)
 	{
 		// SPATIAL PATCH RENDERING: Render each visible patch
 		RenderPatches(Views, ViewFamily, VisibilityMap, Collector, WireframeMaterialInstance);
@@ -369,16 +451,27 @@ void FGPUTessellationSceneProxy::RenderSingleMesh(
 	FMeshElementCollector& Collector,
 	FMaterialRenderProxy* WireframeMaterialInstance) const
 {
-	if (!GPUBuffers.IsValid())
+	if (!SingleMesh.IsValid() || !SingleMesh->Buffers.IsValid())
 	{
 		return;
 	}
+	const FGPUTessellationBuffers& GPUBuffers = SingleMesh->Buffers;
+	
+	// Hit proxies stay per component, so the hit proxy pass draws every proxy on its own
+	const bool bAllowInstancing = CVarGPUTessellationInstancing.GetValueOnRenderThread() != 0 && SingleMesh->Users.Num() > 1 &&
+		SingleMesh->InstancedVertexFactory.IsInitialized() && !ViewFamily.EngineShowFlags.HitProxies;
 
 	for (int32 ViewIndex = 0; ViewIndex < Views.Num(); ViewIndex++)
 	{
 		if (VisibilityMap & (1 << ViewIndex))
 		{
 			const FSceneView* View = Views[ViewIndex];
+			
+			if (bAllowInstancing && JoinInstancedDraw(View, ViewFamily))
+			{
+				// Another proxy of the mesh draws this one for the view
+				continue;
+			}
 
 			// Draw mesh (pure GPU rendering!)
 			FMeshBatch& Mesh = Collector.AllocateMesh();
@@ -403,6 +496,12 @@ void FGPUTessellationSceneProxy::RenderSingleMesh(
 			Mesh.DepthPriorityGroup = SDPG_World;
 			Mesh.bCanApplyViewModeOverrides = true;
 			Mesh.CastShadow = IsShadowCast(View);
+			
+			if (bAllowInstancing)
+			{
+				// Proxies of the mesh gathered after this one for the view add their instances to the batch
+				BeginInstancedDraw(View, ViewFamily, Collector, Mesh);
+			}
 
 			Collector.AddMesh(ViewIndex, Mesh);
 
@@ -414,6 +513,212 @@ void FGPUTessellationSceneProxy::RenderSingleMesh(
 	}
 }
 
+bool FGPUTessellationSceneProxy::JoinInstancedDraw(const FSceneView* View, const FSceneViewFamily& ViewFamily) const
+{
+	// Selected and hovered proxies draw alone so their outlines stay their own
+	if (IsSelected() || IsHovered())
+	{
+		return false;
+	}
+	
+	FGPUTessellationCachedMesh& CachedMesh = *SingleMesh;
+	const FConvexVolume* ShadowFrustum = View->GetDynamicMeshElementsShadowCullFrustum();
+	
+	// Gathering may run in parallel for several proxies of the mesh
+	FScopeLock Lock(&CachedMesh.InstancedDrawLock);
+	CachedMesh.InstancedDraws.RemoveAllSwap([&ViewFamily](const FGPUTessellationInstancedDraw& Draw)
+	{
+		return Draw.FrameNumber != ViewFamily.FrameNumber;
+	});
+	
+	for (FGPUTessellationInstancedDraw& Draw : CachedMesh.InstancedDraws)
+	{
+		if (Draw.ViewFamily != &ViewFamily || Draw.View != View || Draw.ShadowFrustum != ShadowFrustum)
+		{
+			continue;
+		}
+		if (Draw.Proxies.Contains(this))
+		{
+			return true;
+		}
+		if (Draw.Proxies.Num() >= Draw.Capacity || !Draw.DrawingProxy->CanShareInstancedDraw(*this))
+		{
+			continue;
+		}
+		
+		const FMatrix InstanceToLocal = GetLocalToWorld() * Draw.WorldToLocal;
+		const FMatrix PreviousInstanceToLocal = GetPreviousLocalToWorld() * Draw.PreviousWorldToLocal;
+		float* Transforms = Draw.Transforms + Draw.Proxies.Num() * FGPUTessellationInstancedUserData::FloatsPerInstance;
+		for (const FMatrix* Transform : { &InstanceToLocal, &PreviousInstanceToLocal })
+		{
+			for (int32 Row = 0; Row < 4; ++Row)
+			{
+				for (int32 Column = 0; Column < 3; ++Column)
+				{
+					*Transforms++ = (float)Transform->M[Row][Column];
+				}
+			}
+		}
+		
+		Draw.Proxies.Add(this);
+		Draw.BatchElement->NumInstances = Draw.Proxies.Num();
+		GPUTESSELLATION_INC_COUNTER(STAT_GPUTessellation_InstancedDraws, InstancedDraws, Draw.Proxies.Num() == 2 ? 1 : 0);
+		GPUTESSELLATION_INC_COUNTER(STAT_GPUTessellation_InstancedProxies, InstancedProxies, Draw.Proxies.Num() == 2 ? 2 : 1);
+		return true;
+	}
+	return false;
+}
+
+bool FGPUTessellationSceneProxy::BeginInstancedDraw(
+	const FSceneView* View,
+	const FSceneViewFamily& ViewFamily,
+	FMeshElementCollector& Collector,
+	FMeshBatch& Mesh) const
+{
+	if (IsSelected() || IsHovered())
+	{
+		return false;
+	}
+	
+	FGPUTessellationCachedMesh& CachedMesh = *SingleMesh;
+	FScopeLock Lock(&CachedMesh.InstancedDrawLock);
+	
+	// Room for every proxy that could join; the ones the renderer culls are never gathered and leave their slot unused
+	int32 Capacity = 1;
+	for (const FGPUTessellationSceneProxy* User : CachedMesh.Users)
+	{
+		if (User != this && CanShareInstancedDraw(*User))
+		{
+			++Capacity;
+		}
+	}
+	if (Capacity == 1)
+	{
+		return false;
+	}
+	
+	// Every instance is placed relative to this proxy, whose primitive data the draw uses
+	FGlobalDynamicReadBuffer::FAllocation TransformAllocation =
+		Collector.GetDynamicReadBuffer().AllocateFloat(Capacity * FGPUTessellationInstancedUserData::FloatsPerInstance);
+	float* Transforms = reinterpret_cast<float*>(TransformAllocation.Buffer);
+	for (int32 Transform = 0; Transform < 2; ++Transform)
+	{
+		for (int32 Row = 0; Row < 4; ++Row)
+		{
+			for (int32 Column = 0; Column < 3; ++Column)
+			{
+				*Transforms++ = Row == Column ? 1.0f : 0.0f;
+			}
+		}
+	}
+	
+	FGPUTessellationInstancedUserData& InstancedUserData = Collector.AllocateOneFrameResource<FGPUTessellationInstancedUserData>();
+	InstancedUserData.InstanceTransformSRV = TransformAllocation.SRV;
+	FMeshBatchElement& BatchElement = Mesh.Elements[0];
+	BatchElement.UserData = &InstancedUserData;
+	BatchElement.NumInstances = 1;
+	Mesh.VertexFactory = &CachedMesh.InstancedVertexFactory;
+	
+	FGPUTessellationInstancedDraw& Draw = CachedMesh.InstancedDraws.AddDefaulted_GetRef();
+	Draw.ViewFamily = &ViewFamily;
+	Draw.View = View;
+	Draw.ShadowFrustum = View->GetDynamicMeshElementsShadowCullFrustum();
+	Draw.FrameNumber = ViewFamily.FrameNumber;
+	Draw.DrawingProxy = this;
+	Draw.Proxies.Add(this);
+	Draw.BatchElement = &BatchElement;
+	Draw.Transforms = reinterpret_cast<float*>(TransformAllocation.Buffer);
+	Draw.Capacity = Capacity;
+	Draw.WorldToLocal = GetLocalToWorld().Inverse();
+	Draw.PreviousWorldToLocal = GetPreviousLocalToWorld().Inverse();
+	return true;
+}
+
+bool FGPUTessellationSceneProxy::CanShareInstancedDraw(const FGPUTessellationSceneProxy& Other) const
+{
+	// The draw uses this proxy's material and primitive data, so everything the renderer reads from them must match.
+	// Motion vectors come from each instance's own previous transform, but only still proxies share a draw.
+	const FCustomPrimitiveData* CustomPrimitiveData = GetCustomPrimitiveData();
+	const FCustomPrimitiveData* OtherCustomPrimitiveData = Other.GetCustomPrimitiveData();
+	const bool bSameCustomPrimitiveData = (CustomPrimitiveData && OtherCustomPrimitiveData) ?
+		CustomPrimitiveData->Data == OtherCustomPrimitiveData->Data : CustomPrimitiveData == OtherCustomPrimitiveData;
+	
+	return &GetScene() == &Other.GetScene() &&
+		MaterialProxy == Other.MaterialProxy &&
+		!Other.IsSelected() && !Other.IsHovered() &&
+		!HasMovedRecently() && !Other.HasMovedRecently() &&
+		IsLocalToWorldDeterminantNegative() == Other.IsLocalToWorldDeterminantNegative() &&
+		CastsDynamicShadow() == Other.CastsDynamicShadow() &&
+		GetLightingChannelMask() == Other.GetLightingChannelMask() &&
+		ShouldRenderInMainPass() == Other.ShouldRenderInMainPass() &&
+		ShouldRenderCustomDepth() == Other.ShouldRenderCustomDepth() &&
+		GetCustomDepthStencilValue() == Other.GetCustomDepthStencilValue() &&
+		ReceivesDecals() == Other.ReceivesDecals() &&
+		bSameCustomPrimitiveData;
+}
+
+bool FGPUTessellationSceneProxy::HasMovedRecently() const
+{
+	return bTransformTracked && GFrameCounterRenderThread - LastTransformChangeFrame <= 1;
+}
+
+const FMatrix& FGPUTessellationSceneProxy::GetPreviousLocalToWorld() const
+{
+	return bTransformTracked && GFrameCounterRenderThread == LastTransformChangeFrame ? PreviousLocalToWorld : GetLocalToWorld();
+}
+
+void FGPUTessellationSceneProxy::OnTransformChanged(FRHICommandListBase& RHICmdList)
+{
+	// The first call places the proxy when it is added to the scene; only later calls move it
+	if (bTransformTracked)
+	{
+		PreviousLocalToWorld = TrackedLocalToWorld;
+		LastTransformChangeFrame = GFrameCounterRenderThread;
+	}
+	TrackedLocalToWorld = GetLocalToWorld();
+	bTransformTracked = true;
+}
+
+void FGPUTessellationSceneProxy::SetSingleMesh_RenderThread(TSharedPtr<FGPUTessellationCachedMesh> Mesh)
+{
+	check(IsInRenderingThread());
+	
+	if (SingleMesh.IsValid())
+	{
+		// Draws this proxy issued or was part of must not be matched against it once it leaves
+		FScopeLock Lock(&SingleMesh->InstancedDrawLock);
+		SingleMesh->Users.RemoveSingleSwap(this);
+		SingleMesh->InstancedDraws.RemoveAllSwap([this](const FGPUTessellationInstancedDraw& Draw)
+		{
+			return Draw.DrawingProxy == this;
+		});
+		for (FGPUTessellationInstancedDraw& Draw : SingleMesh->InstancedDraws)
+		{
+			Draw.Proxies.RemoveSingleSwap(this);
+		}
+	}
+	
+	SingleMesh = MoveTemp(Mesh);
+	if (SingleMesh.IsValid())
+	{
+		SingleMesh->Users.Add(this);
+	}
+}
+
+void FGPUTessellationSceneProxy::GetPatchPrimitiveBounds(
+	const FGPUTessellationPatchInfo& PatchInfo,
+	const FMatrix& LocalToWorld,
+	FBoxSphereBounds& OutWorldBounds,
+	FBoxSphereBounds& OutLocalBounds)
+{
+	// PatchInfo.WorldBounds is already in world space (calculated in CalculatePatchInfo)
+	OutWorldBounds = FBoxSphereBounds(PatchInfo.WorldBounds);
+	
+	// Transform world bounds back to local space for the uniform buffer
+	const FTransform InverseTransform = FTransform(LocalToWorld).Inverse();
+	OutLocalBounds = FBoxSphereBounds(PatchInfo.WorldBounds.TransformBy(InverseTransform));
+}
+
 void FGPUTessellationSceneProxy::RenderPatches(
 	const TArray<const FSceneView*>& Views,
 	const FSceneViewFamily& ViewFamily,
@@ -421,12 +726,13 @@ void FGPUTessellationSceneProxy::RenderPatches(
 	FMeshElementCollector& Collector,
 	FMaterialRenderProxy* WireframeMaterialInstance) const
 {
-	if (!GPUPatchBuffers.IsValid())
+	const FGPUTessellationPatchRenderSet& PatchSet = GetFrontPatchSet();
+	if (!PatchSet.Buffers.IsValid())
 	{
 		return;
 	}
 
-	int32 TotalPatches = GPUPatchBuffers.GetTotalPatchCount();
+	int32 TotalPatches = PatchSet.Buffers.GetTotalPatchCount();
 	int32 RenderedPatches = 0;
 
 	for (int32 ViewIndex = 0; ViewIndex < Views.Num(); ViewIndex++)
@@ -434,33 +740,37 @@ void FGPUTessellationSceneProxy::RenderPatches(
 		if (VisibilityMap & (1 << ViewIndex))
 		{
 			const FSceneView* View = Views[ViewIndex];
+			int32 CulledPatches = 0;
 
 			// Render each patch
 			for (int32 PatchIndex = 0; PatchIndex < TotalPatches; ++PatchIndex)
 			{
-				const FGPUTessellationPatchInfo& PatchInfo = GPUPatchBuffers.PatchInfo[PatchIndex];
+				const FGPUTessellationPatchInfo& PatchInfo = PatchSet.Buffers.PatchInfo[PatchIndex];
 				
 				// Skip culled patches
 				if (!PatchInfo.bVisible)
 				{
-					if (bEnableDebugLogging)
-					{
-						UE_LOG(LogTemp, Warning, TEXT("    RenderPatch[%d]: SKIPPED - not visible"), PatchIndex);
-					}
+					CulledPatches++;
+					UE_LOG(LogGPUTessellation, VeryVerbose, TEXT("    RenderPatch[%d]: SKIPPED - not visible"), PatchIndex);
+					continue;
+				}
+				
+				// Batched patches share one set of buffers and draw their own range of it
+				const bool bBatched = PatchSet.Buffers.bBatched;
+				if (bBatched && PatchInfo.NumIndices <= 0)
+				{
 					continue;
 				}
 				
-				const FGPUTessellationBuffers& PatchBuffer = GPUPatchBuffers.PatchBuffers[PatchIndex];
+				const FGPUTessellationBuffers& PatchBuffer = bBatched ? PatchSet.Buffers.SharedBuffers : PatchSet.Buffers.PatchBuffers[PatchIndex];
 				
 				// Skip invalid patches
 				if (!PatchBuffer.IsValid())
 				{
 					// Only log error once per patch to avoid spam
-					static TSet<int32> LoggedInvalidPatches;
-					if (!LoggedInvalidPatches.Contains(PatchIndex))
+					if (PatchSet.MarkPatchErrorReported(PatchIndex))
 					{
-						LoggedInvalidPatches.Add(PatchIndex);
-						UE_LOG(LogTemp, Error, TEXT("GPUTessellation: Patch[%d] has INVALID buffer! Verts:%d Indices:%d PosBuffer:%d NormalBuffer:%d UVBuffer:%d IndexBuffer:%d"),
+						UE_LOG(LogGPUTessellation, Error, TEXT("GPUTessellation: Patch[%d] has INVALID buffer! Verts:%d Indices:%d PosBuffer:%d NormalBuffer:%d UVBuffer:%d IndexBuffer:%d"),
 							PatchIndex, 
 							PatchBuffer.VertexCount, 
 							PatchBuffer.IndexCount, 
@@ -473,27 +783,25 @@ void FGPUTessellationSceneProxy::RenderPatches(
 				}
 				
 				// Make sure we have a vertex factory for this patch
-				if (!PatchVertexFactories.IsValidIndex(PatchIndex) || !PatchVertexFactories[PatchIndex])
+				const FGPUTessellationVertexFactory* PatchVertexFactory = bBatched ? &PatchSet.BatchedVertexFactory :
+					(PatchSet.PatchVertexFactories.IsValidIndex(PatchIndex) ? PatchSet.PatchVertexFactories[PatchIndex] : nullptr);
+				if (!PatchVertexFactory)
 				{
 					// Only log error once per patch to avoid spam
-					static TSet<int32> LoggedMissingVF;
-					if (!LoggedMissingVF.Contains(PatchIndex))
+					if (PatchSet.MarkPatchErrorReported(PatchIndex))
 					{
-						LoggedMissingVF.Add(PatchIndex);
-						UE_LOG(LogTemp, Error, TEXT("GPUTessellation: Patch[%d] has NO vertex factory! ArraySize:%d TotalPatches:%d"),
-							PatchIndex, PatchVertexFactories.Num(), TotalPatches);
+						UE_LOG(LogGPUTessellation, Error, TEXT("GPUTessellation: Patch[%d] has NO vertex factory! ArraySize:%d TotalPatches:%d"),
+							PatchIndex, PatchSet.PatchVertexFactories.Num(), TotalPatches);
 					}
 					continue;
 				}
 				
 				// Additional safety check: verify vertex factory is initialized
-				if (!PatchVertexFactories[PatchIndex]->IsInitialized())
+				if (!PatchVertexFactory->IsInitialized())
 				{
-					static TSet<int32> LoggedUninitializedVF;
-					if (!LoggedUninitializedVF.Contains(PatchIndex))
+					if (PatchSet.MarkPatchErrorReported(PatchIndex))
 					{
-						LoggedUninitializedVF.Add(PatchIndex);
-						UE_LOG(LogTemp, Error, TEXT("GPUTessellation: Patch[%d] vertex factory NOT INITIALIZED!"), PatchIndex);
+						UE_LOG(LogGPUTessellation, Error, TEXT("GPUTessellation: Patch[%d] vertex factory NOT INITIALIZED!"), PatchIndex);
 					}
 					continue;
 				}
@@ -502,25 +810,29 @@ void FGPUTessellationSceneProxy::RenderPatches(
 				FMeshBatch& Mesh = Collector.AllocateMesh();
 				FMeshBatchElement& BatchElement = Mesh.Elements[0];
 				
-				// Use patch's GPU index buffer
+				// Use patch's GPU index buffer (batched indices already include the patch's vertex base)
 				BatchElement.IndexBuffer = &PatchBuffer.IndexBuffer;
-				BatchElement.FirstIndex = 0;
-				BatchElement.NumPrimitives = PatchBuffer.IndexCount / 3;
-				BatchElement.MinVertexIndex = 0;
-				BatchElement.MaxVertexIndex = PatchBuffer.VertexCount - 1;
+				if (bBatched)
+				{
+					BatchElement.FirstIndex = PatchInfo.FirstIndex;
+					BatchElement.NumPrimitives = PatchInfo.NumIndices / 3;
+					BatchElement.MinVertexIndex = PatchInfo.FirstVertex;
+					BatchElement.MaxVertexIndex = PatchInfo.FirstVertex + PatchInfo.NumVertices - 1;
+				}
+				else
+				{
+					BatchElement.FirstIndex = 0;
+					BatchElement.NumPrimitives = PatchBuffer.IndexCount / 3;
+					BatchElement.MinVertexIndex = 0;
+					BatchElement.MaxVertexIndex = PatchBuffer.VertexCount - 1;
+				}
 				
 			// CRITICAL FIX: Create per-patch uniform buffer with correct bounds!
 			// Each patch has vertices in absolute world-local space, but we need to tell
 			// the renderer about this specific patch's bounds for proper culling.
-			
-			// PatchInfo.WorldBounds is already in world space (calculated in CalculatePatchInfo)
-			FBoxSphereBounds PatchWorldBounds(PatchInfo.WorldBounds);
-			
-			// Transform world bounds back to local space for the uniform buffer
-			// We need to use the inverse transform properly
-			FTransform InverseTransform = FTransform(GetLocalToWorld()).Inverse();
-			FBox LocalBoundsBox = PatchInfo.WorldBounds.TransformBy(InverseTransform);
-			FBoxSphereBounds PatchLocalBounds(LocalBoundsBox);
+			FBoxSphereBounds PatchWorldBounds;
+			FBoxSphereBounds PatchLocalBounds;
+			GetPatchPrimitiveBounds(PatchInfo, GetLocalToWorld(), PatchWorldBounds, PatchLocalBounds);
 			
 			// Create a dynamic primitive uniform buffer for this patch
 			// that includes the correct bounds for culling
@@ -538,7 +850,7 @@ void FGPUTessellationSceneProxy::RenderPatches(
 			BatchElement.PrimitiveUniformBufferResource = &DynamicPrimitiveUniformBuffer.UniformBuffer;
 			BatchElement.PrimitiveIdMode = PrimID_ForceZero;				// Setup mesh batch
 				Mesh.bWireframe = AllowDebugViewmodes() && ViewFamily.EngineShowFlags.Wireframe;
-				Mesh.VertexFactory = PatchVertexFactories[PatchIndex];
+				Mesh.VertexFactory = PatchVertexFactory;
 				Mesh.MaterialRenderProxy = Mesh.bWireframe ? WireframeMaterialInstance : MaterialProxy;
 				Mesh.ReverseCulling = IsLocalToWorldDeterminantNegative();
 				Mesh.Type = PT_TriangleList;
@@ -549,6 +861,8 @@ void FGPUTessellationSceneProxy::RenderPatches(
 				Collector.AddMesh(ViewIndex, Mesh);
 				RenderedPatches++;
 			}
+			
+			GPUTESSELLATION_INC_COUNTER(STAT_GPUTessellation_PatchesCulled, PatchesCulled, CulledPatches);
 
 #if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
 			// Render bounds
@@ -562,7 +876,7 @@ void FGPUTessellationSceneProxy::RenderPatches(
 				// Draw each patch's bounds
 				for (int32 PatchIndex = 0; PatchIndex < TotalPatches; ++PatchIndex)
 				{
-					const FGPUTessellationPatchInfo& PatchInfo = GPUPatchBuffers.PatchInfo[PatchIndex];
+					const FGPUTessellationPatchInfo& PatchInfo = PatchSet.Buffers.PatchInfo[PatchIndex];
 					
 					// Color: green for visible, red for culled, blue for different LODs
 					FColor PatchColor = PatchInfo.bVisible ? FColor::Green : FColor::Red;
@@ -584,79 +898,332 @@ void FGPUTessellationSceneProxy::RenderPatches(
 		}
 	}
 	
-	// Debug logging for patch rendering
-	if (RenderedPatches > 0)
+	GPUTESSELLATION_INC_COUNTER(STAT_GPUTessellation_PatchesDrawn, PatchesDrawn, RenderedPatches);
+	
+	// Debug logging for patch rendering, whenever the drawn patch count changes
+	if (UE_LOG_ACTIVE(LogGPUTessellation, Verbose) && LastRenderedPatchCount != RenderedPatches)
 	{
-		static int32 FrameCounter = 0;
-		static int32 LastRenderedCount = 0;
-		FrameCounter++;
+		LastRenderedPatchCount = RenderedPatches;
+		UE_LOG(LogGPUTessellation, Verbose, TEXT("GPUTessellation: Rendered %d/%d patches (Frame %u)"), 
+			RenderedPatches, TotalPatches, ViewFamily.FrameNumber);
 		
-		if (FrameCounter % 60 == 0 || LastRenderedCount != RenderedPatches)
+		for (int32 i = 0; i < PatchSet.Buffers.PatchInfo.Num(); ++i)
 		{
-			LastRenderedCount = RenderedPatches;
-			UE_LOG(LogTemp, Warning, TEXT("GPUTessellation: Rendered %d/%d patches (Frame %d)"), 
-				RenderedPatches, TotalPatches, FrameCounter);
-			
-			// Log first few patch positions
-			if (GPUPatchBuffers.PatchInfo.Num() >= 4)
-			{
-				for (int32 i = 0; i < FMath::Min(4, GPUPatchBuffers.PatchInfo.Num()); ++i)
-				{
-					const FGPUTessellationPatchInfo& PatchInf = GPUPatchBuffers.PatchInfo[i];
-					UE_LOG(LogTemp, Warning, TEXT("  Patch[%d] Center: %s Visible:%d"), 
-						i, *PatchInf.WorldCenter.ToString(), PatchInf.bVisible);
-				}
-			}
+			const FGPUTessellationPatchInfo& PatchInf = PatchSet.Buffers.PatchInfo[i];
+			UE_LOG(LogGPUTessellation, VeryVerbose, TEXT("  Patch[%d] Center: %s Visible:%d"), 
+				i, *PatchInf.WorldCenter.ToString(), PatchInf.bVisible);
 		}
 	}
 }
 
-void FGPUTessellationSceneProxy::InitializePatchVertexFactories(FRHICommandListImmediate& RHICmdList)
+void FGPUTessellationSceneProxy::RenderIndirectPatches(
+	const TArray<const FSceneView*>& Views,
+	const FSceneViewFamily& ViewFamily,
+	uint32 VisibilityMap,
+	FMeshElementCollector& Collector,
+	FMaterialRenderProxy* WireframeMaterialInstance) const
 {
-	int32 TotalPatches = GPUPatchBuffers.GetTotalPatchCount();
-	
-	// Release and delete old factories
-	for (FGPUTessellationVertexFactory* VF : PatchVertexFactories)
+	const FGPUTessellationPatchRenderSet& PatchSet = GetFrontPatchSet();
+	if (!PatchSet.Buffers.IsValid() || !PatchSet.IndirectVertexFactory.IsInitialized())
 	{
-		if (VF)
-		{
-			if (VF->IsInitialized())
-			{
-				VF->ReleaseResource();
-			}
-			delete VF;
-		}
+		return;
 	}
-	
-	// Allocate new factories
-	PatchVertexFactories.Empty(TotalPatches);
-	
-	// Create and initialize each factory
-	for (int32 i = 0; i < TotalPatches; ++i)
+
+	const FGPUTessellationBuffers& SharedBuffers = PatchSet.Buffers.SharedBuffers;
+	const FGPUTessellationIndirectDrawBuffers& IndirectDraw = PatchSet.Buffers.IndirectDraw;
+
+	for (int32 ViewIndex = 0; ViewIndex < Views.Num(); ViewIndex++)
 	{
-		if (GPUPatchBuffers.PatchBuffers[i].IsValid())
-		{
-			FGPUTessellationVertexFactory* VF = new FGPUTessellationVertexFactory(GetScene().GetFeatureLevel());
-			VF->SetBuffers(
-				GPUPatchBuffers.PatchBuffers[i].PositionSRV,
-				GPUPatchBuffers.PatchBuffers[i].NormalSRV,
-				GPUPatchBuffers.PatchBuffers[i].UVSRV
-			);
-			VF->InitResource(RHICmdList);
-			PatchVertexFactories.Add(VF);
-		}
-		else
+		if (VisibilityMap & (1 << ViewIndex))
 		{
-			PatchVertexFactories.Add(nullptr);
-		}
-	}
-}
+			const FSceneView* View = Views[ViewIndex];
+			
+			// Views draw what was culled against their frustum; shadow passes need the patches outside it as well
+			const FGPUTessellationViewIndirectDraw* ViewIndirectDraw = View->GetDynamicMeshElementsShadowCullFrustum() == nullptr ?
+				FindViewIndirectDraw(View, ViewFamily.FrameNumber) : nullptr;
+			FRHIBuffer* IndirectArgsBuffer = ViewIndirectDraw ? ViewIndirectDraw->IndirectArgs->GetRHI() : IndirectDraw.IndirectArgsBuffer.GetReference();
 
-void FGPUTessellationSceneProxy::UpdateDynamicData_RenderThread(FGPUTessellationDynamicData* DynamicData)
-{
-	check(IsInRenderingThread());
-	
-	if (!DynamicData || !bUsePatchMode)
+			// One draw per LOD level; instance counts were written by the GPU culling pass
+			for (int32 LODIndex = 0; LODIndex < IndirectDraw.NumLODs; ++LODIndex)
+			{
+				FMeshBatch& Mesh = Collector.AllocateMesh();
+				FMeshBatchElement& BatchElement = Mesh.Elements[0];
+				
+				// Index count and first index come from the indirect arguments
+				BatchElement.IndexBuffer = &SharedBuffers.IndexBuffer;
+				BatchElement.FirstIndex = 0;
+				BatchElement.NumPrimitives = 0;
+				BatchElement.MinVertexIndex = 0;
+				BatchElement.MaxVertexIndex = SharedBuffers.VertexCount - 1;
+				BatchElement.IndirectArgsBuffer = IndirectArgsBuffer;
+				BatchElement.IndirectArgsOffset = LODIndex * sizeof(FRHIDrawIndexedIndirectParameters);
+				
+				// Visible patch list of the arguments and the start of this LOD level in it
+				FGPUTessellationIndirectUserData& IndirectUserData = Collector.AllocateOneFrameResource<FGPUTessellationIndirectUserData>();
+				IndirectUserData.VisiblePatchListSRV = ViewIndirectDraw ? ViewIndirectDraw->VisiblePatchListSRV.GetReference() : nullptr;
+				IndirectUserData.PatchListOffset = LODIndex * IndirectDraw.PatchListCapacity;
+				BatchElement.UserData = &IndirectUserData;
+				
+				// Patches are culled on the GPU; the whole primitive's bounds cover every instance
+				BatchElement.PrimitiveUniformBuffer = GetUniformBuffer();
+				BatchElement.PrimitiveIdMode = PrimID_ForceZero;
+
+				Mesh.bWireframe = AllowDebugViewmodes() && ViewFamily.EngineShowFlags.Wireframe;
+				Mesh.VertexFactory = &PatchSet.IndirectVertexFactory;
+				Mesh.MaterialRenderProxy = Mesh.bWireframe ? WireframeMaterialInstance : MaterialProxy;
+				Mesh.ReverseCulling = IsLocalToWorldDeterminantNegative();
+				Mesh.Type = PT_TriangleList;
+				Mesh.DepthPriorityGroup = SDPG_World;
+				Mesh.bCanApplyViewModeOverrides = true;
+				Mesh.CastShadow = IsShadowCast(View);
+
+				Collector.AddMesh(ViewIndex, Mesh);
+			}
+
+#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+			// Render bounds
+			RenderBounds(Collector.GetPDI(ViewIndex), ViewFamily.EngineShowFlags, GetBounds(), IsSelected());
+#endif
+		}
+	}
+}
+
+FGPUTessellationIndirectStatsReadback::FGPUTessellationIndirectStatsReadback() = default;
+FGPUTessellationIndirectStatsReadback::FGPUTessellationIndirectStatsReadback(FGPUTessellationIndirectStatsReadback&&) = default;
+FGPUTessellationIndirectStatsReadback::~FGPUTessellationIndirectStatsReadback() = default;
+
+void FGPUTessellationSceneProxy::CullIndirectPatches_RenderThread(FRDGBuilder& GraphBuilder, const FSceneView& View)
+{
+	check(IsInRenderingThread());
+	
+	const uint32 FrameNumber = View.Family->FrameNumber;
+	ViewIndirectDraws.RemoveAllSwap([FrameNumber](const FGPUTessellationViewIndirectDraw& ViewIndirectDraw)
+	{
+		return ViewIndirectDraw.FrameNumber != FrameNumber;
+	});
+	PollIndirectPatchStats_RenderThread();
+	
+	const FGPUTessellationPatchRenderSet& PatchSet = GetFrontPatchSet();
+	const FGPUTessellationIndirectDrawBuffers& IndirectDraw = PatchSet.Buffers.IndirectDraw;
+	if (!bMeshValid || !Settings.bEnablePatchCulling || !PatchSet.Buffers.bIndirect || !IndirectDraw.IsValid() || !IndirectDraw.PatchCullDataBuffer.IsValid())
+	{
+		return;
+	}
+	
+	// The renderer does not gather the proxy for views that cannot see it
+	const FBoxSphereBounds& Bounds = GetBounds();
+	if (!View.ViewFrustum.IntersectBox(Bounds.Origin, Bounds.BoxExtent))
+	{
+		return;
+	}
+	
+	RDG_EVENT_SCOPE(GraphBuilder, "GPUTessellation.CullIndirectPatches %s", *GetOwnerName().ToString());
+	FRDGBufferRef IndirectArgsBuffer = GraphBuilder.CreateBuffer(
+		FRDGBufferDesc::CreateIndirectDesc<FRHIDrawIndexedIndirectParameters>(IndirectDraw.NumLODs),
+		TEXT("GPUTessellation.ViewPatchIndirectArgs"));
+	FRDGBufferRef VisiblePatchListBuffer = GraphBuilder.CreateBuffer(
+		FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), IndirectDraw.NumLODs * IndirectDraw.PatchListCapacity),
+		TEXT("GPUTessellation.ViewVisiblePatchList"));
+	
+	FGPUTessellationMeshBuilder::AddBuildIndirectArgsPass(
+		GraphBuilder,
+		GraphBuilder.CreateSRV(GraphBuilder.RegisterExternalBuffer(IndirectDraw.PatchCullDataBuffer)),
+		IndirectDraw.NumPatches,
+		IndirectDraw.LODIndexRanges,
+		View.ViewFrustum.Planes,
+		IndirectDraw.PatchListCapacity,
+		IndirectArgsBuffer,
+		VisiblePatchListBuffer);
+	
+	// A few readbacks in flight are enough for the stats; views beyond them are not counted
+	if (CVarGPUTessellationIndirectPatchStats.GetValueOnRenderThread() != 0 && IndirectStatsReadbacks.Num() < 8)
+	{
+		FGPUTessellationIndirectStatsReadback& StatsReadback = IndirectStatsReadbacks.AddDefaulted_GetRef();
+		StatsReadback.Readback = MakeUnique<FRHIGPUBufferReadback>(TEXT("GPUTessellation.IndirectPatchStatsReadback"));
+		StatsReadback.NumLODs = IndirectDraw.NumLODs;
+		StatsReadback.NumPatches = IndirectDraw.NumPatches;
+		AddEnqueueCopyPass(GraphBuilder, StatsReadback.Readback.Get(), IndirectArgsBuffer, IndirectDraw.NumLODs * sizeof(FRHIDrawIndexedIndirectParameters));
+	}
+	
+	// The view's draws are gathered once this graph is set up and read the buffers outside of it
+	FGPUTessellationViewIndirectDraw& ViewIndirectDraw = ViewIndirectDraws.AddDefaulted_GetRef();
+	ViewIndirectDraw.View = &View;
+	ViewIndirectDraw.FrameNumber = FrameNumber;
+	ViewIndirectDraw.IndirectArgs = GraphBuilder.ConvertToExternalBuffer(IndirectArgsBuffer);
+	ViewIndirectDraw.VisiblePatchList = GraphBuilder.ConvertToExternalBuffer(VisiblePatchListBuffer);
+	GraphBuilder.UseExternalAccessMode(IndirectArgsBuffer, ERHIAccess::IndirectArgs);
+	GraphBuilder.UseExternalAccessMode(VisiblePatchListBuffer, ERHIAccess::SRVGraphics);
+	ViewIndirectDraw.VisiblePatchListSRV = GraphBuilder.RHICmdList.CreateShaderResourceView(
+		ViewIndirectDraw.VisiblePatchList->GetRHI(),
+		FRHIViewDesc::CreateBufferSRV()
+			.SetType(FRHIViewDesc::EBufferType::Structured)
+	);
+}
+
+const FGPUTessellationViewIndirectDraw* FGPUTessellationSceneProxy::FindViewIndirectDraw(const FSceneView* View, uint32 FrameNumber) const
+{
+	return ViewIndirectDraws.FindByPredicate([View, FrameNumber](const FGPUTessellationViewIndirectDraw& ViewIndirectDraw)
+	{
+		return ViewIndirectDraw.View == View && ViewIndirectDraw.FrameNumber == FrameNumber;
+	});
+}
+
+void FGPUTessellationSceneProxy::PollIndirectPatchStats_RenderThread()
+{
+	// Backwards, so a finished readback can be swapped out without skipping one
+	for (int32 Index = IndirectStatsReadbacks.Num() - 1; Index >= 0; --Index)
+	{
+		FGPUTessellationIndirectStatsReadback& StatsReadback = IndirectStatsReadbacks[Index];
+		if (!StatsReadback.Readback->IsReady())
+		{
+			continue;
+		}
+		
+		const uint32 NumBytes = StatsReadback.NumLODs * sizeof(FRHIDrawIndexedIndirectParameters);
+		const FRHIDrawIndexedIndirectParameters* Args = static_cast<const FRHIDrawIndexedIndirectParameters*>(StatsReadback.Readback->Lock(NumBytes));
+		int32 VisiblePatches = 0;
+		for (int32 LODIndex = 0; LODIndex < StatsReadback.NumLODs; ++LODIndex)
+		{
+			VisiblePatches += Args[LODIndex].InstanceCount;
+		}
+		StatsReadback.Readback->Unlock();
+		
+		GPUTESSELLATION_INC_COUNTER(STAT_GPUTessellation_IndirectPatchesVisible, IndirectPatchesVisible, VisiblePatches);
+		GPUTESSELLATION_INC_COUNTER(STAT_GPUTessellation_IndirectPatchesCulled, IndirectPatchesCulled, StatsReadback.NumPatches - VisiblePatches);
+		IndirectStatsReadbacks.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	}
+}
+
+FGPUTessellationPatchRenderSet::FGPUTessellationPatchRenderSet(ERHIFeatureLevel::Type InFeatureLevel)
+	: BatchedVertexFactory(InFeatureLevel)
+	, IndirectVertexFactory(InFeatureLevel)
+	, FeatureLevel(InFeatureLevel)
+{
+}
+
+FGPUTessellationPatchRenderSet::~FGPUTessellationPatchRenderSet()
+{
+	Reset();
+}
+
+void FGPUTessellationPatchRenderSet::Reset()
+{
+	// Release and delete all patch vertex factories
+	for (FGPUTessellationVertexFactory* VF : PatchVertexFactories)
+	{
+		if (VF)
+		{
+			if (VF->IsInitialized())
+			{
+				VF->ReleaseResource();
+			}
+			delete VF;
+		}
+	}
+	PatchVertexFactories.Empty();
+	
+	if (BatchedVertexFactory.IsInitialized())
+	{
+		BatchedVertexFactory.ReleaseResource();
+	}
+	if (IndirectVertexFactory.IsInitialized())
+	{
+		IndirectVertexFactory.ReleaseResource();
+	}
+	
+	Buffers.Reset();
+	ReportedPatchErrors.Empty();
+}
+
+bool FGPUTessellationPatchRenderSet::MarkPatchErrorReported(int32 PatchIndex) const
+{
+	if (ReportedPatchErrors.Num() <= PatchIndex)
+	{
+		ReportedPatchErrors.Add(false, PatchIndex + 1 - ReportedPatchErrors.Num());
+	}
+	if (ReportedPatchErrors[PatchIndex])
+	{
+		return false;
+	}
+	ReportedPatchErrors[PatchIndex] = true;
+	return true;
+}
+
+void FGPUTessellationPatchRenderSet::InitVertexFactories(FRHICommandListImmediate& RHICmdList)
+{
+	GPUTESSELLATION_SCOPE_CYCLE_COUNTER(STAT_GPUTessellation_VertexFactoryInit, VertexFactoryInit);
+	
+	int32 TotalPatches = Buffers.GetTotalPatchCount();
+	
+	// Indirect patches instance the LOD grids through one factory over the shared buffers
+	if (Buffers.bIndirect)
+	{
+		if (Buffers.SharedBuffers.IsValid() && Buffers.IndirectDraw.IsValid())
+		{
+			IndirectVertexFactory.SetBuffers(
+				Buffers.SharedBuffers.PositionSRV,
+				Buffers.SharedBuffers.NormalSRV,
+				Buffers.SharedBuffers.UVSRV
+			);
+			IndirectVertexFactory.SetPatchBuffers(
+				Buffers.IndirectDraw.PatchDescriptorSRV,
+				Buffers.IndirectDraw.VisiblePatchListSRV
+			);
+			if (!IndirectVertexFactory.IsInitialized())
+			{
+				IndirectVertexFactory.InitResource(RHICmdList);
+			}
+		}
+		return;
+	}
+	
+	// Batched patches all render through one factory over the shared buffers
+	if (Buffers.bBatched)
+	{
+		if (Buffers.SharedBuffers.IsValid())
+		{
+			BatchedVertexFactory.SetBuffers(
+				Buffers.SharedBuffers.PositionSRV,
+				Buffers.SharedBuffers.NormalSRV,
+				Buffers.SharedBuffers.UVSRV
+			);
+			if (!BatchedVertexFactory.IsInitialized())
+			{
+				BatchedVertexFactory.InitResource(RHICmdList);
+			}
+		}
+		return;
+	}
+	
+	// Allocate new factories
+	PatchVertexFactories.Reserve(TotalPatches);
+	
+	// Create and initialize each factory
+	for (int32 i = 0; i < TotalPatches; ++i)
+	{
+		if (Buffers.PatchBuffers[i].IsValid())
+		{
+			FGPUTessellationVertexFactory* VF = new FGPUTessellationVertexFactory(FeatureLevel);
+			VF->SetBuffers(
+				Buffers.PatchBuffers[i].PositionSRV,
+				Buffers.PatchBuffers[i].NormalSRV,
+				Buffers.PatchBuffers[i].UVSRV
+			);
+			VF->InitResource(RHICmdList);
+			PatchVertexFactories.Add(VF);
+		}
+		else
+		{
+			PatchVertexFactories.Add(nullptr);
+		}
+	}
+}
+
+void FGPUTessellationSceneProxy::UpdateDynamicData_RenderThread(FRHICommandListImmediate& RHICmdList, FGPUTessellationDynamicData* DynamicData)
+{
+	check(IsInRenderingThread());
+	
+	if (!DynamicData || !bUsePatchMode)
 	{
 		delete DynamicData;
 		return;
@@ -664,54 +1231,438 @@ void FGPUTessellationSceneProxy::UpdateDynamicData_RenderThread(FGPUTessellation
 	
 	// PROPER SOLUTION: Regenerate patches with updated camera position
 	// This is called from SendRenderDynamicData_Concurrent, NOT during GetDynamicMeshElements
-	// So we can safely create an RDGBuilder here!
 	
 	FVector CameraPosition = DynamicData->CameraPosition;
 	FMatrix ComponentTransform = DynamicData->LocalToWorld;
 	delete DynamicData;
 	
+	UE_LOG(LogGPUTessellation, Verbose, TEXT("GPUTessellation: UpdateDynamicData - Regenerating patches with camera at: %s"), 
+		*CameraPosition.ToString());
+	
+	// Queue the regeneration; the front set keeps rendering until the back set is complete
+	// The passes are recorded with the world's regeneration batch (or right away when batching is off)
+	RequestPatchRegeneration_RenderThread(CameraPosition, ComponentTransform, EGPUTessellationRegenerationTrigger::CameraMoved);
+	
+	// A fill already in progress queues its next step itself (or is advanced by the component tick when unbatched)
+	if (!bBackSetInProgress)
+	{
+		AdvancePatchRegeneration_RenderThread(RHICmdList);
+	}
+}
+
+void FGPUTessellationSceneProxy::RefreshMeshBuffers_RenderThread(
+	FRHICommandListImmediate& RHICmdList,
+	const FGPUTessellationSettings& NewSettings,
+	int32 LODTessellationFactor,
+	const FMatrix& LocalToWorld,
+	const FVector& CameraPosition,
+	UTexture* DisplacementTexture,
+	UTexture* SubtractTexture,
+	UTexture* NormalMapTexture,
+	EGPUTessellationRegenerationTrigger Trigger,
+	TConstArrayView<FBox2f> DirtyUVRegions)
+{
+	check(IsInRenderingThread());
+	check(FGPUTessellationProxyLayout::Make(NewSettings, LODTessellationFactor) == Layout);
+	
+	Settings = NewSettings;
+	CachedLocalToWorld = LocalToWorld;
+	CachedDisplacementTexture = DisplacementTexture;
+	CachedSubtractTexture = SubtractTexture;
+	CachedNormalMapTexture = NormalMapTexture;
+	
+	if (bUsePatchMode)
+	{
+		// The front set keeps rendering until the regenerated back set swaps in
+		RequestPatchRegeneration_RenderThread(CameraPosition, LocalToWorld, Trigger);
+		if (!bBackSetInProgress)
+		{
+			AdvancePatchRegeneration_RenderThread(RHICmdList);
+		}
+		return;
+	}
+	
+	FGPUTessellationSettings EffectiveSettings = Settings;
+	if (Settings.LODMode != EGPUTessellationLODMode::Disabled)
+	{
+		EffectiveSettings.TessellationFactor = LODTessellationFactor;
+	}
+	
+	RequestMeshRegeneration_RenderThread(RHICmdList, EffectiveSettings, LocalToWorld, CameraPosition, Trigger, false, DirtyUVRegions);
+}
+
+void FGPUTessellationSceneProxy::RequestMeshRegeneration_RenderThread(
+	FRHICommandListImmediate& RHICmdList,
+	const FGPUTessellationSettings& EffectiveSettings,
+	const FMatrix& LocalToWorld,
+	const FVector& CameraPosition,
+	EGPUTessellationRegenerationTrigger Trigger,
+	bool bFullGeneration,
+	TConstArrayView<FBox2f> DirtyUVRegions)
+{
+	check(IsInRenderingThread());
+	
+	// A request still waiting for the flush is merged: a full generation absorbs refreshes, and a whole mesh
+	// refresh absorbs dirty regions. The latest settings, transform and trigger win.
+	if (!bHasQueuedMeshRegeneration)
+	{
+		QueuedDirtyUVRegions = DirtyUVRegions;
+		bQueuedFullGeneration = bFullGeneration;
+		bQueuedContentChanged = false;
+	}
+	else
+	{
+		if (QueuedDirtyUVRegions.Num() > 0 && DirtyUVRegions.Num() > 0)
+		{
+			QueuedDirtyUVRegions.Append(DirtyUVRegions.GetData(), DirtyUVRegions.Num());
+		}
+		else
+		{
+			QueuedDirtyUVRegions.Reset();
+		}
+		bQueuedFullGeneration |= bFullGeneration;
+	}
+	
+	bHasQueuedMeshRegeneration = true;
+	bQueuedContentChanged |= Trigger == EGPUTessellationRegenerationTrigger::RenderTarget || Trigger == EGPUTessellationRegenerationTrigger::DisplacementRegion;
+	bTextureContentsModified |= bQueuedContentChanged;
+	QueuedMeshSettings = EffectiveSettings;
+	QueuedLocalToWorld = LocalToWorld;
+	QueuedCameraPosition = CameraPosition;
+	QueuedTrigger = Trigger;
+	
+	QueueRegeneration_RenderThread(RHICmdList);
+}
+
+void FGPUTessellationSceneProxy::QueueRegeneration_RenderThread(FRHICommandListImmediate& RHICmdList)
+{
+	check(IsInRenderingThread());
+	
+	if (RegenerationBatch.IsValid() && FGPUTessellationRegenerationBatch::IsEnabled_RenderThread())
+	{
+		RegenerationBatch->Add_RenderThread(this);
+	}
+	else
+	{
+		// A proxy already batched must not run twice; the flush will pick it up
+		if (!bRegenerationBatched)
+		{
+			FGPUTessellationSceneProxy* Proxy = this;
+			FGPUTessellationRegenerationBatch::Execute_RenderThread(RHICmdList, MakeArrayView(&Proxy, 1));
+		}
+	}
+}
+
+void FGPUTessellationSceneProxy::AddRegenerationPasses_RenderThread(FRDGBuilder& GraphBuilder)
+{
+	check(IsInRenderingThread());
+	
+	bMeshGenerationRecorded = false;
+	bPatchStepRecorded = false;
+	bPatchStepCompletesBackSet = false;
+	
+	if (bUsePatchMode)
+	{
+		AddPatchRegenerationPasses_RenderThread(GraphBuilder);
+		return;
+	}
+	
+	if (!bHasQueuedMeshRegeneration)
+	{
+		return;
+	}
+	
+	FGPUTessellationMeshBuilder MeshBuilder;
+	GPUTESSELLATION_TRACE_REGENERATION(RegenerationTrace, *this, QueuedTrigger, MeshBuilder);
+	
+	FGPUTessellationMeshCache& MeshCache = FGPUTessellationMeshCache::Get();
+	FGPUTessellationMeshKey Key;
+	const bool bHasKey = MeshCache.MakeKey(QueuedMeshSettings, CachedDisplacementTexture.Get(), CachedSubtractTexture.Get(),
+		CachedNormalMapTexture.Get(), Key);
+	
+	// A mesh cached from the old texture contents must not be adopted again; partial refreshes are never shared
+	if (bHasKey && bQueuedContentChanged)
+	{
+		MeshCache.Evict(Key);
+	}
+	const bool bCacheable = bHasKey && QueuedDirtyUVRegions.Num() == 0;
+	
+	TSharedPtr<FGPUTessellationCachedMesh> CachedMesh = bCacheable ? MeshCache.Find(Key) : nullptr;
+	if (CachedMesh.IsValid())
+	{
+		// An identical mesh exists, possibly generated earlier in this graph; nothing to record
+		if (CachedMesh != SingleMesh)
+		{
+			PendingSingleMesh = MoveTemp(CachedMesh);
+			bMeshGenerationRecorded = true;
+		}
+		
+		if (bEnableDebugLogging)
+		{
+			UE_LOG(LogGPUTessellation, Log, TEXT("GPUTessellation: Mesh cache hit - Key:%08x Adopted:%d"), Key.Hash, bMeshGenerationRecorded);
+		}
+	}
+	else if (bQueuedFullGeneration || !SingleMesh.IsValid() || !SingleMesh.IsUnique())
+	{
+		// Content generated by an earlier run is uploaded from disk instead; new content is stored once read back
+		FGPUTessellationDiskCacheKey DiskCacheKey;
+		const bool bHasDiskCacheKey = !bTextureContentsModified && FGPUTessellationDiskCache::MakeKey(QueuedMeshSettings,
+			CachedDisplacementTexture.Get(), CachedSubtractTexture.Get(), CachedNormalMapTexture.Get(), DiskCacheKey);
+		if (!bHasDiskCacheKey)
+		{
+			DiskCacheLoad.Reset();
+		}
+		else if (!DiskCacheLoad.IsValid() || DiskCacheLoad->GetKey().Hash != DiskCacheKey.Hash)
+		{
+			DiskCacheLoad = FGPUTessellationDiskCache::BeginLoad(DiskCacheKey, QueuedMeshSettings);
+		}
+		
+		// The entry is read off the render thread; the request stays queued for a later flush while the current mesh, if
+		// any, keeps rendering. Without a batch to wait in, or once the read takes too long, the mesh is generated instead.
+		const bool bCanWait = RegenerationBatch.IsValid() && FGPUTessellationRegenerationBatch::IsEnabled_RenderThread();
+		if (DiskCacheLoad.IsValid() && !DiskCacheLoad->IsComplete() && !DiskCacheLoad->IsOverdue() && bCanWait)
+		{
+			bWaitingForDiskCache = true;
+			return;
+		}
+		
+		// Buffers shared with other proxies are never written; this proxy generates its own instead
+		PendingSingleMesh = MakeShared<FGPUTessellationCachedMesh>(GetScene().GetFeatureLevel());
+		
+		const bool bLoadedFromDisk = DiskCacheLoad.IsValid() && DiskCacheLoad->IsHit();
+		if (bLoadedFromDisk)
+		{
+			FGPUTessellationDiskCache::UploadMesh(GraphBuilder, MeshBuilder, *DiskCacheLoad, PendingSingleMesh->Buffers);
+		}
+		else
+		{
+			MeshBuilder.ExecuteTessellationPipeline(GraphBuilder, QueuedMeshSettings, QueuedLocalToWorld, QueuedCameraPosition,
+				CachedDisplacementTexture.Get(), CachedSubtractTexture.Get(), CachedNormalMapTexture.Get(), PendingSingleMesh->Buffers);
+			if (bHasDiskCacheKey)
+			{
+				FGPUTessellationDiskCache::StoreMesh(GraphBuilder, MeshBuilder, DiskCacheKey, QueuedMeshSettings, PendingSingleMesh->Buffers);
+			}
+		}
+		
+		if (bEnableDebugLogging && bHasDiskCacheKey)
+		{
+			UE_LOG(LogGPUTessellation, Log, TEXT("GPUTessellation: Disk cache %s - Key:%s"),
+				bLoadedFromDisk ? TEXT("hit") : DiskCacheLoad->IsComplete() ? TEXT("miss") : TEXT("load overdue"), *DiskCacheKey.Hash.ToString());
+		}
+		DiskCacheLoad.Reset();
+		
+		if (bCacheable)
+		{
+			MeshCache.Register(PendingSingleMesh, Key);
+		}
+		bMeshGenerationRecorded = true;
+	}
+	else
+	{
+		// The contents are about to change, so nobody may adopt the mesh under its old key
+		MeshCache.Unregister(*SingleMesh);
+		
+		FGPUTessellationBuffers& GPUBuffers = SingleMesh->Buffers;
+		const bool bRefreshed = MeshBuilder.RefreshTessellationPipeline(GraphBuilder, QueuedMeshSettings, QueuedLocalToWorld,
+			CachedDisplacementTexture.Get(), CachedSubtractTexture.Get(), CachedNormalMapTexture.Get(), GPUBuffers, QueuedDirtyUVRegions);
+		if (bRefreshed && bCacheable)
+		{
+			MeshCache.Register(SingleMesh, Key);
+		}
+		
+		if (bEnableDebugLogging)
+		{
+			UE_LOG(LogGPUTessellation, Log, TEXT("GPUTessellation: In-place refresh - Refreshed:%d Resolution:%dx%d DirtyRegions:%d"),
+				bRefreshed, GPUBuffers.ResolutionX, GPUBuffers.ResolutionY, QueuedDirtyUVRegions.Num());
+		}
+	}
+	
+	bHasQueuedMeshRegeneration = false;
+	bQueuedFullGeneration = false;
+	bQueuedContentChanged = false;
+	QueuedDirtyUVRegions.Reset();
+}
+
+void FGPUTessellationSceneProxy::FinishRegeneration_RenderThread(FRHICommandListImmediate& RHICmdList)
+{
+	check(IsInRenderingThread());
+	
+	if (bPatchStepRecorded)
+	{
+		FinishPatchRegeneration_RenderThread(RHICmdList);
+	}
+	
+	if (bWaitingForDiskCache)
+	{
+		// The flush already took this proxy off the batch, so the request is retried in the next one
+		bWaitingForDiskCache = false;
+		RegenerationBatch->Add_RenderThread(this);
+	}
+	
+	if (!bMeshGenerationRecorded)
+	{
+		return;
+	}
+	bMeshGenerationRecorded = false;
+	
+	// The previous mesh is released once the vertex factory no longer points at it
+	TSharedPtr<FGPUTessellationCachedMesh> PreviousMesh = SingleMesh;
+	SetSingleMesh_RenderThread(MoveTemp(PendingSingleMesh));
+	const FGPUTessellationBuffers& GPUBuffers = SingleMesh->Buffers;
+	
 	if (bEnableDebugLogging)
 	{
-		static double LastUpdateLogTime = 0.0;
-		double CurrentTime = FPlatformTime::Seconds();
-		if (CurrentTime - LastUpdateLogTime >= 2.0)
+		UE_LOG(LogGPUTessellation, Log, TEXT("GPUTessellation: After Execute - VertexCount:%d IndexCount:%d PositionBuffer:%d NormalBuffer:%d"),
+			GPUBuffers.VertexCount, GPUBuffers.IndexCount, 
+			GPUBuffers.PositionBuffer.IsValid(), GPUBuffers.NormalBuffer.IsValid());
+	}
+	
+	UpdateBufferMemoryStats_RenderThread();
+	
+	// Initialize vertex factory if buffers are valid
+	if (GPUBuffers.IsValid())
+	{
+		bMeshValid = true;
+		VertexFactory.SetBuffers(GPUBuffers.PositionSRV, GPUBuffers.NormalSRV, GPUBuffers.UVSRV);
+		GPUTESSELLATION_SCOPE_CYCLE_COUNTER(STAT_GPUTessellation_VertexFactoryInit, VertexFactoryInit);
+		VertexFactory.InitResource(RHICmdList);
+		
+		// Once per mesh, by whichever of its proxies finishes first
+		FGPUTessellationInstancedVertexFactory& InstancedVertexFactory = SingleMesh->InstancedVertexFactory;
+		if (!InstancedVertexFactory.IsInitialized())
 		{
-			LastUpdateLogTime = CurrentTime;
-			UE_LOG(LogTemp, Warning, TEXT("GPUTessellation: UpdateDynamicData - Regenerating patches with camera at: %s"), 
-				*CameraPosition.ToString());
+			InstancedVertexFactory.SetBuffers(GPUBuffers.PositionSRV, GPUBuffers.NormalSRV, GPUBuffers.UVSRV);
+			InstancedVertexFactory.InitResource(RHICmdList);
+		}
+		
+		if (bEnableDebugLogging)
+		{
+			UE_LOG(LogGPUTessellation, Log, TEXT("GPUTessellation: Mesh initialized - %d vertices, %d indices, Resolution: %dx%d"), 
+				GPUBuffers.VertexCount, GPUBuffers.IndexCount, GPUBuffers.ResolutionX, GPUBuffers.ResolutionY);
 		}
 	}
+	else
+	{
+		UE_LOG(LogGPUTessellation, Error, TEXT("GPUTessellation: Failed to initialize - buffers invalid"));
+	}
+	
+	PreviousMesh.Reset();
+	FGPUTessellationMeshCache::Get().UpdateStats();
+}
+
+void FGPUTessellationSceneProxy::RequestPatchRegeneration_RenderThread(const FVector& CameraPosition, const FMatrix& LocalToWorld, EGPUTessellationRegenerationTrigger Trigger)
+{
+	check(IsInRenderingThread());
+	
+	// Latest request wins; a fill already in progress finishes first
+	bHasQueuedRegeneration = true;
+	QueuedCameraPosition = CameraPosition;
+	QueuedLocalToWorld = LocalToWorld;
+	QueuedTrigger = Trigger;
+	bPatchRegenerationPending.store(true, std::memory_order_relaxed);
+}
+
+void FGPUTessellationSceneProxy::AdvancePatchRegeneration_RenderThread(FRHICommandListImmediate& RHICmdList)
+{
+	check(IsInRenderingThread());
+	
+	if (!bBackSetInProgress && !bHasQueuedRegeneration)
+	{
+		bPatchRegenerationPending.store(false, std::memory_order_relaxed);
+		return;
+	}
+	
+	QueueRegeneration_RenderThread(RHICmdList);
+}
+
+void FGPUTessellationSceneProxy::AddPatchRegenerationPasses_RenderThread(FRDGBuilder& GraphBuilder)
+{
+	check(IsInRenderingThread());
+	
+	if (!bBackSetInProgress && !bHasQueuedRegeneration)
+	{
+		return;
+	}
+	
+	const int32 BackIndex = 1 - FrontPatchSetIndex.load(std::memory_order_relaxed);
+	FGPUTessellationPatchRenderSet& BackSet = *PatchSets[BackIndex];
+	FGPUTessellationMeshBuilder MeshBuilder;
+	
+	// Every step of a fill spread over several frames is traced with the trigger that started it
+	GPUTESSELLATION_TRACE_REGENERATION(RegenerationTrace, *this, bBackSetInProgress ? BackSetTrigger : QueuedTrigger, MeshBuilder);
+	
+	if (!bBackSetInProgress)
+	{
+		// The back set is not rendered, so its previous contents can go right away
+		BackSet.Reset();
+		MeshBuilder.PreparePatchGeneration(
+			Settings,
+			QueuedLocalToWorld,
+			QueuedCameraPosition,
+			nullptr,  // ViewFrustum - could pass from component if needed
+			Settings.PatchCountX,
+			Settings.PatchCountY,
+			BackSet.Buffers);
+		
+		BackSetLocalToWorld = QueuedLocalToWorld;
+		BackSetTrigger = QueuedTrigger;
+		bHasQueuedRegeneration = false;
+		bBackSetInProgress = true;
+	}
 	
-	// Enqueue render command to regenerate patches
-	// This is SAFE because we're not inside GetDynamicMeshElements!
-	FGPUTessellationSceneProxy* SceneProxy = this;
-	ENQUEUE_RENDER_COMMAND(UpdatePatchesWithCamera)(
-		[SceneProxy, CameraPosition, ComponentTransform](FRHICommandListImmediate& RHICmdList)
+	RegenerationTrace.SetTotalPatches(BackSet.Buffers.GetTotalPatchCount());
+	
+	bPatchStepCompletesBackSet = MeshBuilder.GeneratePendingPatches(
+		GraphBuilder,
+		Settings,
+		BackSetLocalToWorld,
+		nullptr,
+		CachedDisplacementTexture.Get(),
+		CachedSubtractTexture.Get(),
+		CachedNormalMapTexture.Get(),
+		FMath::Max(0, CVarGPUTessellationPatchesPerFrame.GetValueOnRenderThread()),
+		BackSet.Buffers);
+	bPatchStepRecorded = true;
+}
+
+void FGPUTessellationSceneProxy::FinishPatchRegeneration_RenderThread(FRHICommandListImmediate& RHICmdList)
+{
+	check(IsInRenderingThread());
+	
+	bPatchStepRecorded = false;
+	if (bPatchStepCompletesBackSet)
+	{
+		const int32 BackIndex = 1 - FrontPatchSetIndex.load(std::memory_order_relaxed);
+		FGPUTessellationPatchRenderSet& BackSet = *PatchSets[BackIndex];
+		
+		// Swap: later frames draw the new set, the old front set becomes the next back set
+		BackSet.InitVertexFactories(RHICmdList);
+		FrontPatchSetIndex.store(BackIndex, std::memory_order_release);
+		bBackSetInProgress = false;
+		bMeshValid = BackSet.Buffers.IsValid();
+		
+		// Every view of the world culls indirect patches before it gathers them
+		if (RegenerationBatch.IsValid() && BackSet.Buffers.bIndirect)
 		{
-			FGPUTessellationMeshBuilder MeshBuilder;
-			FRDGBuilder GraphBuilder(RHICmdList);
-			
-			// Execute patch tessellation pipeline with updated camera position
-			MeshBuilder.ExecutePatchTessellationPipeline(
-				GraphBuilder,
-				SceneProxy->Settings,
-				ComponentTransform,
-				CameraPosition,  // Updated camera position from component!
-				nullptr,  // ViewFrustum - could pass from component if needed
-				SceneProxy->Settings.PatchCountX,
-				SceneProxy->Settings.PatchCountY,
-				SceneProxy->CachedDisplacementTexture.Get(),
-				SceneProxy->CachedSubtractTexture.Get(),
-				SceneProxy->CachedNormalMapTexture.Get(),
-				SceneProxy->GPUPatchBuffers
-			);
-			
-			GraphBuilder.Execute();
-			
-			// Reinitialize vertex factories
-			SceneProxy->InitializePatchVertexFactories(RHICmdList);
-			SceneProxy->bMeshValid = SceneProxy->GPUPatchBuffers.IsValid();
-		});
+			RegenerationBatch->AddIndirectPatchProxy_RenderThread(this);
+		}
+		
+		if (bEnableDebugLogging)
+		{
+			UE_LOG(LogGPUTessellation, Log, TEXT("GPUTessellation: Patch set %d swapped to front - Valid:%d"), BackIndex, bMeshValid);
+		}
+	}
+	
+	UpdateBufferMemoryStats_RenderThread();
+	
+	const bool bStillPending = bBackSetInProgress || bHasQueuedRegeneration;
+	bPatchRegenerationPending.store(bStillPending, std::memory_order_relaxed);
+	
+	// The next step goes into the next flush, so the fill continues while the component's tick sleeps
+	if (bStillPending && RegenerationBatch.IsValid() && FGPUTessellationRegenerationBatch::IsEnabled_RenderThread())
+	{
+		RegenerationBatch->Add_RenderThread(this);
+	}
 }
 
 FPrimitiveViewRelevance FGPUTessellationSceneProxy::GetViewRelevance(const FSceneView* View) const
@@ -729,12 +1680,11 @@ FPrimitiveViewRelevance FGPUTessellationSceneProxy::GetViewRelevance(const FScen
 	
 	if (bEnableDebugLogging)
 	{
-		static bool bLoggedRelevance = false;
-		if (!bLoggedRelevance && bMeshValid)
+		if (!bLoggedViewRelevance && bMeshValid)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("GPUTessellation: GetViewRelevance - Draw:%d Shadow:%d Dynamic:%d RenderInMain:%d"), 
+			UE_LOG(LogGPUTessellation, Log, TEXT("GPUTessellation: GetViewRelevance - Draw:%d Shadow:%d Dynamic:%d RenderInMain:%d"), 
 				Result.bDrawRelevance, Result.bShadowRelevance, Result.bDynamicRelevance, Result.bRenderInMainPass);
-			bLoggedRelevance = true;
+			bLoggedViewRelevance = true;
 		}
 	}
 
@@ -745,13 +1695,17 @@ void FGPUTessellationSceneProxy::UpdateMeshBuffers_RenderThread(const FGPUTessel
 {
 	check(IsInRenderingThread());
 
-	GPUBuffers = Buffers;
-	bMeshValid = GPUBuffers.IsValid();
+	// Buffers handed in from outside belong to this proxy alone
+	SetSingleMesh_RenderThread(MakeShared<FGPUTessellationCachedMesh>(GetScene().GetFeatureLevel()));
+	SingleMesh->Buffers = Buffers;
+	bMeshValid = SingleMesh->Buffers.IsValid();
+	UpdateBufferMemoryStats_RenderThread();
+	FGPUTessellationMeshCache::Get().UpdateStats();
 
 	if (bMeshValid)
 	{
 		// Update vertex factory with new buffers
-		VertexFactory.SetBuffers(GPUBuffers.PositionSRV, GPUBuffers.NormalSRV, GPUBuffers.UVSRV);
+		VertexFactory.SetBuffers(SingleMesh->Buffers.PositionSRV, SingleMesh->Buffers.NormalSRV, SingleMesh->Buffers.UVSRV);
 	}
 	
 	// Pure GPU - no CPU buffer uploads!
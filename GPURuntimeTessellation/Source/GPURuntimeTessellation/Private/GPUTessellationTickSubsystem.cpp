@@ -0,0 +1,143 @@
+// Licensed under the MIT License. See LICENSE file in the project root.
+
+#include "GPUTessellationTickSubsystem.h"
+#include "GPUTessellationComponent.h"
+#include "GPUTessellationViewSubsystem.h"
+#include "GPUTessellationStats.h"
+#include "GPUTessellationLog.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarGPUTessellationSleepWhenIdle(
+	TEXT("r.GPUTessellation.SleepWhenIdle"),
+	1,
+	TEXT("Let tessellation components disable their tick while nothing can change their mesh.\n")
+	TEXT(" 0: every component ticks every frame\n")
+	TEXT(" 1: idle components sleep until a view crosses a LOD band or a setter, notification or move wakes them (default)"),
+	ECVF_Default);
+
+void UGPUTessellationTickSubsystem::Deinitialize()
+{
+	WakeAll();
+
+	Super::Deinitialize();
+}
+
+void UGPUTessellationTickSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	SET_DWORD_STAT(STAT_GPUTessellation_SleepingComponents, SleepingComponents.Num());
+	if (SleepingComponents.Num() == 0)
+	{
+		return;
+	}
+
+	// Sleeping was switched off; the components decide again on their next tick
+	if (!IsSleepEnabled())
+	{
+		WakeAll();
+		return;
+	}
+
+	const UGPUTessellationViewSubsystem* ViewSubsystem = GetWorld()->GetSubsystem<UGPUTessellationViewSubsystem>();
+	if (!ViewSubsystem)
+	{
+		return;
+	}
+
+	GPUTESSELLATION_SCOPE_CYCLE_COUNTER(STAT_GPUTessellation_WakeCheck, WakeCheck);
+
+	// Backwards, so a woken component can be swapped out without skipping one
+	int32 WokenCount = 0;
+	for (int32 Index = SleepingComponents.Num() - 1; Index >= 0; --Index)
+	{
+		const FSleepingComponent& Sleeping = SleepingComponents[Index];
+		UGPUTessellationComponent* Component = Sleeping.Component.Get();
+		if (Component)
+		{
+			// Same view the component's LOD is evaluated against
+			const FGPUTessellationView* View = ViewSubsystem->FindNearestView(Component->Bounds.Origin);
+			if (!View || (Sleeping.bHasView && FVector::DistSquared(View->Location, Sleeping.WakeLocation) <= Sleeping.WakeRadiusSquared))
+			{
+				continue;
+			}
+		}
+
+		SleepingComponents.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+		if (Component)
+		{
+			Component->bTickSleepRegistered = false;
+			Component->WakeTick();
+			++WokenCount;
+		}
+	}
+
+	if (WokenCount > 0)
+	{
+		GPUTESSELLATION_INC_COUNTER(STAT_GPUTessellation_WokenComponents, WokenComponents, WokenCount);
+		UE_LOG(LogGPUTessellation, VeryVerbose, TEXT("GPUTessellation: Woke %d components, %d still sleeping"), WokenCount, SleepingComponents.Num());
+	}
+}
+
+TStatId UGPUTessellationTickSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UGPUTessellationTickSubsystem, STATGROUP_Tickables);
+}
+
+void UGPUTessellationTickSubsystem::AddSleepingComponent(UGPUTessellationComponent* Component, const FVector& WakeLocation, float WakeRadius, bool bHasView)
+{
+	check(IsInGameThread());
+
+	if (Component->bTickSleepRegistered)
+	{
+		RemoveSleepingComponent(Component);
+	}
+
+	FSleepingComponent& Sleeping = SleepingComponents.AddDefaulted_GetRef();
+	Sleeping.Component = Component;
+	Sleeping.WakeLocation = WakeLocation;
+	Sleeping.WakeRadiusSquared = FMath::Square((double)WakeRadius);
+	Sleeping.bHasView = bHasView;
+	Component->bTickSleepRegistered = true;
+}
+
+void UGPUTessellationTickSubsystem::RemoveSleepingComponent(UGPUTessellationComponent* Component)
+{
+	check(IsInGameThread());
+
+	if (!Component->bTickSleepRegistered)
+	{
+		return;
+	}
+	Component->bTickSleepRegistered = false;
+
+	const int32 Index = SleepingComponents.IndexOfByPredicate([Component](const FSleepingComponent& Sleeping)
+	{
+		return Sleeping.Component.Get() == Component;
+	});
+	if (Index != INDEX_NONE)
+	{
+		SleepingComponents.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	}
+}
+
+bool UGPUTessellationTickSubsystem::IsSleepEnabled()
+{
+	return CVarGPUTessellationSleepWhenIdle.GetValueOnGameThread() != 0;
+}
+
+void UGPUTessellationTickSubsystem::WakeAll()
+{
+	TArray<FSleepingComponent> Sleepers = MoveTemp(SleepingComponents);
+	SleepingComponents.Reset();
+
+	for (const FSleepingComponent& Sleeping : Sleepers)
+	{
+		if (UGPUTessellationComponent* Component = Sleeping.Component.Get())
+		{
+			Component->bTickSleepRegistered = false;
+			Component->WakeTick();
+		}
+	}
+}
@@ -0,0 +1,220 @@
+// Licensed under the MIT License. See LICENSE file in the project root.
+
+#include "GPUTessellationTrace.h"
+#include "GPUTessellationMeshBuilder.h"
+#include "GPUTessellationLog.h"
+#include "PrimitiveSceneProxy.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeLock.h"
+#include "ProfilingDebugging/MiscTrace.h"
+
+const TCHAR* LexToString(EGPUTessellationRegenerationTrigger Trigger)
+{
+	switch (Trigger)
+	{
+		case EGPUTessellationRegenerationTrigger::ProxyRecreated: return TEXT("ProxyRecreated");
+		case EGPUTessellationRegenerationTrigger::Explicit: return TEXT("Explicit");
+		case EGPUTessellationRegenerationTrigger::SettingsChanged: return TEXT("SettingsChanged");
+		case EGPUTessellationRegenerationTrigger::PropertyEdit: return TEXT("PropertyEdit");
+		case EGPUTessellationRegenerationTrigger::MaterialChanged: return TEXT("MaterialChanged");
+		case EGPUTessellationRegenerationTrigger::LODChanged: return TEXT("LODChanged");
+		case EGPUTessellationRegenerationTrigger::CameraMoved: return TEXT("CameraMoved");
+		case EGPUTessellationRegenerationTrigger::RenderTarget: return TEXT("RenderTarget");
+		case EGPUTessellationRegenerationTrigger::DisplacementRegion: return TEXT("DisplacementRegion");
+		case EGPUTessellationRegenerationTrigger::Budget: return TEXT("Budget");
+		default: return TEXT("Unknown");
+	}
+}
+
+#if GPUTESSELLATION_TRACE_ENABLED
+
+UE_TRACE_CHANNEL_DEFINE(GPUTessellationChannel);
+
+UE_TRACE_EVENT_BEGIN(GPUTessellation, Regeneration)
+	UE_TRACE_EVENT_FIELD(uint64, StartCycle)
+	UE_TRACE_EVENT_FIELD(uint64, EndCycle)
+	UE_TRACE_EVENT_FIELD(uint32, ComponentId)
+	UE_TRACE_EVENT_FIELD(uint8, Trigger)
+	UE_TRACE_EVENT_FIELD(uint32, TotalPatches)
+	UE_TRACE_EVENT_FIELD(uint32, GeneratedPatches)
+	UE_TRACE_EVENT_FIELD(uint32, CulledPatches)
+	UE_TRACE_EVENT_FIELD(uint16, VertexGenerationPasses)
+	UE_TRACE_EVENT_FIELD(uint16, DisplacementPasses)
+	UE_TRACE_EVENT_FIELD(uint16, NormalPasses)
+	UE_TRACE_EVENT_FIELD(uint16, TangentPasses)
+	UE_TRACE_EVENT_FIELD(uint16, IndexPasses)
+	UE_TRACE_EVENT_FIELD(uint16, CullingPasses)
+	UE_TRACE_EVENT_FIELD(uint16, OtherPasses)
+	UE_TRACE_EVENT_FIELD(uint32, VertexCount)
+	UE_TRACE_EVENT_FIELD(uint32, IndexCount)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, ComponentName)
+UE_TRACE_EVENT_END()
+
+#endif // GPUTESSELLATION_TRACE_ENABLED
+
+#if GPUTESSELLATION_REGENERATION_HISTORY
+
+static TAutoConsoleVariable<int32> CVarGPUTessellationRegenerationHistory(
+	TEXT("r.GPUTessellation.RegenerationHistory"),
+	64,
+	TEXT("Number of regeneration summaries kept in memory for GPUTessellation.DumpRegenerations.\n")
+	TEXT(" 0: keep none"),
+	ECVF_Default);
+
+namespace GPUTessellationRegenerationHistory
+{
+	static FCriticalSection Lock;
+	static TArray<FGPUTessellationRegenerationSummary> Summaries;
+
+	/** Capacity Summaries was filled with; a different cvar value starts over */
+	static int32 Capacity = 0;
+
+	/** Oldest summary, overwritten by the next one once the history is full */
+	static int32 NextIndex = 0;
+}
+
+void FGPUTessellationRegenerationHistory::Record(const FGPUTessellationRegenerationSummary& Summary)
+{
+	using namespace GPUTessellationRegenerationHistory;
+
+	const int32 NewCapacity = FMath::Max(CVarGPUTessellationRegenerationHistory.GetValueOnAnyThread(), 0);
+
+	FScopeLock ScopeLock(&Lock);
+	if (NewCapacity != Capacity)
+	{
+		Summaries.Empty(NewCapacity);
+		Capacity = NewCapacity;
+		NextIndex = 0;
+	}
+	if (Capacity == 0)
+	{
+		return;
+	}
+
+	if (Summaries.Num() < Capacity)
+	{
+		Summaries.Add(Summary);
+	}
+	else
+	{
+		Summaries[NextIndex] = Summary;
+		NextIndex = (NextIndex + 1) % Capacity;
+	}
+}
+
+TArray<FGPUTessellationRegenerationSummary> FGPUTessellationRegenerationHistory::GetSummaries()
+{
+	using namespace GPUTessellationRegenerationHistory;
+
+	FScopeLock ScopeLock(&Lock);
+	TArray<FGPUTessellationRegenerationSummary> Result;
+	Result.Reserve(Summaries.Num());
+	for (int32 Index = 0; Index < Summaries.Num(); ++Index)
+	{
+		Result.Add(Summaries[(NextIndex + Index) % Summaries.Num()]);
+	}
+	return Result;
+}
+
+void FGPUTessellationRegenerationHistory::Reset()
+{
+	using namespace GPUTessellationRegenerationHistory;
+
+	FScopeLock ScopeLock(&Lock);
+	Summaries.Reset();
+	NextIndex = 0;
+}
+
+void FGPUTessellationRegenerationTrace::Finish() const
+{
+	const uint64 EndCycle = FPlatformTime::Cycles64();
+	const FGPUTessellationBuildStats& Stats = MeshBuilder.GetBuildStats();
+
+	if (CVarGPUTessellationRegenerationHistory.GetValueOnRenderThread() > 0)
+	{
+		FGPUTessellationRegenerationSummary Summary;
+		Summary.FrameNumber = GFrameCounterRenderThread;
+		Summary.Time = FPlatformTime::Seconds();
+		Summary.Milliseconds = FPlatformTime::ToMilliseconds64(EndCycle - StartCycle);
+		Summary.OwnerName = Proxy.GetOwnerName();
+		Summary.ResourceName = Proxy.GetResourceName();
+		Summary.Trigger = Trigger;
+		Summary.TotalPatches = TotalPatches;
+		Summary.BuildStats = Stats;
+		FGPUTessellationRegenerationHistory::Record(Summary);
+	}
+
+#if GPUTESSELLATION_TRACE_ENABLED
+	if (!UE_TRACE_CHANNELEXPR_IS_ENABLED(GPUTessellationChannel))
+	{
+		return;
+	}
+
+	const FString ComponentName = FString::Printf(TEXT("%s.%s"), *Proxy.GetOwnerName().ToString(), *Proxy.GetResourceName().ToString());
+
+	UE_TRACE_LOG(GPUTessellation, Regeneration, GPUTessellationChannel)
+		<< Regeneration.StartCycle(StartCycle)
+		<< Regeneration.EndCycle(EndCycle)
+		<< Regeneration.ComponentId(Proxy.GetPrimitiveComponentId().PrimIDValue)
+		<< Regeneration.Trigger((uint8)Trigger)
+		<< Regeneration.TotalPatches((uint32)TotalPatches)
+		<< Regeneration.GeneratedPatches(Stats.GeneratedPatches)
+		<< Regeneration.CulledPatches(Stats.CulledPatches)
+		<< Regeneration.VertexGenerationPasses(Stats.VertexGenerationPasses)
+		<< Regeneration.DisplacementPasses(Stats.DisplacementPasses)
+		<< Regeneration.NormalPasses(Stats.NormalPasses)
+		<< Regeneration.TangentPasses(Stats.TangentPasses)
+		<< Regeneration.IndexPasses(Stats.IndexPasses)
+		<< Regeneration.CullingPasses(Stats.CullingPasses)
+		<< Regeneration.OtherPasses(Stats.OtherPasses)
+		<< Regeneration.VertexCount(Stats.VertexCount)
+		<< Regeneration.IndexCount(Stats.IndexCount)
+		<< Regeneration.ComponentName(*ComponentName, ComponentName.Len());
+
+	// Custom events need an analyzer; the bookmark puts the trigger on the Insights timeline next to the hitch
+	TRACE_BOOKMARK(TEXT("GPUTessellation %s: %s (%u passes, %u vertices, %.2f ms)"),
+		LexToString(Trigger), *ComponentName, Stats.GetTotalPasses(), Stats.VertexCount,
+		FPlatformTime::ToMilliseconds64(EndCycle - StartCycle));
+#endif
+}
+
+/**
+ * Log the last regenerations, oldest first
+ */
+static void DumpRegenerationsCommand(const TArray<FString>& Args)
+{
+	const TArray<FGPUTessellationRegenerationSummary> Summaries = FGPUTessellationRegenerationHistory::GetSummaries();
+	const int32 Count = Args.Num() > 0 ? FMath::Clamp(FCString::Atoi(*Args[0]), 0, Summaries.Num()) : Summaries.Num();
+	const double Now = FPlatformTime::Seconds();
+
+	UE_LOG(LogGPUTessellation, Log, TEXT("GPUTessellation.DumpRegenerations: last %d of %d regenerations (r.GPUTessellation.RegenerationHistory %d)"),
+		Count, Summaries.Num(), CVarGPUTessellationRegenerationHistory.GetValueOnGameThread());
+	for (int32 Index = Summaries.Num() - Count; Index < Summaries.Num(); ++Index)
+	{
+		const FGPUTessellationRegenerationSummary& Summary = Summaries[Index];
+		const FGPUTessellationBuildStats& Stats = Summary.BuildStats;
+		UE_LOG(LogGPUTessellation, Log, TEXT("  Frame %llu (%.1fs ago) %.2f ms %s %s.%s - Patches:%d Generated:%u Culled:%u Passes:%u (Vertex:%u Displacement:%u Normal:%u Tangent:%u Index:%u Culling:%u Other:%u) Verts:%u Indices:%u"),
+			Summary.FrameNumber, Now - Summary.Time, Summary.Milliseconds, LexToString(Summary.Trigger),
+			*Summary.OwnerName.ToString(), *Summary.ResourceName.ToString(),
+			Summary.TotalPatches, Stats.GeneratedPatches, Stats.CulledPatches, Stats.GetTotalPasses(),
+			Stats.VertexGenerationPasses, Stats.DisplacementPasses, Stats.NormalPasses, Stats.TangentPasses,
+			Stats.IndexPasses, Stats.CullingPasses, Stats.OtherPasses, Stats.VertexCount, Stats.IndexCount);
+	}
+}
+
+static FAutoConsoleCommand GDumpRegenerationsCommand(
+	TEXT("GPUTessellation.DumpRegenerations"),
+	TEXT("Log the last regenerations kept in memory: trigger, component, patches, passes and CPU time. Usage: GPUTessellation.DumpRegenerations [Count]"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&DumpRegenerationsCommand));
+
+static void ClearRegenerationsCommand(const TArray<FString>& Args)
+{
+	FGPUTessellationRegenerationHistory::Reset();
+}
+
+static FAutoConsoleCommand GClearRegenerationsCommand(
+	TEXT("GPUTessellation.ClearRegenerations"),
+	TEXT("Forget the regenerations kept for GPUTessellation.DumpRegenerations. Usage: GPUTessellation.ClearRegenerations"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&ClearRegenerationsCommand));
+
+#endif // GPUTESSELLATION_REGENERATION_HISTORY
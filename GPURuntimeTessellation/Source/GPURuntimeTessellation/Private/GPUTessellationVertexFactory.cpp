@@ -22,6 +22,10 @@ public:
 		PositionBufferParameter.Bind(ParameterMap, TEXT("PositionBuffer"));
 		NormalBufferParameter.Bind(ParameterMap, TEXT("NormalBuffer"));
 		UVBufferParameter.Bind(ParameterMap, TEXT("UVBuffer"));
+		PatchDescriptorsParameter.Bind(ParameterMap, TEXT("PatchDescriptors"));
+		VisiblePatchListParameter.Bind(ParameterMap, TEXT("VisiblePatchList"));
+		PatchListOffsetParameter.Bind(ParameterMap, TEXT("PatchListOffset"));
+		InstanceTransformsParameter.Bind(ParameterMap, TEXT("InstanceTransforms"));
 	}
 
 	void GetElementShaderBindings(
@@ -52,12 +56,47 @@ public:
 		{
 			ShaderBindings.Add(UVBufferParameter, GPUVertexFactory->UVSRV);
 		}
+
+		// Patch parameters only exist in the indirect vertex factory's shaders
+		if (VisiblePatchListParameter.IsBound())
+		{
+			const FGPUTessellationIndirectVertexFactory* IndirectVertexFactory = static_cast<const FGPUTessellationIndirectVertexFactory*>(VertexFactory);
+			const FGPUTessellationIndirectUserData* IndirectUserData = static_cast<const FGPUTessellationIndirectUserData*>(BatchElement.UserData);
+			if (IndirectVertexFactory->PatchDescriptorSRV.IsValid())
+			{
+				ShaderBindings.Add(PatchDescriptorsParameter, IndirectVertexFactory->PatchDescriptorSRV);
+			}
+			// The view's culled list if the scene proxy culled for it, every patch otherwise
+			if (IndirectUserData && IndirectUserData->VisiblePatchListSRV)
+			{
+				ShaderBindings.Add(VisiblePatchListParameter, IndirectUserData->VisiblePatchListSRV);
+			}
+			else if (IndirectVertexFactory->VisiblePatchListSRV.IsValid())
+			{
+				ShaderBindings.Add(VisiblePatchListParameter, IndirectVertexFactory->VisiblePatchListSRV);
+			}
+			ShaderBindings.Add(PatchListOffsetParameter, IndirectUserData ? IndirectUserData->PatchListOffset : 0u);
+		}
+
+		// Instance transforms only exist in the instanced vertex factory's shaders
+		if (InstanceTransformsParameter.IsBound())
+		{
+			const FGPUTessellationInstancedUserData* InstancedUserData = static_cast<const FGPUTessellationInstancedUserData*>(BatchElement.UserData);
+			if (InstancedUserData && InstancedUserData->InstanceTransformSRV)
+			{
+				ShaderBindings.Add(InstanceTransformsParameter, InstancedUserData->InstanceTransformSRV);
+			}
+		}
 	}
 
 private:
 	LAYOUT_FIELD(FShaderResourceParameter, PositionBufferParameter);
 	LAYOUT_FIELD(FShaderResourceParameter, NormalBufferParameter);
 	LAYOUT_FIELD(FShaderResourceParameter, UVBufferParameter);
+	LAYOUT_FIELD(FShaderResourceParameter, PatchDescriptorsParameter);
+	LAYOUT_FIELD(FShaderResourceParameter, VisiblePatchListParameter);
+	LAYOUT_FIELD(FShaderParameter, PatchListOffsetParameter);
+	LAYOUT_FIELD(FShaderResourceParameter, InstanceTransformsParameter);
 };
 
 IMPLEMENT_TYPE_LAYOUT(FGPUTessellationVertexFactoryShaderParameters);
@@ -69,6 +108,20 @@ IMPLEMENT_VERTEX_FACTORY_TYPE(FGPUTessellationVertexFactory, "/Plugin/GPURuntime
 	EVertexFactoryFlags::SupportsDynamicLighting |
 	EVertexFactoryFlags::SupportsPositionOnly);
 
+IMPLEMENT_VERTEX_FACTORY_PARAMETER_TYPE(FGPUTessellationIndirectVertexFactory, SF_Vertex, FGPUTessellationVertexFactoryShaderParameters);
+
+IMPLEMENT_VERTEX_FACTORY_TYPE(FGPUTessellationIndirectVertexFactory, "/Plugin/GPURuntimeTessellation/Private/GPUTessellationVertexFactory.ush", 
+	EVertexFactoryFlags::UsedWithMaterials | 
+	EVertexFactoryFlags::SupportsDynamicLighting |
+	EVertexFactoryFlags::SupportsPositionOnly);
+
+IMPLEMENT_VERTEX_FACTORY_PARAMETER_TYPE(FGPUTessellationInstancedVertexFactory, SF_Vertex, FGPUTessellationVertexFactoryShaderParameters);
+
+IMPLEMENT_VERTEX_FACTORY_TYPE(FGPUTessellationInstancedVertexFactory, "/Plugin/GPURuntimeTessellation/Private/GPUTessellationVertexFactory.ush", 
+	EVertexFactoryFlags::UsedWithMaterials | 
+	EVertexFactoryFlags::SupportsDynamicLighting |
+	EVertexFactoryFlags::SupportsPositionOnly);
+
 FGPUTessellationVertexFactory::FGPUTessellationVertexFactory(ERHIFeatureLevel::Type InFeatureLevel)
 	: FVertexFactory(InFeatureLevel)
 {
@@ -126,3 +179,43 @@ void FGPUTessellationVertexFactory::ValidateCompiledResult(const FVertexFactoryT
 {
 	// Validation logic if needed
 }
+
+FGPUTessellationIndirectVertexFactory::FGPUTessellationIndirectVertexFactory(ERHIFeatureLevel::Type InFeatureLevel)
+	: FGPUTessellationVertexFactory(InFeatureLevel)
+{
+}
+
+void FGPUTessellationIndirectVertexFactory::SetPatchBuffers(FShaderResourceViewRHIRef InPatchDescriptorSRV, FShaderResourceViewRHIRef InVisiblePatchListSRV)
+{
+	PatchDescriptorSRV = InPatchDescriptorSRV;
+	VisiblePatchListSRV = InVisiblePatchListSRV;
+}
+
+void FGPUTessellationIndirectVertexFactory::ReleaseRHI()
+{
+	PatchDescriptorSRV.SafeRelease();
+	VisiblePatchListSRV.SafeRelease();
+	
+	FGPUTessellationVertexFactory::ReleaseRHI();
+}
+
+void FGPUTessellationIndirectVertexFactory::ModifyCompilationEnvironment(const FVertexFactoryShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
+{
+	FGPUTessellationVertexFactory::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+	
+	// Instance a per-LOD grid over the visible patches (see GPUTessellationVertexFactory.ush)
+	OutEnvironment.SetDefine(TEXT("GPU_TESSELLATION_INDIRECT"), 1);
+}
+
+FGPUTessellationInstancedVertexFactory::FGPUTessellationInstancedVertexFactory(ERHIFeatureLevel::Type InFeatureLevel)
+	: FGPUTessellationVertexFactory(InFeatureLevel)
+{
+}
+
+void FGPUTessellationInstancedVertexFactory::ModifyCompilationEnvironment(const FVertexFactoryShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
+{
+	FGPUTessellationVertexFactory::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+	
+	// Transform each instance into the drawing proxy's local space (see GPUTessellationVertexFactory.ush)
+	OutEnvironment.SetDefine(TEXT("GPU_TESSELLATION_INSTANCED"), 1);
+}
@@ -0,0 +1,139 @@
+// Licensed under the MIT License. See LICENSE file in the project root.
+
+#include "GPUTessellationViewSubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Camera/CameraTypes.h"
+#include "Kismet/GameplayStatics.h"
+#include "SceneManagement.h"
+
+#if WITH_EDITOR
+#include "Editor.h"
+#include "EditorViewportClient.h"
+#endif
+
+namespace GPUTessellationViews
+{
+	/** Fill the view from a camera; orthographic cameras get no frustum */
+	static void SetFromViewInfo(const FMinimalViewInfo& ViewInfo, FGPUTessellationView& OutView)
+	{
+		OutView.Location = ViewInfo.Location;
+		OutView.Rotation = ViewInfo.Rotation;
+		OutView.FOV = ViewInfo.FOV;
+		OutView.bHasFrustum = ViewInfo.ProjectionMode == ECameraProjectionMode::Perspective;
+		if (OutView.bHasFrustum)
+		{
+			FMatrix ViewMatrix;
+			FMatrix ProjectionMatrix;
+			FMatrix ViewProjectionMatrix;
+			UGameplayStatics::GetViewProjectionMatrix(ViewInfo, ViewMatrix, ProjectionMatrix, ViewProjectionMatrix);
+			GetViewFrustumBounds(OutView.Frustum, ViewProjectionMatrix, true);
+		}
+	}
+}
+
+const TArray<FGPUTessellationView>& UGPUTessellationViewSubsystem::GetViews() const
+{
+	UpdateViews();
+	return Views;
+}
+
+const FGPUTessellationView* UGPUTessellationViewSubsystem::FindNearestView(const FVector& WorldLocation) const
+{
+	UpdateViews();
+
+	const FGPUTessellationView* NearestView = nullptr;
+	double NearestDistanceSquared = TNumericLimits<double>::Max();
+	for (const FGPUTessellationView& View : Views)
+	{
+		const double DistanceSquared = FVector::DistSquared(View.Location, WorldLocation);
+		if (DistanceSquared < NearestDistanceSquared)
+		{
+			NearestDistanceSquared = DistanceSquared;
+			NearestView = &View;
+		}
+	}
+	return NearestView;
+}
+
+bool UGPUTessellationViewSubsystem::IsInAnyView(const FBoxSphereBounds& Bounds) const
+{
+	UpdateViews();
+
+	for (const FGPUTessellationView& View : Views)
+	{
+		if (!View.bHasFrustum || View.Frustum.IntersectBox(Bounds.Origin, Bounds.BoxExtent))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+const FGPUTessellationView* UGPUTessellationViewSubsystem::FindNearestView(const UWorld* World, const FVector& WorldLocation)
+{
+	const UGPUTessellationViewSubsystem* ViewSubsystem = World ? World->GetSubsystem<UGPUTessellationViewSubsystem>() : nullptr;
+	return ViewSubsystem ? ViewSubsystem->FindNearestView(WorldLocation) : nullptr;
+}
+
+void UGPUTessellationViewSubsystem::UpdateViews() const
+{
+	check(IsInGameThread());
+
+	if (CachedFrame == GFrameCounter)
+	{
+		return;
+	}
+	CachedFrame = GFrameCounter;
+	Views.Reset();
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	// Every local player, so split screen LOD follows the closest one
+	for (FConstPlayerControllerIterator Iterator = World->GetPlayerControllerIterator(); Iterator; ++Iterator)
+	{
+		APlayerController* PC = Iterator->Get();
+		if (!PC || !PC->IsLocalController())
+		{
+			continue;
+		}
+
+		FGPUTessellationView& View = Views.AddDefaulted_GetRef();
+		if (PC->PlayerCameraManager)
+		{
+			GPUTessellationViews::SetFromViewInfo(PC->PlayerCameraManager->GetCameraCacheView(), View);
+		}
+		else
+		{
+			PC->GetPlayerViewPoint(View.Location, View.Rotation);
+		}
+	}
+
+#if WITH_EDITOR
+	// Editor worlds have no players; use every visible viewport showing this world
+	if (Views.Num() == 0 && GEditor)
+	{
+		for (FEditorViewportClient* ViewportClient : GEditor->GetAllViewportClients())
+		{
+			if (!ViewportClient || !ViewportClient->Viewport || !ViewportClient->IsVisible() || ViewportClient->GetWorld() != World)
+			{
+				continue;
+			}
+
+			const FIntPoint ViewportSize = ViewportClient->Viewport->GetSizeXY();
+			FMinimalViewInfo ViewInfo;
+			ViewInfo.Location = ViewportClient->GetViewLocation();
+			ViewInfo.Rotation = ViewportClient->GetViewRotation();
+			ViewInfo.FOV = ViewportClient->ViewFOV;
+			ViewInfo.AspectRatio = ViewportSize.Y > 0 ? (float)ViewportSize.X / ViewportSize.Y : 1.0f;
+			ViewInfo.ProjectionMode = ViewportClient->IsOrtho() ? ECameraProjectionMode::Orthographic : ECameraProjectionMode::Perspective;
+			GPUTessellationViews::SetFromViewInfo(ViewInfo, Views.AddDefaulted_GetRef());
+		}
+	}
+#endif
+}
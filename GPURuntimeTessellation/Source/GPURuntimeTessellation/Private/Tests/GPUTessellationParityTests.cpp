@@ -0,0 +1,645 @@
+// Licensed under the MIT License. See LICENSE file in the project root.
+
+#include "GPUTessellationCPUReference.h"
+#include "GPUTessellationCPUBackend.h"
+#include "GPUTessellationMeshBuilder.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/App.h"
+#include "Math/RandomStream.h"
+#include "RenderGraphBuilder.h"
+#include "RenderGraphUtils.h"
+#include "RenderingThread.h"
+#include "ConvexVolume.h"
+#include "SceneManagement.h"
+#include "RHI.h"
+#include "RHIGPUReadback.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace GPUTessellationParityTests
+{
+	/**
+	 * One synthetic input of the parity tests
+	 */
+	struct FParityCase
+	{
+		const TCHAR* Name;
+		FGPUTessellationSettings Settings;
+		FIntVector4 EdgeCollapseFactors = FIntVector4(1, 1, 1, 1);
+
+		/** Random height textures; the GPU has no UTexture for them, so only the CPU backend is compared */
+		bool bSyntheticTextures = false;
+	};
+
+	/**
+	 * Output of every pipeline stage for one case
+	 */
+	struct FParityStages
+	{
+		FGPUTessellatedMeshData Generated;
+		TArray<FVector3f> DisplacedPositions;
+		TArray<FVector3f> Normals;
+		TArray<FVector4f> Tangents;
+		TArray<uint32> Indices;
+		TArray<float> TessFactors;
+	};
+
+	/**
+	 * Absolute tolerances per stage
+	 * The CPU backend runs the same float math as the reference (SIMD sine and reciprocal square root aside);
+	 * the GPU uses approximate division and transcendentals
+	 */
+	struct FParityTolerances
+	{
+		float Position;
+		float UV;
+		float NormalDegrees;
+		float TangentDegrees;
+		float TessFactor;
+	};
+
+	/** Transform and camera for the tessellation factor stage */
+	static const FMatrix ParityLocalToWorld = FTransform(FRotator(0.0, 30.0, 0.0), FVector(100.0, -50.0, 20.0), FVector(2.0)).ToMatrixWithScale();
+	static const FVector ParityCameraPosition(0.0, 0.0, 500.0);
+	static constexpr float ParityMaxTessellationDistance = 3000.0f;
+	static constexpr float ParityMinTessellationFactor = 1.0f;
+	static constexpr float ParityMaxTessellationFactor = 64.0f;
+
+	static TArray<FParityCase> MakeParityCases()
+	{
+		FParityCase FiniteDifference;
+		FiniteDifference.Name = TEXT("SineFiniteDifference");
+		FiniteDifference.Settings.TessellationFactor = 16.0f;
+		FiniteDifference.Settings.bUseSineWaveDisplacement = true;
+		FiniteDifference.Settings.NormalCalculationMethod = EGPUTessellationNormalMethod::FiniteDifference;
+		FiniteDifference.Settings.NormalSmoothingFactor = 0.0f;
+
+		FParityCase GeometryBlend = FiniteDifference;
+		GeometryBlend.Name = TEXT("SineGeometryBlendInverted");
+		GeometryBlend.Settings.NormalCalculationMethod = EGPUTessellationNormalMethod::Hybrid;
+		GeometryBlend.Settings.NormalSmoothingFactor = 0.5f;
+		GeometryBlend.Settings.bInvertNormals = true;
+
+		FParityCase PatchRemap = FiniteDifference;
+		PatchRemap.Name = TEXT("PatchUVRemapEdgeCollapse");
+		PatchRemap.Settings.TessellationFactor = 7.0f;
+		PatchRemap.Settings.UVScale = FVector2f(0.25f, 0.5f);
+		PatchRemap.Settings.UVOffset = FVector2f(0.5f, 0.25f);
+		PatchRemap.Settings.DisplacementOffset = -20.0f;
+		PatchRemap.EdgeCollapseFactors = FIntVector4(2, 4, 8, 2);
+
+		FParityCase NormalMap = FiniteDifference;
+		NormalMap.Name = TEXT("DefaultTexturesNormalMap");
+		NormalMap.Settings.bUseSineWaveDisplacement = false;
+		NormalMap.Settings.NormalCalculationMethod = EGPUTessellationNormalMethod::FromNormalMap;
+
+		FParityCase Disabled = FiniteDifference;
+		Disabled.Name = TEXT("NormalsDisabled");
+		Disabled.Settings.TessellationFactor = 3.0f;
+		Disabled.Settings.NormalCalculationMethod = EGPUTessellationNormalMethod::Disabled;
+
+		FParityCase Synthetic = GeometryBlend;
+		Synthetic.Name = TEXT("SyntheticTextures");
+		Synthetic.Settings.bUseSineWaveDisplacement = false;
+		Synthetic.Settings.bInvertNormals = false;
+		Synthetic.bSyntheticTextures = true;
+
+		return { FiniteDifference, GeometryBlend, PatchRemap, NormalMap, Disabled, Synthetic };
+	}
+
+	static float AngleDegrees(const FVector3f& A, const FVector3f& B)
+	{
+		return FMath::RadiansToDegrees(FMath::Acos(FMath::Clamp(FVector3f::DotProduct(A.GetSafeNormal(), B.GetSafeNormal()), -1.0f, 1.0f)));
+	}
+
+	/** Fail unless both arrays have the same size and every pair of elements is within the tolerance */
+	template <typename ElementType, typename DistanceFunctionType>
+	static void TestMaxError(FAutomationTestBase& Test, const FString& What, const TArray<ElementType>& Actual, const TArray<ElementType>& Expected,
+		DistanceFunctionType DistanceFunction, float Tolerance)
+	{
+		if (!Test.TestEqual(*FString::Printf(TEXT("%s element count"), *What), Actual.Num(), Expected.Num()))
+		{
+			return;
+		}
+
+		float MaxError = 0.0f;
+		for (int32 Index = 0; Index < Actual.Num(); ++Index)
+		{
+			MaxError = FMath::Max(MaxError, DistanceFunction(Actual[Index], Expected[Index]));
+		}
+		Test.TestEqual(*FString::Printf(TEXT("%s max error"), *What), MaxError, 0.0f, Tolerance);
+	}
+
+	static void TestStages(
+		FAutomationTestBase& Test,
+		const TCHAR* Against,
+		const FParityStages& Reference,
+		const FParityStages& Actual,
+		const FParityTolerances& Tolerances,
+		bool bCompareTessFactors)
+	{
+		auto PositionError = [](const FVector3f& A, const FVector3f& B) { return FVector3f::Distance(A, B); };
+		auto UVError = [](const FVector2f& A, const FVector2f& B) { return FVector2f::Distance(A, B); };
+		auto TangentError = [](const FVector4f& A, const FVector4f& B)
+		{
+			// A flipped binormal sign is a full failure
+			return A.W != B.W ? 180.0f : AngleDegrees(FVector3f(A), FVector3f(B));
+		};
+		auto What = [Against](const TCHAR* Stage) { return FString::Printf(TEXT("%s (%s)"), Stage, Against); };
+
+		TestMaxError(Test, What(TEXT("GenerateVertices positions")), Actual.Generated.Vertices, Reference.Generated.Vertices, PositionError, Tolerances.Position);
+		TestMaxError(Test, What(TEXT("GenerateVertices normals")), Actual.Generated.Normals, Reference.Generated.Normals, &AngleDegrees, Tolerances.NormalDegrees);
+		TestMaxError(Test, What(TEXT("GenerateVertices UVs")), Actual.Generated.UVs, Reference.Generated.UVs, UVError, Tolerances.UV);
+		TestMaxError(Test, What(TEXT("ApplyDisplacement")), Actual.DisplacedPositions, Reference.DisplacedPositions, PositionError, Tolerances.Position);
+		TestMaxError(Test, What(TEXT("CalculateNormals")), Actual.Normals, Reference.Normals, &AngleDegrees, Tolerances.NormalDegrees);
+		TestMaxError(Test, What(TEXT("CalculateTangentsCS")), Actual.Tangents, Reference.Tangents, TangentError, Tolerances.TangentDegrees);
+		TestMaxError(Test, What(TEXT("GenerateIndices")), Actual.Indices, Reference.Indices, [](uint32 A, uint32 B) { return A == B ? 0.0f : 1.0f; }, 0.0f);
+		if (bCompareTessFactors)
+		{
+			TestMaxError(Test, What(TEXT("CalculateTessellationFactors")), Actual.TessFactors, Reference.TessFactors, [](float A, float B) { return FMath::Abs(A - B); }, Tolerances.TessFactor);
+		}
+	}
+
+	/**
+	 * Staging copy of one buffer, read once the GPU is idle
+	 */
+	struct FParityReadback
+	{
+		FRHIGPUBufferReadback* Readback = nullptr;
+		void* Destination = nullptr;
+		uint32 NumBytes = 0;
+	};
+
+	/** Copy a buffer into OutData once the graph executes; copies are ordered with the passes around them */
+	template <typename ElementType>
+	static void EnqueueReadback(FRDGBuilder& GraphBuilder, FRDGBufferRef Buffer, int32 NumElements, TArray<ElementType>& OutData, TArray<FParityReadback>& Readbacks)
+	{
+		OutData.SetNumZeroed(NumElements);
+
+		FParityReadback& Readback = Readbacks.AddDefaulted_GetRef();
+		Readback.Readback = new FRHIGPUBufferReadback(TEXT("GPUTessellationParityReadback"));
+		Readback.Destination = OutData.GetData();
+		Readback.NumBytes = NumElements * sizeof(ElementType);
+		AddEnqueueCopyPass(GraphBuilder, Readback.Readback, Buffer, Readback.NumBytes);
+	}
+
+	/** Can the compute shaders run? Without an RHI only the CPU halves of the tests run */
+	static bool CanRunOnGPU()
+	{
+		return FApp::CanEverRender() && !GUsingNullRHI;
+	}
+
+	/**
+	 * Record passes into a graph on the render thread, execute it and wait for every readback they enqueued (game thread)
+	 */
+	static void ExecuteAndReadBack(TFunction<void(FRDGBuilder&, TArray<FParityReadback>&)> AddPasses)
+	{
+		ENQUEUE_RENDER_COMMAND(GPUTessellationParityTests)(
+			[&AddPasses](FRHICommandListImmediate& RHICmdList)
+			{
+				FRDGBuilder GraphBuilder(RHICmdList);
+				TArray<FParityReadback> Readbacks;
+				AddPasses(GraphBuilder, Readbacks);
+
+				GraphBuilder.AddPass(
+					RDG_EVENT_NAME("ExtractParityReadbacks"),
+					ERDGPassFlags::None,
+					[Readbacks](FRHICommandListImmediate& RHICmdList)
+					{
+						// Wait for GPU to finish
+						RHICmdList.BlockUntilGPUIdle();
+
+						for (const FParityReadback& Readback : Readbacks)
+						{
+							if (const void* Data = Readback.Readback->Lock(Readback.NumBytes))
+							{
+								FMemory::Memcpy(Readback.Destination, Data, Readback.NumBytes);
+								Readback.Readback->Unlock();
+							}
+							delete Readback.Readback;
+						}
+					});
+
+				GraphBuilder.Execute();
+			});
+
+		FlushRenderingCommands();
+	}
+}
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FGPUTessellationParityTest, "GPURuntimeTessellation.Parity",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+void FGPUTessellationParityTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	for (const GPUTessellationParityTests::FParityCase& Case : GPUTessellationParityTests::MakeParityCases())
+	{
+		OutBeautifiedNames.Add(Case.Name);
+		OutTestCommands.Add(Case.Name);
+	}
+}
+
+/**
+ * Every compute shader stage against its CPU reference on one synthetic case
+ * Compared with the CPU backend always, and with a GPU readback taken after each stage when an RHI is available
+ */
+bool FGPUTessellationParityTest::RunTest(const FString& Parameters)
+{
+	using namespace GPUTessellationParityTests;
+
+	const TArray<FParityCase> Cases = MakeParityCases();
+	const FParityCase* FoundCase = Cases.FindByPredicate([&Parameters](const FParityCase& Case) { return Parameters == Case.Name; });
+	if (!TestNotNull(TEXT("Parity case"), FoundCase))
+	{
+		return false;
+	}
+
+	const FParityCase& Case = *FoundCase;
+	const FGPUTessellationSettings& Settings = Case.Settings;
+	const FIntPoint Resolution = FGPUTessellationMeshBuilder::CalculateResolution(Settings.TessellationFactor);
+
+	const FParityTolerances BackendTolerances = { 0.02f, 1.0e-6f, 0.05f, 0.05f, 0.0f };
+	const FParityTolerances GPUTolerances = { 0.05f, 1.0e-5f, 0.5f, 0.5f, 1.0e-3f };
+
+	// Textures: the GPU binds white for missing textures, the synthetic case uses random heights and a mask
+	FGPUTessellationCPUTextures Textures;
+	Textures.Build(Settings, nullptr, nullptr, nullptr);
+	if (Case.bSyntheticTextures)
+	{
+		FRandomStream RandomStream(0x9A41);
+		auto MakeTexture = [&RandomStream](int32 Size, float Scale)
+		{
+			FGPUTessellationHeightTexture Texture;
+			Texture.Size = FIntPoint(Size, Size);
+			Texture.Texels.SetNumUninitialized(Size * Size);
+			for (float& Texel : Texture.Texels)
+			{
+				Texel = RandomStream.GetFraction() * Scale;
+			}
+			return Texture;
+		};
+		Textures.HeightSampler.SetTextures(MakeTexture(37, 1.0f), MakeTexture(19, 0.5f));
+	}
+
+	auto HeightFunction = [&](const FVector2f& UV) { return Textures.HeightSampler.SampleSource(Settings, UV); };
+	auto NormalMapFunction = [&](const FVector2f& UV) { return Textures.SampleNormalMap(UV); };
+
+	// Reference: every stage in order
+	FParityStages Reference;
+	FGPUTessellationCPUReference::GenerateVertices(Settings, Resolution, Reference.Generated);
+	FGPUTessellatedMeshData Mesh = Reference.Generated;
+	FGPUTessellationCPUReference::ApplyDisplacement(Settings, HeightFunction, Mesh);
+	Reference.DisplacedPositions = Mesh.Vertices;
+	if (Settings.NormalCalculationMethod != EGPUTessellationNormalMethod::Disabled)
+	{
+		FGPUTessellationCPUReference::CalculateNormals(Settings, HeightFunction, NormalMapFunction, Mesh);
+	}
+	Reference.Normals = Mesh.Normals;
+	FGPUTessellationCPUReference::CalculateTangents(Mesh, Reference.Tangents);
+	FGPUTessellationCPUReference::GenerateIndices(Resolution, Case.EdgeCollapseFactors, Reference.Indices);
+	FGPUTessellationCPUReference::CalculateTessellationFactors(Mesh.Vertices, Reference.Indices, ParityLocalToWorld, ParityCameraPosition,
+		ParityMaxTessellationDistance, ParityMinTessellationFactor, ParityMaxTessellationFactor, Reference.TessFactors);
+
+	// CPU backend, same stages
+	{
+		FParityStages Backend;
+		FGPUTessellationCPUBackend::GenerateVertices(Settings, Resolution, Backend.Generated);
+		FGPUTessellatedMeshData BackendMesh = Backend.Generated;
+		FGPUTessellationCPUBackend::ApplyDisplacement(Settings, Textures.HeightSampler, BackendMesh);
+		Backend.DisplacedPositions = BackendMesh.Vertices;
+		if (Settings.NormalCalculationMethod != EGPUTessellationNormalMethod::Disabled)
+		{
+			FGPUTessellationCPUBackend::CalculateNormals(Settings, Textures, BackendMesh);
+		}
+		Backend.Normals = BackendMesh.Normals;
+		FGPUTessellationCPUBackend::CalculateTangents(BackendMesh, Backend.Tangents);
+		FGPUTessellationCPUBackend::GenerateIndices(Resolution, Case.EdgeCollapseFactors, Backend.Indices);
+
+		TestStages(*this, TEXT("CPU backend"), Reference, Backend, BackendTolerances, false);
+	}
+
+	if (Case.bSyntheticTextures)
+	{
+		return true;
+	}
+	if (!CanRunOnGPU())
+	{
+		AddInfo(TEXT("No RHI; the GPU comparison was skipped"));
+		return true;
+	}
+
+	// Compute shaders, reading back after every stage
+	FParityStages GPU;
+	ExecuteAndReadBack([&Settings, &Case, &GPU, Resolution](FRDGBuilder& GraphBuilder, TArray<FParityReadback>& Readbacks)
+	{
+		const int32 VertexCount = Resolution.X * Resolution.Y;
+		const int32 IndexCount = (Resolution.X - 1) * (Resolution.Y - 1) * 6;
+
+		FGPUTessellationMeshBuilder MeshBuilder;
+		FRDGBufferRef VertexBuffer = nullptr;
+		FRDGBufferRef NormalBuffer = nullptr;
+		FRDGBufferRef UVBuffer = nullptr;
+		FRDGBufferRef TangentBuffer = nullptr;
+		FRDGBufferRef IndexBuffer = nullptr;
+		FRDGBufferRef TessFactorBuffer = nullptr;
+
+		MeshBuilder.DispatchVertexGeneration(GraphBuilder, Settings, Resolution, FMatrix::Identity, FVector::ZeroVector, VertexBuffer, NormalBuffer, UVBuffer);
+		EnqueueReadback(GraphBuilder, VertexBuffer, VertexCount, GPU.Generated.Vertices, Readbacks);
+		EnqueueReadback(GraphBuilder, NormalBuffer, VertexCount, GPU.Generated.Normals, Readbacks);
+		EnqueueReadback(GraphBuilder, UVBuffer, VertexCount, GPU.Generated.UVs, Readbacks);
+
+		MeshBuilder.DispatchDisplacement(GraphBuilder, Settings, Resolution, nullptr, nullptr, VertexBuffer, NormalBuffer, UVBuffer);
+		EnqueueReadback(GraphBuilder, VertexBuffer, VertexCount, GPU.DisplacedPositions, Readbacks);
+
+		if (Settings.NormalCalculationMethod != EGPUTessellationNormalMethod::Disabled)
+		{
+			MeshBuilder.DispatchNormalCalculation(GraphBuilder, Settings, Resolution, nullptr, nullptr, nullptr, VertexBuffer, NormalBuffer, UVBuffer);
+		}
+		EnqueueReadback(GraphBuilder, NormalBuffer, VertexCount, GPU.Normals, Readbacks);
+
+		MeshBuilder.DispatchTangentCalculation(GraphBuilder, Resolution, VertexBuffer, NormalBuffer, UVBuffer, TangentBuffer);
+		EnqueueReadback(GraphBuilder, TangentBuffer, VertexCount, GPU.Tangents, Readbacks);
+
+		MeshBuilder.DispatchIndexGeneration(GraphBuilder, Resolution, Case.EdgeCollapseFactors, IndexBuffer);
+		EnqueueReadback(GraphBuilder, IndexBuffer, IndexCount, GPU.Indices, Readbacks);
+
+		FGPUTessellationMeshBuilder::AddTessellationFactorPass(GraphBuilder, VertexBuffer, IndexBuffer, IndexCount / 3, ParityLocalToWorld,
+			ParityCameraPosition, ParityMaxTessellationDistance, ParityMinTessellationFactor, ParityMaxTessellationFactor, TessFactorBuffer);
+		EnqueueReadback(GraphBuilder, TessFactorBuffer, IndexCount / 3, GPU.TessFactors, Readbacks);
+	});
+
+	TestStages(*this, TEXT("GPU"), Reference, GPU, GPUTolerances, true);
+	return true;
+}
+
+namespace GPUTessellationParityTests
+{
+	static const TCHAR* IndirectArgsCases[] = { TEXT("NoCulling"), TEXT("Box"), TEXT("PerspectiveView") };
+
+	/** Culling planes of an indirect argument case, outward facing as in FConvexVolume */
+	static void MakeIndirectArgsFrustum(const FString& CaseName, TArray<FPlane>& OutPlanes)
+	{
+		OutPlanes.Reset();
+		if (CaseName == TEXT("Box"))
+		{
+			OutPlanes.Add(FPlane(FVector(1, 0, 0), 1000.0));
+			OutPlanes.Add(FPlane(FVector(-1, 0, 0), 1000.0));
+			OutPlanes.Add(FPlane(FVector(0, 1, 0), 1000.0));
+			OutPlanes.Add(FPlane(FVector(0, -1, 0), 1000.0));
+			OutPlanes.Add(FPlane(FVector(0, 0, 1), 1000.0));
+			OutPlanes.Add(FPlane(FVector(0, 0, -1), 1000.0));
+		}
+		else if (CaseName == TEXT("PerspectiveView"))
+		{
+			// A view at the edge of the patch field looking across it, as the scene proxy culls per view
+			const FMatrix ViewMatrix = FLookAtMatrix(FVector(-2500.0, 0.0, 800.0), FVector(0.0, 500.0, 0.0), FVector(0.0, 0.0, 1.0));
+			const FMatrix ProjectionMatrix = FReversedZPerspectiveMatrix(FMath::DegreesToRadians(45.0), 16.0, 9.0, 10.0);
+			FConvexVolume ViewFrustum;
+			GetViewFrustumBounds(ViewFrustum, ViewMatrix * ProjectionMatrix, true);
+			OutPlanes = ViewFrustum.Planes;
+		}
+	}
+}
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FGPUTessellationIndirectArgsTest, "GPURuntimeTessellation.IndirectArgs",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+void FGPUTessellationIndirectArgsTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	for (const TCHAR* CaseName : GPUTessellationParityTests::IndirectArgsCases)
+	{
+		OutBeautifiedNames.Add(CaseName);
+		OutTestCommands.Add(CaseName);
+	}
+}
+
+/**
+ * Patch culling and indirect draw arguments of GPUPatchIndirectArgs.usf against FGPUTessellationCPUReference::BuildIndirectDrawArgs
+ * Random patch bounds and LOD levels (a few out of range) against no planes, a box and a perspective view frustum
+ */
+bool FGPUTessellationIndirectArgsTest::RunTest(const FString& Parameters)
+{
+	using namespace GPUTessellationParityTests;
+
+	const int32 NumPatches = 256;
+	const int32 NumLODs = 4;
+
+	// Random patches scattered around a 2000 unit box; patches past the last LOD level are never drawn
+	FRandomStream RandomStream(0x7E55);
+	TArray<FGPUTessellationPatchCullData> CullData;
+	CullData.SetNum(NumPatches);
+	for (FGPUTessellationPatchCullData& Patch : CullData)
+	{
+		Patch.BoundsCenter = FVector3f(
+			RandomStream.FRandRange(-2000.0f, 2000.0f),
+			RandomStream.FRandRange(-2000.0f, 2000.0f),
+			RandomStream.FRandRange(-500.0f, 500.0f));
+		Patch.BoundsExtent = FVector3f(RandomStream.FRandRange(10.0f, 200.0f), RandomStream.FRandRange(10.0f, 200.0f), 50.0f);
+		Patch.LODIndex = RandomStream.RandRange(0, NumLODs);
+	}
+
+	TArray<FUintVector4> LODIndexRanges;
+	uint32 FirstIndex = 0;
+	for (int32 LODIndex = 0; LODIndex < NumLODs; ++LODIndex)
+	{
+		const uint32 Segments = 64u >> LODIndex;
+		LODIndexRanges.Add(FUintVector4(Segments * Segments * 6, FirstIndex, 0, 0));
+		FirstIndex += Segments * Segments * 6;
+	}
+
+	TArray<FPlane> FrustumPlanes;
+	MakeIndirectArgsFrustum(Parameters, FrustumPlanes);
+
+	TArray<FRHIDrawIndexedIndirectParameters> ReferenceArgs;
+	TArray<TArray<uint32>> ReferenceVisiblePatches;
+	FGPUTessellationCPUReference::BuildIndirectDrawArgs(CullData, LODIndexRanges, FrustumPlanes, ReferenceArgs, ReferenceVisiblePatches);
+
+	// The reference culls exactly like the renderer
+	const FConvexVolume ConvexVolume(FrustumPlanes);
+	int32 ExpectedVisible = 0;
+	int32 ReferenceVisible = 0;
+	for (const FGPUTessellationPatchCullData& Patch : CullData)
+	{
+		if (Patch.LODIndex < (uint32)NumLODs && ConvexVolume.IntersectBox(FVector(Patch.BoundsCenter), FVector(Patch.BoundsExtent)))
+		{
+			ExpectedVisible++;
+		}
+	}
+	for (const FRHIDrawIndexedIndirectParameters& Args : ReferenceArgs)
+	{
+		ReferenceVisible += Args.InstanceCount;
+	}
+	TestEqual(TEXT("Reference visible patches match FConvexVolume::IntersectBox"), ReferenceVisible, ExpectedVisible);
+	if (FrustumPlanes.Num() > 0)
+	{
+		TestTrue(TEXT("Frustum culls some patches and keeps others"), ReferenceVisible > 0 && ReferenceVisible < NumPatches);
+	}
+
+	if (!CanRunOnGPU())
+	{
+		AddInfo(TEXT("No RHI; the GPU comparison was skipped"));
+		return true;
+	}
+
+	TArray<FRHIDrawIndexedIndirectParameters> GPUArgs;
+	TArray<uint32> GPUVisiblePatchList;
+	ExecuteAndReadBack([&CullData, &LODIndexRanges, &FrustumPlanes, &GPUArgs, &GPUVisiblePatchList, NumPatches, NumLODs](FRDGBuilder& GraphBuilder, TArray<FParityReadback>& Readbacks)
+	{
+		FRDGBufferRef IndirectArgsBuffer = GraphBuilder.CreateBuffer(
+			FRDGBufferDesc::CreateIndirectDesc<FRHIDrawIndexedIndirectParameters>(NumLODs),
+			TEXT("GPUTessellation.TestIndirectArgs"));
+		FRDGBufferRef VisiblePatchListBuffer = GraphBuilder.CreateBuffer(
+			FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), NumLODs * NumPatches),
+			TEXT("GPUTessellation.TestVisiblePatchList"));
+
+		FGPUTessellationMeshBuilder::AddBuildIndirectArgsPass(
+			GraphBuilder,
+			GraphBuilder.CreateSRV(CreateStructuredBuffer(GraphBuilder, TEXT("GPUTessellation.TestCullData"), CullData)),
+			NumPatches,
+			LODIndexRanges,
+			FrustumPlanes,
+			NumPatches,
+			IndirectArgsBuffer,
+			VisiblePatchListBuffer);
+
+		EnqueueReadback(GraphBuilder, IndirectArgsBuffer, NumLODs, GPUArgs, Readbacks);
+		EnqueueReadback(GraphBuilder, VisiblePatchListBuffer, NumLODs * NumPatches, GPUVisiblePatchList, Readbacks);
+	});
+
+	for (int32 LODIndex = 0; LODIndex < NumLODs; ++LODIndex)
+	{
+		const FRHIDrawIndexedIndirectParameters& Expected = ReferenceArgs[LODIndex];
+		const FRHIDrawIndexedIndirectParameters& Actual = GPUArgs[LODIndex];
+		auto What = [LODIndex](const TCHAR* Field) { return FString::Printf(TEXT("LOD %d %s"), LODIndex, Field); };
+
+		TestEqual(*What(TEXT("IndexCountPerInstance")), (int32)Actual.IndexCountPerInstance, (int32)Expected.IndexCountPerInstance);
+		TestEqual(*What(TEXT("InstanceCount")), (int32)Actual.InstanceCount, (int32)Expected.InstanceCount);
+		TestEqual(*What(TEXT("StartIndexLocation")), (int32)Actual.StartIndexLocation, (int32)Expected.StartIndexLocation);
+		TestEqual(*What(TEXT("BaseVertexLocation")), Actual.BaseVertexLocation, Expected.BaseVertexLocation);
+		TestEqual(*What(TEXT("StartInstanceLocation")), (int32)Actual.StartInstanceLocation, (int32)Expected.StartInstanceLocation);
+
+		// GPU append order depends on thread scheduling
+		if (Actual.InstanceCount == Expected.InstanceCount)
+		{
+			TArray<uint32> VisiblePatches(&GPUVisiblePatchList[LODIndex * NumPatches], Actual.InstanceCount);
+			VisiblePatches.Sort();
+			TestTrue(*What(TEXT("visible patch list matches")), VisiblePatches == ReferenceVisiblePatches[LODIndex]);
+		}
+	}
+	return true;
+}
+
+namespace GPUTessellationParityTests
+{
+	/** Grids around the 8x8 normal tiles: smaller than a tile, exact tiles, one past a tile, ragged and the factor 16 grid */
+	static const FIntPoint NormalGridResolutions[] = { FIntPoint(5, 5), FIntPoint(8, 8), FIntPoint(9, 9), FIntPoint(13, 21), FIntPoint(30, 11), FIntPoint(65, 65) };
+
+	/** Largest angle between corresponding normals over the vertices a filter accepts */
+	template <typename FilterType>
+	static float MaxFilteredNormalAngleError(FIntPoint Resolution, const TArray<FVector3f>& Actual, const TArray<FVector3f>& Expected, FilterType Filter)
+	{
+		float MaxError = 0.0f;
+		for (int32 Y = 0; Y < Resolution.Y; ++Y)
+		{
+			for (int32 X = 0; X < Resolution.X; ++X)
+			{
+				if (Filter(X, Y))
+				{
+					const int32 VertexIndex = Y * Resolution.X + X;
+					MaxError = FMath::Max(MaxError, AngleDegrees(Actual[VertexIndex], Expected[VertexIndex]));
+				}
+			}
+		}
+		return MaxError;
+	}
+
+	/** Check every vertex, the vertices on 8x8 tile borders (read from the groupshared halo) and the grid border (extrapolated halo) */
+	static void TestNormals(FAutomationTestBase& Test, const TCHAR* Against, FIntPoint Resolution, const TArray<FVector3f>& Actual, const TArray<FVector3f>& Expected, float ToleranceDegrees)
+	{
+		if (!Test.TestEqual(*FString::Printf(TEXT("Normal count (%s)"), Against), Actual.Num(), Expected.Num()))
+		{
+			return;
+		}
+
+		auto AllVertices = [](int32 X, int32 Y) { return true; };
+		auto TileBorders = [](int32 X, int32 Y) { return X % 8 == 0 || X % 8 == 7 || Y % 8 == 0 || Y % 8 == 7; };
+		auto GridBorder = [Resolution](int32 X, int32 Y) { return X == 0 || Y == 0 || X == Resolution.X - 1 || Y == Resolution.Y - 1; };
+
+		Test.TestEqual(*FString::Printf(TEXT("Max normal angle, every vertex (%s)"), Against),
+			MaxFilteredNormalAngleError(Resolution, Actual, Expected, AllVertices), 0.0f, ToleranceDegrees);
+		Test.TestEqual(*FString::Printf(TEXT("Max normal angle, tile borders (%s)"), Against),
+			MaxFilteredNormalAngleError(Resolution, Actual, Expected, TileBorders), 0.0f, ToleranceDegrees);
+		Test.TestEqual(*FString::Printf(TEXT("Max normal angle, grid border (%s)"), Against),
+			MaxFilteredNormalAngleError(Resolution, Actual, Expected, GridBorder), 0.0f, ToleranceDegrees);
+	}
+}
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FGPUTessellationTiledNormalsTest, "GPURuntimeTessellation.TiledNormals",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+void FGPUTessellationTiledNormalsTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	for (const FIntPoint& Resolution : GPUTessellationParityTests::NormalGridResolutions)
+	{
+		OutBeautifiedNames.Add(FString::Printf(TEXT("%dx%d"), Resolution.X, Resolution.Y));
+		OutTestCommands.Add(FString::Printf(TEXT("%d %d"), Resolution.X, Resolution.Y));
+	}
+}
+
+/**
+ * Groupshared tiled finite difference normals (GPUNormalCalculation.usf) against FGPUTessellationCPUReference::CalculateFiniteDifferenceNormals
+ * Uses the procedural sine wave, so no texture data is needed on the CPU side
+ */
+bool FGPUTessellationTiledNormalsTest::RunTest(const FString& Parameters)
+{
+	using namespace GPUTessellationParityTests;
+
+	FString ResolutionX;
+	FString ResolutionY;
+	if (!TestTrue(TEXT("Grid resolution parameter"), Parameters.Split(TEXT(" "), &ResolutionX, &ResolutionY)))
+	{
+		return false;
+	}
+	const FIntPoint Resolution(FCString::Atoi(*ResolutionX), FCString::Atoi(*ResolutionY));
+
+	FGPUTessellationSettings Settings;
+	Settings.bUseSineWaveDisplacement = true;
+	Settings.NormalCalculationMethod = EGPUTessellationNormalMethod::FiniteDifference;
+	Settings.NormalSmoothingFactor = 0.0f;
+
+	auto HeightFunction = [](const FVector2f& UV) { return FGPUTessellationCPUReference::SineWaveHeight(UV); };
+	TArray<FVector3f> ReferenceNormals;
+	FGPUTessellationCPUReference::CalculateFiniteDifferenceNormals(Settings, Resolution, HeightFunction, ReferenceNormals);
+
+	// The kernel reference reads displaced positions inside the grid and the height function only in the halo
+	FGPUTessellatedMeshData Mesh;
+	FGPUTessellationCPUReference::GenerateVertices(Settings, Resolution, Mesh);
+	FGPUTessellationCPUReference::ApplyDisplacement(Settings, HeightFunction, Mesh);
+	FGPUTessellationCPUReference::CalculateNormals(Settings, HeightFunction, [](const FVector2f& UV) { return FVector3f(1.0f); }, Mesh);
+	TestNormals(*this, TEXT("kernel reference"), Resolution, Mesh.Normals, ReferenceNormals, 0.05f);
+
+	if (!CanRunOnGPU())
+	{
+		AddInfo(TEXT("No RHI; the GPU comparison was skipped"));
+		return true;
+	}
+
+	TArray<FVector3f> GPUNormals;
+	ExecuteAndReadBack([&Settings, &GPUNormals, Resolution](FRDGBuilder& GraphBuilder, TArray<FParityReadback>& Readbacks)
+	{
+		FGPUTessellationMeshBuilder MeshBuilder;
+		FRDGBufferRef VertexBuffer = nullptr;
+		FRDGBufferRef NormalBuffer = nullptr;
+		FRDGBufferRef UVBuffer = nullptr;
+
+		MeshBuilder.DispatchVertexGeneration(GraphBuilder, Settings, Resolution, FMatrix::Identity, FVector::ZeroVector, VertexBuffer, NormalBuffer, UVBuffer);
+		MeshBuilder.DispatchDisplacement(GraphBuilder, Settings, Resolution, nullptr, nullptr, VertexBuffer, NormalBuffer, UVBuffer);
+		MeshBuilder.DispatchNormalCalculation(GraphBuilder, Settings, Resolution, nullptr, nullptr, nullptr, VertexBuffer, NormalBuffer, UVBuffer);
+		EnqueueReadback(GraphBuilder, NormalBuffer, Resolution.X * Resolution.Y, GPUNormals, Readbacks);
+	});
+
+	TestNormals(*this, TEXT("GPU"), Resolution, GPUNormals, ReferenceNormals, 0.5f);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -17,4 +17,11 @@ public:
 	/** IModuleInterface implementation */
 	virtual void StartupModule() override;
 	virtual void ShutdownModule() override;
+
+private:
+	/** Samples buffer memory for the CSV profiler */
+	FDelegateHandle EndFrameHandle;
+
+	/** Hands landed readbacks of the on-disk mesh cache to its writers */
+	FDelegateHandle EndFrameRTHandle;
 };
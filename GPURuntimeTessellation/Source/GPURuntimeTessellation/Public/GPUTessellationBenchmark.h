@@ -0,0 +1,24 @@
+// Licensed under the MIT License. See LICENSE file in the project root.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Micro benchmarks for the per frame CPU work of patch mode
+ *
+ * Times patch info and culling, edge transitions, LOD level selection, resolution conversion,
+ * component bounds and the per patch bounds setup of FGPUTessellationSceneProxy::RenderPatches
+ * (PatchPrimitiveBounds) for a range of patch grids. None of it needs an RHI, so it runs under -nullrhi on build machines.
+ */
+class GPURUNTIMETESSELLATION_API FGPUTessellationBenchmark
+{
+public:
+	/**
+	 * Run every benchmark on square patch grids and write the results as CSV (game thread)
+	 * @param PatchCounts - Patches per side of each grid, e.g. 4, 8, 16, 32
+	 * @param Iterations - Timed repetitions per benchmark; min and mean are reported
+	 * @return Path of the CSV file, empty if it could not be written
+	 */
+	static FString Run(TConstArrayView<int32> PatchCounts, int32 Iterations);
+};
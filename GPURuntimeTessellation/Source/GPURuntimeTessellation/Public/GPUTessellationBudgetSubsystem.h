@@ -0,0 +1,103 @@
+// Licensed under the MIT License. See LICENSE file in the project root.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "Containers/Ticker.h"
+#include "GPUTessellationBudgetSubsystem.generated.h"
+
+class UGPUTessellationComponent;
+
+/**
+ * Global vertex and GPU memory budget for every tessellation component
+ *
+ * Components register themselves while registered with a world. A few times per second the subsystem
+ * estimates what every component would use at full detail and, while that exceeds
+ * r.GPUTessellation.Budget.MaxVertices or r.GPUTessellation.Budget.MaxMemoryMB, raises the LOD bias of
+ * the least important components first. Importance is BudgetPriority times the screen size of the
+ * bounds seen from the nearest view; components outside every view frustum or not rendered recently go first.
+ *
+ * Every bias step halves the tessellation factor (spatial patches use the patch level one distance band
+ * further out), so it roughly quarters the component's vertices and memory.
+ */
+UCLASS()
+class GPURUNTIMETESSELLATION_API UGPUTessellationBudgetSubsystem : public UEngineSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//~ Begin USubsystem Interface
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	//~ End USubsystem Interface
+
+	/** The engine's budget subsystem; null before the engine is initialized */
+	static UGPUTessellationBudgetSubsystem* Get();
+
+	/** Start budgeting a component (game thread) */
+	void RegisterComponent(UGPUTessellationComponent* Component);
+
+	/** Stop budgeting a component and clear its LOD bias (game thread) */
+	void UnregisterComponent(UGPUTessellationComponent* Component);
+
+	/** Reevaluate every component's LOD bias now instead of at the next update interval (game thread) */
+	void UpdateBudget();
+
+	/** Vertices of every registered component's rendered buffers, as of the last update */
+	UFUNCTION(BlueprintPure, Category = "GPU Tessellation|Budget")
+	int64 GetVertexUsage() const { return VertexUsage; }
+
+	/** GPU buffer memory of every registered component, as of the last update */
+	UFUNCTION(BlueprintPure, Category = "GPU Tessellation|Budget")
+	int64 GetMemoryUsageBytes() const { return MemoryUsageBytes; }
+
+	/**
+	 * Estimated full detail demand over the budget, by the tighter of the vertex and memory limits
+	 * Above 1 the budget is biasing components; 0 without a budget.
+	 */
+	UFUNCTION(BlueprintPure, Category = "GPU Tessellation|Budget")
+	float GetBudgetPressure() const { return BudgetPressure; }
+
+	/** Components currently rendered with a budget LOD bias */
+	UFUNCTION(BlueprintPure, Category = "GPU Tessellation|Budget")
+	int32 GetBiasedComponentCount() const { return BiasedComponentCount; }
+
+	/** Log every registered component with its importance, usage and LOD bias */
+	void LogReport() const;
+
+private:
+	/** What the budget knows about one component */
+	struct FBudgetEntry
+	{
+		TWeakObjectPtr<UGPUTessellationComponent> Component;
+
+		/** Vertices and bytes at LOD bias 0, estimated from the last settled measurement */
+		int64 FullDetailVertices = 0;
+		int64 FullDetailBytes = 0;
+
+		/** The bias changed at the last update, so the rendered buffers may not reflect it yet */
+		bool bBiasChanged = false;
+
+		/** Importance at the last update; lower is biased first */
+		float Importance = 0.0f;
+	};
+
+	/** Core ticker callback; updates at r.GPUTessellation.Budget.UpdateInterval */
+	bool Tick(float DeltaTime);
+
+	/** Sample the stat system and the CSV profiler */
+	void RecordStats() const;
+
+	TArray<FBudgetEntry> Entries;
+
+	FTSTicker::FDelegateHandle TickHandle;
+
+	/** Seconds since the last update */
+	float TimeSinceUpdate = 0.0f;
+
+	int64 VertexUsage = 0;
+	int64 MemoryUsageBytes = 0;
+	float BudgetPressure = 0.0f;
+	int32 BiasedComponentCount = 0;
+};
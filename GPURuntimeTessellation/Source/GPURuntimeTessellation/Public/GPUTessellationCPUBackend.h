@@ -0,0 +1,84 @@
+// Licensed under the MIT License. See LICENSE file in the project root.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GPUTessellationComponent.h"
+#include "GPUTessellationMeshBuilder.h"
+#include "GPUTessellationHeightSampler.h"
+
+/**
+ * CPU copies of the textures the tessellation pipeline samples
+ * Built on the game thread; afterwards read-only, so the pipeline may run on any thread
+ */
+struct GPURUNTIMETESSELLATION_API FGPUTessellationCPUTextures
+{
+	/** Displacement and subtract textures */
+	FGPUTessellationHeightSampler HeightSampler;
+
+	/** Normal map red, green and blue channels; an invalid channel samples as 1, like the GPU's default white texture */
+	FGPUTessellationHeightTexture NormalMap[3];
+
+	/**
+	 * Copy the textures the settings use (game thread)
+	 * Sine wave displacement skips the height textures, other normal methods skip the normal map.
+	 * @return false if a texture could not be read (see FGPUTessellationHeightTexture::ReadTexture)
+	 */
+	bool Build(const FGPUTessellationSettings& Settings, UTexture* DisplacementTexture, UTexture* SubtractTexture, UTexture* NormalMapTexture);
+
+	/** Normal map texel as stored (0-1 range), bilinear with clamp addressing */
+	FVector3f SampleNormalMap(const FVector2f& UV) const;
+};
+
+/**
+ * Headless implementation of FGPUTessellationMeshBuilder::ExecuteTessellationPipeline
+ *
+ * Runs every stage of the single mesh pipeline on the CPU for dedicated servers, commandlets and
+ * tools that have no RHI. Each stage mirrors its compute shader (GPUVertexGeneration.usf,
+ * GPUDisplacement.usf, GPUNormalCalculation.usf, GPUTangentCalculation.usf, GPUIndexGeneration.usf)
+ * and produces the same FGPUTessellatedMeshData up to float rounding. Rows are spread over
+ * worker threads with ParallelFor; displacement and finite difference normals run four vertices
+ * per SIMD register.
+ *
+ * GenerateMeshAsync and GenerateMeshSync switch to it automatically when IsActive().
+ */
+class GPURUNTIMETESSELLATION_API FGPUTessellationCPUBackend
+{
+public:
+	/**
+	 * Should meshes be generated on the CPU? True without rendering, or when forced by r.GPUTessellation.CPUBackend
+	 */
+	static bool IsActive();
+
+	/**
+	 * Generate mesh data on the calling thread
+	 * @param Textures - CPU texture copies built from the same settings
+	 * @param Content - PositionsOnly skips normals, UVs and indices like the GPU readback
+	 */
+	static void ExecuteTessellationPipeline(
+		const FGPUTessellationSettings& Settings,
+		const FGPUTessellationCPUTextures& Textures,
+		FGPUTessellatedMeshData& OutMeshData,
+		EGPUTessellationReadbackContent Content = EGPUTessellationReadbackContent::Full);
+
+	/** Flat grid in local space with up normals and remapped UVs (GPUVertexGeneration.usf) */
+	static void GenerateVertices(const FGPUTessellationSettings& Settings, FIntPoint Resolution, FGPUTessellatedMeshData& MeshData);
+
+	/** Move vertices along their normals by the sampled height (GPUDisplacement.usf) */
+	static void ApplyDisplacement(const FGPUTessellationSettings& Settings, const FGPUTessellationHeightSampler& HeightSampler, FGPUTessellatedMeshData& MeshData);
+
+	/** Recalculate normals of displaced vertices with the settings' method (GPUNormalCalculation.usf) */
+	static void CalculateNormals(const FGPUTessellationSettings& Settings, const FGPUTessellationCPUTextures& Textures, FGPUTessellatedMeshData& MeshData);
+
+	/**
+	 * Tangents with the binormal sign in w (GPUTangentCalculation.usf)
+	 * Mesh data has no tangent stream, so this is for callers that build their own vertex format
+	 */
+	static void CalculateTangents(const FGPUTessellatedMeshData& MeshData, TArray<FVector4f>& OutTangents);
+
+	/**
+	 * Two triangles per grid quad (GPUIndexGeneration.usf)
+	 * @param EdgeCollapseFactors - West, east, south and north strides that snap edge vertices onto a coarser neighbor
+	 */
+	static void GenerateIndices(FIntPoint Resolution, const FIntVector4& EdgeCollapseFactors, TArray<uint32>& OutIndices);
+};
@@ -0,0 +1,114 @@
+// Licensed under the MIT License. See LICENSE file in the project root.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GPUTessellationComponent.h"
+#include "GPUTessellationMeshBuilder.h"
+
+/**
+ * CPU reference implementations of the tessellation compute shaders
+ *
+ * Straightforward scalar versions of the GPU kernels, written for readability rather
+ * than speed. They are the ground truth the GPU results get compared against in the
+ * GPURuntimeTessellation automation tests.
+ */
+class GPURUNTIMETESSELLATION_API FGPUTessellationCPUReference
+{
+public:
+	/**
+	 * Height source before intensity/offset, sampled at a (possibly out of range) UV
+	 * Must match SampleDisplacement in GPUDisplacement.usf: texture * (1 - mask) or the sine wave
+	 */
+	typedef TFunctionRef<float(const FVector2f& UV)> FHeightFunction;
+
+	/** Normal map texel as stored (0-1 range); a missing normal map samples as white */
+	typedef TFunctionRef<FVector3f(const FVector2f& UV)> FNormalMapFunction;
+
+	/** Procedural height used by bUseSineWaveDisplacement (GPUDisplacement.usf) */
+	static float SineWaveHeight(const FVector2f& UV);
+
+	/**
+	 * Finite difference normals as computed by the tiled CalculateNormals kernel
+	 * Each vertex uses its four grid neighbors; neighbors past the grid edge are evaluated
+	 * at the extrapolated grid UV (the GPU halo).
+	 *
+	 * @param Settings - Tessellation settings (plane size, intensity, UV remap, invert)
+	 * @param Resolution - Grid resolution in vertices
+	 * @param HeightFunction - Height source matching the displacement shader
+	 * @param OutNormals - Resolution.X * Resolution.Y normals, row major
+	 */
+	static void CalculateFiniteDifferenceNormals(
+		const FGPUTessellationSettings& Settings,
+		FIntPoint Resolution,
+		FHeightFunction HeightFunction,
+		TArray<FVector3f>& OutNormals);
+
+	/**
+	 * GenerateVertices in GPUVertexGeneration.usf: flat local space grid, up normals, remapped UVs
+	 */
+	static void GenerateVertices(const FGPUTessellationSettings& Settings, FIntPoint Resolution, FGPUTessellatedMeshData& OutMeshData);
+
+	/**
+	 * ApplyDisplacement in GPUDisplacement.usf: move every vertex along its normal by height * intensity + offset
+	 */
+	static void ApplyDisplacement(const FGPUTessellationSettings& Settings, FHeightFunction HeightFunction, FGPUTessellatedMeshData& MeshData);
+
+	/**
+	 * CalculateNormals in GPUNormalCalculation.usf for every method
+	 * Unlike CalculateFiniteDifferenceNormals, heights inside the grid come from the displaced positions
+	 * and only the halo evaluates HeightFunction, exactly like the shader's height tile.
+	 */
+	static void CalculateNormals(
+		const FGPUTessellationSettings& Settings,
+		FHeightFunction HeightFunction,
+		FNormalMapFunction NormalMapFunction,
+		FGPUTessellatedMeshData& MeshData);
+
+	/**
+	 * CalculateTangentsCS in GPUTangentCalculation.usf
+	 * @param OutTangents - xyz = tangent, w = binormal sign
+	 */
+	static void CalculateTangents(const FGPUTessellatedMeshData& MeshData, TArray<FVector4f>& OutTangents);
+
+	/**
+	 * GenerateIndices in GPUIndexGeneration.usf, including ApplyEdgeCollapse
+	 * @param EdgeCollapseFactors - West, east, south and north strides
+	 */
+	static void GenerateIndices(FIntPoint Resolution, const FIntVector4& EdgeCollapseFactors, TArray<uint32>& OutIndices);
+
+	/**
+	 * CalculateTessellationFactors in GPUTessellationFactor.usf: one distance based factor per triangle
+	 */
+	static void CalculateTessellationFactors(
+		const TArray<FVector3f>& Vertices,
+		const TArray<uint32>& Indices,
+		const FMatrix& LocalToWorld,
+		const FVector& CameraPosition,
+		float MaxTessellationDistance,
+		float MinTessellationFactor,
+		float MaxTessellationFactor,
+		TArray<float>& OutFactors);
+
+	/**
+	 * Largest angle (degrees) between corresponding normals, or -1 if the arrays differ in size
+	 */
+	static float MaxNormalAngleError(const TArray<FVector3f>& A, const TArray<FVector3f>& B);
+
+	/**
+	 * Indirect draw arguments as built by GPUPatchIndirectArgs.usf
+	 * Visible patch order is unspecified on the GPU; compare the lists as sets.
+	 *
+	 * @param PatchCullData - Bounds and LOD level per patch
+	 * @param LODIndexRanges - Per LOD level: x = index count per instance, y = first index
+	 * @param FrustumPlanes - Culling planes (FConvexVolume convention); empty disables culling
+	 * @param OutArgs - One FRHIDrawIndexedIndirectParameters per LOD level
+	 * @param OutVisiblePatches - Visible patch indices per LOD level, in patch order
+	 */
+	static void BuildIndirectDrawArgs(
+		const TArray<FGPUTessellationPatchCullData>& PatchCullData,
+		const TArray<FUintVector4>& LODIndexRanges,
+		const TArray<FPlane>& FrustumPlanes,
+		TArray<FRHIDrawIndexedIndirectParameters>& OutArgs,
+		TArray<TArray<uint32>>& OutVisiblePatches);
+};
@@ -7,9 +7,18 @@
 #include "Engine/Texture.h"
 #include "Engine/Texture2D.h"
 #include "Materials/MaterialInterface.h"
+#include "Async/Future.h"
+#include "Interfaces/Interface_CollisionDataProvider.h"
+#include "GPUTessellationStats.h"
 #include "GPUTessellationComponent.generated.h"
 
 class FGPUTessellationSceneProxy;
+class FGPUTessellationContentChecksum;
+class UBodySetup;
+class FGPUTessellationHeightSampler;
+struct FGPUTessellatedMeshData;
+struct FGPUTessellationCachedMesh;
+enum class EGPUTessellationRegenerationTrigger : uint8;
 
 /**
  * Normal calculation methods for tessellated geometry
@@ -52,6 +61,17 @@ enum class EGPUTessellationPatchLevel : uint8
 	Patch_128 UMETA(DisplayName = "128 (Ultra)")
 };
 
+/**
+ * What triggers mesh regeneration for render target textures
+ */
+UENUM(BlueprintType)
+enum class EGPUTessellationRenderTargetUpdateMode : uint8
+{
+	Continuous UMETA(DisplayName = "Continuous (Every Update Interval)"),
+	ContentChecksum UMETA(DisplayName = "On Content Change (GPU Checksum)"),
+	OnNotify UMETA(DisplayName = "On Notify Only (NotifyDisplacementChanged)")
+};
+
 /**
  * Settings structure for GPU tessellation
  */
@@ -191,8 +211,8 @@ struct FGPUTessellationSettings
  * Pure compute shader-based tessellation component that replaces Hull/Domain shaders.
  * Generates a tessellated plane with displacement mapping entirely on the GPU.
  */
-UCLASS(ClassGroup = (Rendering), meta = (BlueprintSpawnableComponent), hidecategories = (Object, LOD, Physics, Collision))
-class GPURUNTIMETESSELLATION_API UGPUTessellationComponent : public UMeshComponent
+UCLASS(ClassGroup = (Rendering), meta = (BlueprintSpawnableComponent), hidecategories = (Object, LOD, Physics))
+class GPURUNTIMETESSELLATION_API UGPUTessellationComponent : public UMeshComponent, public IInterface_CollisionDataProvider
 {
 	GENERATED_BODY()
 
@@ -205,8 +225,15 @@ public:
 	virtual void GetUsedMaterials(TArray<UMaterialInterface*>& OutMaterials, bool bGetDebugMaterials = false) const override;
 	virtual int32 GetNumMaterials() const override;
 	virtual UMaterialInterface* GetMaterial(int32 ElementIndex) const override;
+	virtual UBodySetup* GetBodySetup() override;
 	//~ End UPrimitiveComponent Interface
 
+	//~ Begin IInterface_CollisionDataProvider Interface
+	virtual bool GetPhysicsTriMeshData(struct FTriMeshCollisionData* CollisionData, bool InUseAllTriData) override;
+	virtual bool ContainsPhysicsTriMeshData(bool InUseAllTriData) const override;
+	virtual bool WantsNegXTriMesh() override { return false; }
+	//~ End IInterface_CollisionDataProvider Interface
+
 	//~ Begin USceneComponent Interface
 	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 	//~ End USceneComponent Interface
@@ -216,11 +243,17 @@ public:
 	virtual void OnUnregister() override;
 	//~ End UActorComponent Interface
 
-#if WITH_EDITOR
 	//~ Begin UObject Interface
+	virtual void GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize) override;
+#if WITH_EDITOR
 	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
-	//~ End UObject Interface
 #endif
+	//~ End UObject Interface
+
+protected:
+	//~ Begin USceneComponent Interface
+	virtual void OnUpdateTransform(EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport = ETeleportType::None) override;
+	//~ End USceneComponent Interface
 
 public:
 	/** Tessellation settings */
@@ -243,18 +276,41 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GPU Tessellation")
 	TObjectPtr<UMaterialInterface> Material;
 
-	/** Enable automatic updates based on camera movement */
+	/**
+	 * Enable automatic updates based on camera movement
+	 * Idle components stop ticking (r.GPUTessellation.SleepWhenIdle); after changing properties directly, call UpdateTessellatedMesh.
+	 */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GPU Tessellation")
 	bool bAutoUpdate = true;
 
-	/** Enable automatic updates for render target textures - Updates mesh every frame when render targets are used */
+	/** Enable automatic updates for render target textures - See RenderTargetUpdateMode for what triggers an update */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GPU Tessellation|Render Target")
 	bool bAutoUpdateRenderTargets = true;
 
+	/** What triggers regeneration for render target textures - Continuous regenerates even when nothing was drawn */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GPU Tessellation|Render Target", meta = (EditCondition = "bAutoUpdateRenderTargets", EditConditionHides))
+	EGPUTessellationRenderTargetUpdateMode RenderTargetUpdateMode = EGPUTessellationRenderTargetUpdateMode::ContentChecksum;
+
 	/** Limit render target update rate (FPS) - 0 means unlimited (update every frame) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GPU Tessellation|Render Target", meta = (ClampMin = "0", ClampMax = "120", UIMin = "0", UIMax = "120", EditCondition = "bAutoUpdateRenderTargets", EditConditionHides))
 	int32 RenderTargetUpdateFPS = 60;
 
+	/** Build a triangle mesh collision from the displaced surface (cooked asynchronously, never blocks the game thread) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GPU Tessellation|Collision")
+	bool bGenerateCollision = false;
+
+	/** Tessellation factor of the collision mesh - independent of the render LOD, keep it low */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GPU Tessellation|Collision", meta = (ClampMin = "1", ClampMax = "64", UIMin = "1", UIMax = "64", EditCondition = "bGenerateCollision", EditConditionHides))
+	int32 CollisionTessellationFactor = 8;
+
+	/** Seconds without further displacement changes before the collision is rebuilt (coalesces painting strokes) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GPU Tessellation|Collision", meta = (ClampMin = "0", UIMin = "0", UIMax = "2", EditCondition = "bGenerateCollision", EditConditionHides))
+	float CollisionRebuildDelay = 0.25f;
+
+	/** Weight against the global budget (r.GPUTessellation.Budget.*); lower priority components lose detail first, 0 always does */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GPU Tessellation|Budget", meta = (ClampMin = "0", UIMin = "0", UIMax = "10"))
+	float BudgetPriority = 1.0f;
+
 	/** Enable debug logging (throttled to every 2 seconds) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GPU Tessellation|Debug")
 	bool bEnableDebugLogging = false;
@@ -264,7 +320,7 @@ public:
 	bool bShowPatchDebugVisualization = false;
 
 public:
-	/** Blueprint callable function to force mesh update */
+	/** Regenerate the mesh - reruns the compute pipeline in place if the grid layout is unchanged, otherwise recreates the scene proxy */
 	UFUNCTION(BlueprintCallable, Category = "GPU Tessellation")
 	void UpdateTessellatedMesh();
 
@@ -280,6 +336,18 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "GPU Tessellation")
 	void SetNormalMapTexture(UTexture* InTexture);
 
+	/** Call after drawing into a displacement, subtract or normal map render target - regenerates on the next update interval */
+	UFUNCTION(BlueprintCallable, Category = "GPU Tessellation|Render Target")
+	void NotifyDisplacementChanged();
+
+	/**
+	 * Regenerate only the vertices affected by an edit inside a texture UV rectangle (0-1)
+	 * Regions are gathered until the next tick. Spatial patch mode and layout changes fall back to a full update.
+	 * Use RenderTargetUpdateMode OnNotify so the content checksum does not also trigger a full update.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GPU Tessellation|Render Target")
+	void MarkDisplacementRegionDirty(const FBox2D& UVRegion);
+
 	/** Set material (overrides parent method) */
 	virtual void SetMaterial(int32 ElementIndex, UMaterialInterface* InMaterial) override;
 
@@ -299,6 +367,50 @@ public:
 	UFUNCTION(BlueprintPure, Category = "GPU Tessellation")
 	int32 GetTriangleCount() const;
 
+	/** GPU memory of the rendered buffers by stream (zero without a scene proxy) */
+	FGPUTessellationBufferMemory GetBufferMemory() const;
+
+	/** Total GPU memory of the rendered buffers */
+	UFUNCTION(BlueprintPure, Category = "GPU Tessellation")
+	int64 GetGPUMemoryBytes() const { return (int64)GetBufferMemory().GetTotalBytes(); }
+
+	/** Vertices of the rendered buffers (zero without a scene proxy) */
+	int64 GetRenderedVertexCount() const;
+
+	/** Cached single mesh within GetBufferMemory, possibly shared with other components, and its bytes (nullptr if none) */
+	const FGPUTessellationCachedMesh* GetSingleMeshMemory(uint64& OutBytes) const;
+
+	/** LOD bias set by the global budget; every step halves the tessellation factor */
+	UFUNCTION(BlueprintPure, Category = "GPU Tessellation|Budget")
+	int32 GetBudgetLODBias() const { return BudgetLODBias; }
+
+	/**
+	 * Read the tessellated mesh back to the CPU without stalling the game or render thread (component space)
+	 * Uses the current settings, LOD factor and textures; the future is fulfilled on the game thread a few frames later.
+	 * Blueprints use the Extract Tessellated Mesh Async node.
+	 */
+	TFuture<FGPUTessellatedMeshData> ExtractMeshAsync() const;
+
+	/**
+	 * Surface height (world Z) under a world location, evaluated on the CPU exactly like GPUDisplacement.usf
+	 * Reads CPU copies of the displacement and subtract textures (built on first use); render targets are not supported.
+	 * @return false outside the plane or if a texture is not CPU readable
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GPU Tessellation|Height")
+	bool SampleHeight(const FVector& WorldLocation, float& OutHeight);
+
+	/**
+	 * SampleHeight for many locations at once (SIMD)
+	 * @param OutValid - Per location: false where SampleHeight would return false (outside the plane); its height is 0
+	 * @return false if a texture is not CPU readable
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GPU Tessellation|Height")
+	bool SampleHeightBatch(const TArray<FVector>& WorldLocations, TArray<float>& OutHeights, TArray<bool>& OutValid);
+
+	/** Rebuild the collision mesh after CollisionRebuildDelay (settings and displacement changes do this automatically) */
+	UFUNCTION(BlueprintCallable, Category = "GPU Tessellation|Collision")
+	void RebuildCollision();
+
 private:
 	/** Mark render state dirty and request update */
 	void MarkRenderStateDirty();
@@ -306,6 +418,18 @@ private:
 	/** Calculate grid resolution from tessellation factor */
 	FIntPoint CalculateGridResolution() const;
 
+	/** Called by the budget subsystem; regenerates when the bias changes */
+	void SetBudgetLODBias(int32 InBias);
+
+	/** Halve a tessellation factor once per budget LOD bias step (never below 1) */
+	int32 ApplyBudgetLODBias(int32 Factor) const { return Factor > 0 && BudgetLODBias > 0 ? FMath::Max(Factor >> BudgetLODBias, 1) : Factor; }
+
+	/** The LOD tessellation factor the mesh is built with, after the budget bias */
+	int32 GetLODTessellationFactor() const { return ApplyBudgetLODBias(LastAppliedTessFactor); }
+
+	/** TessellationSettings as rendered: tessellation factor and patch levels after the budget bias */
+	FGPUTessellationSettings GetRenderSettings() const;
+
 	/** Update LOD based on distance to camera */
 	void UpdateDistanceBasedLOD(float DeltaTime);
 
@@ -318,6 +442,60 @@ private:
 	/** Update LOD based on density texture */
 	void UpdateDensityBasedLOD(float DeltaTime);
 
+	/** How far the view can move before the smooth LOD target could leave the hysteresis band of the applied factor */
+	float CalculateDistanceLODWakeRadius(float Distance, float ScaledMinDistance, float ScaledMaxDistance, int32 TargetTessFactor) const;
+
+	/** Let the LOD sleep until the nearest view is more than WakeRadius from ViewLocation; 0 keeps the component ticking */
+	void SetLODWakeSphere(const FVector& ViewLocation, float WakeRadius);
+
+	/** Work the next tick has to do regardless of the view: dirty regions, collision, render targets, patch fills */
+	bool HasPendingTickWork() const;
+
+	/** Disable the tick once nothing is pending; view dependent LOD sleeps with UGPUTessellationTickSubsystem */
+	void UpdateTickSleep();
+
+	/** Re-enable the tick of a sleeping component */
+	void WakeTick();
+
+	/** Regenerate if a render target texture changed (per RenderTargetUpdateMode) */
+	void UpdateRenderTargetChanges();
+
+	/** Refresh the scene proxy in place when possible, otherwise recreate it; Trigger is recorded on the trace channel */
+	void RequestRegeneration(EGPUTessellationRegenerationTrigger Trigger, TConstArrayView<FBox2f> DirtyUVRegions = {});
+
+	/** Rerun the compute pipeline into the existing scene proxy's buffers; false if the proxy must be recreated */
+	bool RefreshSceneProxyBuffers(EGPUTessellationRegenerationTrigger Trigger, TConstArrayView<FBox2f> DirtyUVRegions = {});
+
+	/** Refresh the vertices under PendingDirtyUVRegions */
+	void FlushDirtyDisplacementRegions();
+
+	/** Start a collision build once the rebuild delay has passed and no build is in flight */
+	void UpdateCollision();
+
+	/** Positions-only readback landed - cook them on a worker thread */
+	void OnCollisionPositionsExtracted(const FGPUTessellatedMeshData& MeshData);
+
+	/** Async cook finished - swap the body setup in */
+	void FinishPhysicsAsyncCook(bool bSuccess, UBodySetup* FinishedBodySetup);
+
+	/** Drop the collision mesh and physics state */
+	void ClearCollision();
+
+	/** Block everything once collision is generated, unless the profile was already changed from the class default */
+	void ApplyGeneratedCollisionProfile();
+
+	/** Height sampler for the current textures, rebuilt when they change; null if they are not CPU readable */
+	const FGPUTessellationHeightSampler* GetHeightSampler();
+
+	/** Texture UV (as generated by GPUVertexGeneration.usf) under a world location */
+	FVector2f WorldToSurfaceUV(const FVector& WorldLocation, FVector& OutLocalLocation) const;
+
+	/** Is a surface UV on the plane? It covers UVOffset to UVOffset + UVScale */
+	bool IsOnSurface(const FVector2f& UV) const;
+
+	/** Location of the view nearest to the component this frame (UGPUTessellationViewSubsystem); false without a view */
+	bool GetLODViewLocation(FVector& OutLocation) const;
+
 	/** Calculate distance from camera to component (pivot or bounds) */
 	float CalculateDistanceToCamera(const FVector& CameraPos, FVector& OutComponentPos) const;
 
@@ -336,6 +514,9 @@ private:
 	/** Last applied tessellation factor (for hysteresis) */
 	int32 LastAppliedTessFactor = 16;
 
+	/** LOD bias steps from UGPUTessellationBudgetSubsystem */
+	int32 BudgetLODBias = 0;
+
 	/** Last known camera position for LOD */
 	FVector LastCameraPosition = FVector::ZeroVector;
 
@@ -345,12 +526,67 @@ private:
 	/** Last log time for throttling */
 	mutable double LastLogTime = 0.0;
 
+	/** Last "no camera" log time for patch LOD, throttled separately */
+	double LastNoCameraWarningTime = 0.0;
+
+	/** Distance based LOD starts at MaxTessellationFactor on the first tick */
+	bool bLODInitialized = false;
+
 	/** Last render target update time for FPS limiting */
 	double LastRenderTargetUpdateTime = 0.0;
 
+	/** Why the next scene proxy is created; reset once the proxy has read it */
+	EGPUTessellationRegenerationTrigger PendingRegenerationTrigger;
+
+	/** Set by NotifyDisplacementChanged, consumed by the next render target update */
+	bool bDisplacementChangeNotified = false;
+
+	/** Dirty texture UV rectangles from MarkDisplacementRegionDirty, applied on the next tick */
+	TArray<FBox2f> PendingDirtyUVRegions;
+
+	/** GPU checksum of the render target textures (ContentChecksum mode) */
+	TSharedPtr<FGPUTessellationContentChecksum, ESPMode::ThreadSafe> ContentChecksum;
+
+	/** Body setup of the last completed collision cook */
+	UPROPERTY(Transient, DuplicateTransient)
+	TObjectPtr<UBodySetup> CollisionBodySetup;
+
+	/** Body setup being cooked - its data is read on the cooking thread, so only one build runs at a time */
+	UPROPERTY(Transient, DuplicateTransient)
+	TObjectPtr<UBodySetup> CookingBodySetup;
+
+	/** Collision grid (component space), read by GetPhysicsTriMeshData */
+	TArray<FVector3f> CollisionVertices;
+	FIntPoint CollisionResolution = FIntPoint::ZeroValue;
+
+	/** Collision needs a rebuild; when the last change happened (for CollisionRebuildDelay) */
+	bool bCollisionDirty = false;
+	double CollisionDirtyTime = 0.0;
+
+	/** Readback or cook in progress */
+	bool bCollisionBuildInFlight = false;
+
+	/** CPU copies of the displacement and subtract textures for SampleHeight */
+	TSharedPtr<FGPUTessellationHeightSampler> HeightSampler;
+
+	/** The LOD of the last tick depends on the view (distance or patch modes with bAutoUpdate) */
+	bool bLODViewDependent = false;
+
+	/** The last tick found a view; without one the component wakes as soon as the world has a view */
+	bool bLODHasView = false;
+
+	/** View location of the last LOD update and how far that view may move before the LOD can change */
+	FVector LODWakeLocation = FVector::ZeroVector;
+	float LODWakeRadius = 0.0f;
+
+	/** Sleeping in the world's UGPUTessellationTickSubsystem */
+	bool bTickSleepRegistered = false;
+
 	/** Last patch configuration for change detection (Instance-specific, not static!) */
 	int32 LastPatchCountX = 1;
 	int32 LastPatchCountY = 1;
 
 	friend class FGPUTessellationSceneProxy;
+	friend class UGPUTessellationBudgetSubsystem;
+	friend class UGPUTessellationTickSubsystem;
 };
@@ -30,7 +30,7 @@ public:
 		
 		// Input buffers
 		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<float3>, InputVertices)
-		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, InputIndices)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(Buffer<uint>, InputIndices)
 		
 		// Output buffers
 		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<float>, OutputTessFactors)
@@ -58,6 +58,10 @@ public:
 	DECLARE_GLOBAL_SHADER(FGPUVertexGenerationCS);
 	SHADER_USE_PARAMETER_STRUCT(FGPUVertexGenerationCS, FGlobalShader);
 
+	/** All patches in one dispatch; group z indexes PatchDescriptors (GPUTessellationPatchCommon.ush) */
+	class FBatchedPatchesDim : SHADER_PERMUTATION_BOOL("BATCHED_PATCHES");
+	using FPermutationDomain = TShaderPermutationDomain<FBatchedPatchesDim>;
+
 	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
 		// Tessellation parameters
 		SHADER_PARAMETER(uint32, ResolutionX)
@@ -70,11 +74,11 @@ public:
 		// Per-patch UV offset and scale (for material UV continuity across patches)
 		SHADER_PARAMETER(FVector2f, PatchUVOffset)
 		SHADER_PARAMETER(FVector2f, PatchUVScale)
+		// First vertex of the dispatched region (partial refreshes; zero otherwise)
+		SHADER_PARAMETER(FUintVector2, VertexRegionOffset)
 		
-		// Input buffers
-		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<float3>, InputVertices)
-		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, InputIndices)
-		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<float>, TessellationFactors)
+		// Per-patch layout for batched dispatches (BATCHED_PATCHES only)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<FPatchDescriptor>, PatchDescriptors)
 		
 		// Output buffers
 		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<float3>, OutputPositions)
@@ -105,19 +109,31 @@ public:
 	DECLARE_GLOBAL_SHADER(FGPUDisplacementCS);
 	SHADER_USE_PARAMETER_STRUCT(FGPUDisplacementCS, FGlobalShader);
 
+	/** Procedural sine wave height instead of sampling DisplacementTexture */
+	class FSineWaveDim : SHADER_PERMUTATION_BOOL("USE_SINE_WAVE_DISPLACEMENT");
+	/** RVT/subtract mask is bound and modulates the sampled height */
+	class FRVTMaskDim : SHADER_PERMUTATION_BOOL("HAS_RVT_MASK");
+	/** All patches in one dispatch; group z indexes PatchDescriptors (GPUTessellationPatchCommon.ush) */
+	class FBatchedPatchesDim : SHADER_PERMUTATION_BOOL("BATCHED_PATCHES");
+	using FPermutationDomain = TShaderPermutationDomain<FSineWaveDim, FRVTMaskDim, FBatchedPatchesDim>;
+
 	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
 		// Displacement parameters
 		SHADER_PARAMETER(float, DisplacementIntensity)
 		SHADER_PARAMETER(float, DisplacementOffset)
-		SHADER_PARAMETER(uint32, bUseSineWaveDisplacement)
-		SHADER_PARAMETER(uint32, bHasRVTMask)
-		SHADER_PARAMETER(uint32, VertexCount)
+		SHADER_PARAMETER(uint32, ResolutionX)
+		SHADER_PARAMETER(uint32, ResolutionY)
 		
 		// UV remapping for patch rendering (allows each patch to sample correct portion of texture)
 		SHADER_PARAMETER(FVector2f, UVOffset)
 		SHADER_PARAMETER(FVector2f, UVScale)
+		// First vertex of the dispatched region (partial refreshes; zero otherwise)
+		SHADER_PARAMETER(FUintVector2, VertexRegionOffset)
+		
+		// Per-patch layout for batched dispatches (BATCHED_PATCHES only)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<FPatchDescriptor>, PatchDescriptors)
 		
-		// Texture resources
+		// Texture resources (only bound by the permutations that sample them)
 		SHADER_PARAMETER_RDG_TEXTURE_SRV(Texture2D, DisplacementTexture)
 		SHADER_PARAMETER_SAMPLER(SamplerState, DisplacementSampler)
 		SHADER_PARAMETER_RDG_TEXTURE_SRV(Texture2D, RVTMaskTexture)
@@ -131,21 +147,38 @@ public:
 		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<float3>, OutputPositions)
 	END_SHADER_PARAMETER_STRUCT()
 
+	/** The mask only modulates texture heights, so it is dropped when the sine wave is active */
+	static FPermutationDomain RemapPermutation(FPermutationDomain PermutationVector)
+	{
+		if (PermutationVector.Get<FSineWaveDim>())
+		{
+			PermutationVector.Set<FRVTMaskDim>(false);
+		}
+		return PermutationVector;
+	}
+
 	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
 	{
+		const FPermutationDomain PermutationVector(Parameters.PermutationId);
+		if (RemapPermutation(PermutationVector) != PermutationVector)
+		{
+			return false;
+		}
 		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
 	}
 
 	static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
 	{
 		FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
-		OutEnvironment.SetDefine(TEXT("THREADGROUP_SIZE"), 64);
+		OutEnvironment.SetDefine(TEXT("THREADGROUP_SIZE_X"), 8);
+		OutEnvironment.SetDefine(TEXT("THREADGROUP_SIZE_Y"), 8);
 	}
 };
 
 /**
  * Compute shader for calculating vertex normals from displaced geometry
  * Uses finite difference method on displacement or geometry-based calculation
+ * Each 8x8 group loads a 10x10 height tile (one vertex halo) into groupshared memory
  */
 class FGPUNormalCalculationCS : public FGlobalShader
 {
@@ -153,25 +186,43 @@ public:
 	DECLARE_GLOBAL_SHADER(FGPUNormalCalculationCS);
 	SHADER_USE_PARAMETER_STRUCT(FGPUNormalCalculationCS, FGlobalShader);
 
+	/** FromNormalMap method: normals come straight from NormalMapTexture */
+	class FNormalMapDim : SHADER_PERMUTATION_BOOL("NORMAL_FROM_NORMAL_MAP");
+	/** FiniteDifference/GeometryBased/Hybrid share one kernel; smoothing > 0 blends in grid geometry normals */
+	class FGeometryBlendDim : SHADER_PERMUTATION_BOOL("NORMAL_GEOMETRY_BLEND");
+	/** Subtract/mask texture is bound and applied to finite difference heights */
+	class FSubtractTextureDim : SHADER_PERMUTATION_BOOL("HAS_SUBTRACT_TEXTURE");
+	/** Halo heights use the procedural sine wave (must match FGPUDisplacementCS) */
+	class FSineWaveDim : SHADER_PERMUTATION_BOOL("USE_SINE_WAVE_DISPLACEMENT");
+	/** All patches in one dispatch; group z indexes PatchDescriptors (GPUTessellationPatchCommon.ush) */
+	class FBatchedPatchesDim : SHADER_PERMUTATION_BOOL("BATCHED_PATCHES");
+	using FPermutationDomain = TShaderPermutationDomain<FNormalMapDim, FGeometryBlendDim, FSubtractTextureDim, FSineWaveDim, FBatchedPatchesDim>;
+
 	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
 		// Normal calculation parameters
-		SHADER_PARAMETER(uint32, NormalCalculationMethod) // 0=Disabled, 1=FiniteDiff, 2=GeometryBased, 3=Hybrid, 4=FromNormalMap
 		SHADER_PARAMETER(float, NormalSmoothingFactor)
 		SHADER_PARAMETER(uint32, bInvertNormals)
-		SHADER_PARAMETER(uint32, VertexCount)
 		SHADER_PARAMETER(uint32, ResolutionX)
 		SHADER_PARAMETER(uint32, ResolutionY)
-		SHADER_PARAMETER(float, TexelSize)
+		// Full plane size; the finite difference step is derived per patch from it
 		SHADER_PARAMETER(float, PlaneSizeX)
 		SHADER_PARAMETER(float, PlaneSizeY)
+		// Same UV remap as vertex generation, used to place halo samples outside the grid
+		SHADER_PARAMETER(FVector2f, PatchUVOffset)
+		SHADER_PARAMETER(FVector2f, PatchUVScale)
+		// First vertex of the dispatched region (partial refreshes; zero otherwise)
+		SHADER_PARAMETER(FUintVector2, VertexRegionOffset)
+		
+		// Per-patch layout for batched dispatches (BATCHED_PATCHES only)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<FPatchDescriptor>, PatchDescriptors)
 		
 		// Displacement texture for gradient-based normals
 		SHADER_PARAMETER_RDG_TEXTURE_SRV(Texture2D<float>, DisplacementTexture)
 		SHADER_PARAMETER_SAMPLER(SamplerState, DisplacementSampler)
 		SHADER_PARAMETER(float, DisplacementIntensity)
+		SHADER_PARAMETER(float, DisplacementOffset)
 		
 		// Subtract/mask texture (for correct normal calculation with RVT)
-		SHADER_PARAMETER(uint32, bHasSubtractTexture)
 		SHADER_PARAMETER_RDG_TEXTURE_SRV(Texture2D, SubtractTexture)
 		SHADER_PARAMETER_SAMPLER(SamplerState, SubtractSampler)
 		
@@ -182,21 +233,73 @@ public:
 		// Input buffers
 		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<float3>, InputPositions)
 		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<float2>, InputUVs)
-		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, InputIndices)
 		
 		// Output buffers
 		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<float3>, OutputNormals)
 	END_SHADER_PARAMETER_STRUCT()
 
+	/** Normal map sampling ignores heights entirely, and the mask only applies to texture heights */
+	static FPermutationDomain RemapPermutation(FPermutationDomain PermutationVector)
+	{
+		if (PermutationVector.Get<FNormalMapDim>())
+		{
+			PermutationVector.Set<FGeometryBlendDim>(false);
+			PermutationVector.Set<FSubtractTextureDim>(false);
+			PermutationVector.Set<FSineWaveDim>(false);
+		}
+		if (PermutationVector.Get<FSineWaveDim>())
+		{
+			PermutationVector.Set<FSubtractTextureDim>(false);
+		}
+		return PermutationVector;
+	}
+
 	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
 	{
+		const FPermutationDomain PermutationVector(Parameters.PermutationId);
+		if (RemapPermutation(PermutationVector) != PermutationVector)
+		{
+			return false;
+		}
 		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
 	}
 
 	static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
 	{
 		FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
-		OutEnvironment.SetDefine(TEXT("THREADGROUP_SIZE"), 64);
+		OutEnvironment.SetDefine(TEXT("THREADGROUP_SIZE_X"), 8);
+		OutEnvironment.SetDefine(TEXT("THREADGROUP_SIZE_Y"), 8);
+	}
+};
+
+/**
+ * Compute shader for calculating the tangent basis of a generated grid
+ * Tangents follow the U direction so tangent space normal maps line up
+ */
+class FGPUTangentCalculationCS : public FGlobalShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FGPUTangentCalculationCS);
+	SHADER_USE_PARAMETER_STRUCT(FGPUTangentCalculationCS, FGlobalShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		// Grid parameters
+		SHADER_PARAMETER(uint32, ResolutionX)
+		SHADER_PARAMETER(uint32, ResolutionY)
+		SHADER_PARAMETER(uint32, VertexCount)
+		
+		// Input buffers
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<float3>, InputPositions)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<float3>, InputNormals)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<float2>, InputUVs)
+		
+		// Output buffer (xyz = tangent, w = binormal sign)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<float4>, OutputTangents)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
 	}
 };
 
@@ -209,12 +312,19 @@ public:
 	DECLARE_GLOBAL_SHADER(FGPUIndexGenerationCS);
 	SHADER_USE_PARAMETER_STRUCT(FGPUIndexGenerationCS, FGlobalShader);
 
+	/** All patches in one dispatch; group z indexes PatchDescriptors (GPUTessellationPatchCommon.ush) */
+	class FBatchedPatchesDim : SHADER_PERMUTATION_BOOL("BATCHED_PATCHES");
+	using FPermutationDomain = TShaderPermutationDomain<FBatchedPatchesDim>;
+
 	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
 		// Grid parameters
 		SHADER_PARAMETER(uint32, ResolutionX)
 		SHADER_PARAMETER(uint32, ResolutionY)
 		SHADER_PARAMETER(FIntVector4, EdgeCollapseFactors)
 		
+		// Per-patch layout for batched dispatches (BATCHED_PATCHES only)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<FPatchDescriptor>, PatchDescriptors)
+		
 		// Output buffer (typed UAV so it can become a real IndexBuffer later)
 		SHADER_PARAMETER_RDG_BUFFER_UAV(RWBuffer<uint>, OutputIndices)
 	END_SHADER_PARAMETER_STRUCT()
@@ -231,3 +341,114 @@ public:
 		OutEnvironment.SetDefine(TEXT("THREADGROUP_SIZE_Y"), 8);
 	}
 };
+
+/**
+ * Compute shader that culls batched patches and builds per-LOD indirect draw arguments
+ */
+class FGPUPatchIndirectArgsCS : public FGlobalShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FGPUPatchIndirectArgsCS);
+	SHADER_USE_PARAMETER_STRUCT(FGPUPatchIndirectArgsCS, FGlobalShader);
+
+	static constexpr int32 ThreadGroupSize = 64;
+	static constexpr int32 MaxLODLevels = 8;
+	static constexpr int32 MaxFrustumPlanes = 8;
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER(uint32, NumPatches)
+		SHADER_PARAMETER(uint32, NumLODs)
+		SHADER_PARAMETER(uint32, PatchListCapacity)
+		SHADER_PARAMETER(uint32, NumFrustumPlanes)
+		SHADER_PARAMETER_ARRAY(FUintVector4, LODIndexRanges, [MaxLODLevels])
+		SHADER_PARAMETER_ARRAY(FVector4f, FrustumPlanes, [MaxFrustumPlanes])
+		
+		// Input buffer
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<FPatchCullData>, PatchCullData)
+		
+		// Output buffers
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWBuffer<uint>, OutIndirectArgs)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, OutVisiblePatchList)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+	}
+
+	static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+		OutEnvironment.SetDefine(TEXT("THREADGROUP_SIZE"), ThreadGroupSize);
+		OutEnvironment.SetDefine(TEXT("MAX_LOD_LEVELS"), MaxLODLevels);
+		OutEnvironment.SetDefine(TEXT("MAX_FRUSTUM_PLANES"), MaxFrustumPlanes);
+	}
+};
+
+/**
+ * Compute shader that folds a texture's contents into an order-independent checksum
+ */
+class FGPUContentChecksumCS : public FGlobalShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FGPUContentChecksumCS);
+	SHADER_USE_PARAMETER_STRUCT(FGPUContentChecksumCS, FGlobalShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER(FUintVector2, TextureSize)
+		SHADER_PARAMETER(uint32, ChecksumSlot)
+		
+		// Input texture
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, SourceTexture)
+		
+		// Output buffer (sum and xor per slot)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWBuffer<uint>, OutChecksum)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+	}
+
+	static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+		OutEnvironment.SetDefine(TEXT("THREADGROUP_SIZE_X"), 8);
+		OutEnvironment.SetDefine(TEXT("THREADGROUP_SIZE_Y"), 8);
+	}
+};
+
+/**
+ * Compute shader that interleaves vertex attributes into one buffer for CPU readback
+ */
+class FGPUReadbackPackCS : public FGlobalShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FGPUReadbackPackCS);
+	SHADER_USE_PARAMETER_STRUCT(FGPUReadbackPackCS, FGlobalShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER(uint32, ResolutionX)
+		SHADER_PARAMETER(uint32, ResolutionY)
+		
+		// Input buffers
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<float3>, InputPositions)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<float3>, InputNormals)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<float2>, InputUVs)
+		
+		// Output buffer (two float4 per vertex)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<float4>, OutputPacked)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+	}
+
+	static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+		OutEnvironment.SetDefine(TEXT("THREADGROUP_SIZE_X"), 8);
+		OutEnvironment.SetDefine(TEXT("THREADGROUP_SIZE_Y"), 8);
+	}
+};
@@ -0,0 +1,57 @@
+// Licensed under the MIT License. See LICENSE file in the project root.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/SharedPointer.h"
+#include <atomic>
+
+class UTexture;
+class FTextureResource;
+class FRHICommandListImmediate;
+class FRHIGPUBufferReadback;
+
+/**
+ * Detects content changes in render target textures
+ *
+ * Every update checksums the textures on the GPU and reads the result back
+ * without stalling; a change is reported once the checksum differs from the
+ * previous one. Only one readback is in flight, so results lag a frame or two.
+ */
+class GPURUNTIMETESSELLATION_API FGPUTessellationContentChecksum : public TSharedFromThis<FGPUTessellationContentChecksum, ESPMode::ThreadSafe>
+{
+public:
+	/** Most textures checksummed together */
+	static constexpr int32 MaxTextures = 3;
+
+	FGPUTessellationContentChecksum();
+	~FGPUTessellationContentChecksum();
+
+	/**
+	 * Queue a checksum of the given 2D render targets (game thread)
+	 * Changing the texture set restarts change detection without reporting a change
+	 */
+	void Update(TConstArrayView<UTexture*> Textures);
+
+	/**
+	 * Has any texture's content changed since the last call? (game thread)
+	 */
+	bool ConsumeChange();
+
+private:
+	typedef TArray<FTextureResource*, TFixedAllocator<MaxTextures>> FTextureResourceArray;
+
+	void Update_RenderThread(FRHICommandListImmediate& RHICmdList, const FTextureResourceArray& TextureResources);
+
+	/** Render thread: pending readback of the last dispatched checksum */
+	TUniquePtr<FRHIGPUBufferReadback> Readback;
+	bool bReadbackInFlight;
+
+	/** Render thread: textures of the in-flight and baseline checksums */
+	FTextureResourceArray InFlightResources;
+	FTextureResourceArray BaselineResources;
+	TArray<uint32, TFixedAllocator<MaxTextures * 2>> BaselineChecksum;
+
+	/** Set on the render thread, consumed on the game thread */
+	std::atomic<bool> bChanged;
+};
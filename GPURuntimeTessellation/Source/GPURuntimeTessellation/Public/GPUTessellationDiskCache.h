@@ -0,0 +1,104 @@
+// Licensed under the MIT License. See LICENSE file in the project root.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/SecureHash.h"
+#include "GPUTessellationMeshBuilder.h"
+
+#include <atomic>
+
+class UTexture;
+
+/**
+ * Everything a generated single mesh depends on, as stored on disk
+ */
+struct FGPUTessellationDiskCacheKey
+{
+	/** SHA-1 of the mesh settings and the identity of every sampled texture; names the entry's file */
+	FSHAHash Hash;
+
+	/** Were the textures fully streamed in? Meshes generated from lower mips are never stored */
+	bool bTexturesResident = false;
+};
+
+/**
+ * Entry being read and decoded by a worker thread (FGPUTessellationDiskCache::BeginLoad)
+ */
+class GPURUNTIMETESSELLATION_API FGPUTessellationDiskCacheLoad
+{
+public:
+	const FGPUTessellationDiskCacheKey& GetKey() const { return Key; }
+
+	/** Has the worker finished, with a hit or a miss? (any thread) */
+	bool IsComplete() const { return bComplete.load(std::memory_order_acquire); }
+
+	/** Did the entry decode? Valid once complete */
+	bool IsHit() const { return IsComplete() && bHit; }
+
+	/** Has the load run for more than r.GPUTessellation.DiskCache.MaxLoadWaitFrames frames? (render thread) */
+	bool IsOverdue() const;
+
+	/** Decoded vertices, indices excluded; valid once complete */
+	const FGPUTessellatedMeshData& GetMeshData() const { return MeshData; }
+
+private:
+	friend class FGPUTessellationDiskCache;
+
+	FGPUTessellationDiskCacheKey Key;
+	uint64 StartFrame = 0;
+	FGPUTessellatedMeshData MeshData;
+	bool bHit = false;
+	std::atomic<bool> bComplete = false;
+};
+
+/**
+ * Optional on-disk cache of generated single meshes (r.GPUTessellation.DiskCache)
+ *
+ * Entries live in Saved/GPUTessellation/MeshCache, one file per key. Textures are identified by their source
+ * GUID in the editor and by their lighting GUID and the build version in cooked builds; render targets and
+ * transient textures have no persistent identity and are never cached.
+ *
+ * Only what the pipeline computes from the textures is stored: the displacement of every grid vertex as a
+ * 16-bit step over the mesh's height range, and its normal as two 16-bit octahedral coordinates, delta coded
+ * and Oodle compressed. Positions in the plane, UVs and indices follow from the settings and are rebuilt on
+ * load, so an entry holds 6 bytes per vertex before compression instead of the 44 of the GPU buffers.
+ *
+ * Entries are memory mapped where the platform supports it and read whole otherwise. Scene proxies read and decode
+ * them on a worker thread, upload a hit straight into their persistent buffers at a later regeneration and skip the
+ * generation passes; a miss is read back without blocking once generated and written by a worker thread.
+ */
+class GPURUNTIMETESSELLATION_API FGPUTessellationDiskCache
+{
+public:
+	/**
+	 * Key for a single mesh generation (game or render thread)
+	 * @return false if the cache is disabled or a texture has no persistent identity
+	 */
+	static bool MakeKey(const FGPUTessellationSettings& EffectiveSettings, UTexture* DisplacementTexture, UTexture* SubtractTexture,
+		UTexture* NormalMapTexture, FGPUTessellationDiskCacheKey& OutKey);
+
+	/** Read an entry into CPU mesh data, indices included (any thread) */
+	static bool LoadMesh(const FGPUTessellationDiskCacheKey& Key, const FGPUTessellationSettings& EffectiveSettings, FGPUTessellatedMeshData& OutMeshData);
+
+	/** Read and decode an entry on a worker thread; poll the returned load before uploading it (render thread) */
+	static TSharedRef<FGPUTessellationDiskCacheLoad, ESPMode::ThreadSafe> BeginLoad(const FGPUTessellationDiskCacheKey& Key,
+		const FGPUTessellationSettings& EffectiveSettings);
+
+	/** Record the upload of a completed hit into persistent buffers instead of the generation passes (render thread) */
+	static void UploadMesh(FRDGBuilder& GraphBuilder, FGPUTessellationMeshBuilder& MeshBuilder, const FGPUTessellationDiskCacheLoad& Load,
+		FGPUTessellationBuffers& OutGPUBuffers);
+
+	/** Encode and write mesh data on a worker thread (any thread) */
+	static void StoreMesh(const FGPUTessellationDiskCacheKey& Key, const FGPUTessellationSettings& EffectiveSettings, const FGPUTessellatedMeshData& MeshData);
+
+	/** Read back buffers generated in this graph and store them once the copies land (render thread) */
+	static void StoreMesh(FRDGBuilder& GraphBuilder, FGPUTessellationMeshBuilder& MeshBuilder, const FGPUTessellationDiskCacheKey& Key,
+		const FGPUTessellationSettings& EffectiveSettings, const FGPUTessellationBuffers& GPUBuffers);
+
+	/** Hand readbacks that landed to worker threads; once per frame (render thread) */
+	static void PollStores_RenderThread();
+
+	/** Directory holding the entries */
+	static FString GetCacheDirectory();
+};
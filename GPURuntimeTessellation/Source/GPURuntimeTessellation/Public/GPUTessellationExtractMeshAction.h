@@ -0,0 +1,70 @@
+// Licensed under the MIT License. See LICENSE file in the project root.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "GPUTessellationExtractMeshAction.generated.h"
+
+class UGPUTessellationComponent;
+struct FGPUTessellatedMeshData;
+
+/**
+ * Tessellated mesh read back to the CPU (component space)
+ * Layout matches the procedural mesh component's CreateMeshSection inputs
+ */
+USTRUCT(BlueprintType)
+struct GPURUNTIMETESSELLATION_API FGPUTessellationExtractedMesh
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "GPU Tessellation")
+	TArray<FVector> Vertices;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GPU Tessellation")
+	TArray<FVector> Normals;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GPU Tessellation")
+	TArray<FVector2D> UVs;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GPU Tessellation")
+	TArray<int32> Triangles;
+
+	/** Grid resolution in vertices */
+	UPROPERTY(BlueprintReadOnly, Category = "GPU Tessellation")
+	FIntPoint Resolution = FIntPoint::ZeroValue;
+
+	void SetFromMeshData(const FGPUTessellatedMeshData& MeshData);
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FGPUTessellationExtractMeshPin, const FGPUTessellationExtractedMesh&, Mesh);
+
+/**
+ * Latent Blueprint node reading a tessellation component's mesh back without stalling
+ * Failed fires if the component is gone before the readback lands or rendering is unavailable.
+ */
+UCLASS()
+class GPURUNTIMETESSELLATION_API UGPUTessellationExtractMeshAction : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+
+public:
+	/** Read the component's current tessellated mesh back to the CPU over the next few frames */
+	UFUNCTION(BlueprintCallable, Category = "GPU Tessellation", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject", DisplayName = "Extract Tessellated Mesh Async"))
+	static UGPUTessellationExtractMeshAction* ExtractTessellatedMeshAsync(UObject* WorldContextObject, UGPUTessellationComponent* Component);
+
+	UPROPERTY(BlueprintAssignable)
+	FGPUTessellationExtractMeshPin Completed;
+
+	UPROPERTY(BlueprintAssignable)
+	FGPUTessellationExtractMeshPin Failed;
+
+	//~ Begin UBlueprintAsyncActionBase Interface
+	virtual void Activate() override;
+	//~ End UBlueprintAsyncActionBase Interface
+
+private:
+	void Finish(const FGPUTessellatedMeshData* MeshData);
+
+	TWeakObjectPtr<UGPUTessellationComponent> Component;
+};
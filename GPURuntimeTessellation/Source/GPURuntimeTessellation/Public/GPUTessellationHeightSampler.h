@@ -0,0 +1,82 @@
+// Licensed under the MIT License. See LICENSE file in the project root.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GPUTessellationComponent.h"
+
+/**
+ * Single channel float copy of a texture's top mip
+ */
+struct GPURUNTIMETESSELLATION_API FGPUTessellationHeightTexture
+{
+	/** One channel (red unless read otherwise), linear, row major */
+	TArray<float> Texels;
+	FIntPoint Size = FIntPoint::ZeroValue;
+
+	bool IsValid() const { return Size.X > 0 && Size.Y > 0 && Texels.Num() == Size.X * Size.Y; }
+
+	/** Bilinear sample with clamp addressing, as SampleLevel(..., 0) with SF_Bilinear/AM_Clamp */
+	float Sample(const FVector2f& UV) const;
+
+	/**
+	 * Copy one channel of a texture to the CPU (0 = red ... 3 = alpha)
+	 * Uses the source data in the editor; cooked builds need an uncompressed format (G8, G16, R16F, R32F, BGRA8, RGBA16F)
+	 * whose top mip bulk data is still loaded. Render targets are not supported.
+	 */
+	static bool ReadTexture(UTexture* Texture, FGPUTessellationHeightTexture& OutTexture, int32 Channel = 0);
+};
+
+/**
+ * CPU height queries that match GPUDisplacement.usf
+ *
+ * Keeps CPU copies of the displacement and subtract textures and evaluates the displacement shader's
+ * height (texture * (1 - mask) or the sine wave, then intensity and offset) at arbitrary UVs,
+ * without touching the GPU. Batches run four points per SIMD register.
+ */
+class GPURUNTIMETESSELLATION_API FGPUTessellationHeightSampler
+{
+public:
+	/**
+	 * Copy the textures' data (game thread)
+	 * A null displacement texture samples as white and a null subtract texture as no mask, like the shader defaults.
+	 * @return false if a texture could not be read
+	 */
+	bool Build(UTexture* InDisplacementTexture, UTexture* InSubtractTexture);
+
+	/** Use texture data directly (tests and benchmarks); an invalid displacement texture samples as white */
+	void SetTextures(FGPUTessellationHeightTexture&& InDisplacement, FGPUTessellationHeightTexture&& InSubtract);
+
+	/** Can heights be sampled? (false after a failed Build) */
+	bool IsValid() const { return bValid; }
+
+	/** Were these textures the ones Build() read? */
+	bool IsBuiltFrom(const UTexture* InDisplacementTexture, const UTexture* InSubtractTexture) const
+	{
+		return SourceDisplacementTexture.Get() == InDisplacementTexture && SourceSubtractTexture.Get() == InSubtractTexture;
+	}
+
+	/**
+	 * Displacement along the local up axis at a texture UV (GPUDisplacement.usf, including intensity and offset)
+	 */
+	float SampleHeight(const FGPUTessellationSettings& Settings, const FVector2f& UV) const;
+
+	/**
+	 * SampleHeight for many UVs - four at a time in SIMD registers
+	 * @param OutHeights - Same length as UVs
+	 */
+	void SampleHeightBatch(const FGPUTessellationSettings& Settings, TConstArrayView<FVector2f> UVs, TArrayView<float> OutHeights) const;
+
+	/** Height source before intensity and offset (SampleDisplacement in the shader) */
+	float SampleSource(const FGPUTessellationSettings& Settings, const FVector2f& UV) const;
+
+private:
+
+	FGPUTessellationHeightTexture Displacement;
+	FGPUTessellationHeightTexture Subtract;
+
+	TWeakObjectPtr<UTexture> SourceDisplacementTexture;
+	TWeakObjectPtr<UTexture> SourceSubtractTexture;
+
+	bool bValid = false;
+};
@@ -0,0 +1,23 @@
+// Licensed under the MIT License. See LICENSE file in the project root.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Logging/LogMacros.h"
+
+/**
+ * Highest verbosity compiled into the build
+ *
+ * Per patch and per regeneration diagnostics log at Verbose and VeryVerbose, so they cost nothing
+ * in Test and Shipping builds. Elsewhere they cost one verbosity check until enabled with
+ * "Log LogGPUTessellation Verbose" (or -LogCmds="LogGPUTessellation Verbose").
+ */
+#if UE_BUILD_SHIPPING
+	#define GPUTESSELLATION_LOG_COMPILED_VERBOSITY Warning
+#elif UE_BUILD_TEST
+	#define GPUTESSELLATION_LOG_COMPILED_VERBOSITY Log
+#else
+	#define GPUTESSELLATION_LOG_COMPILED_VERBOSITY All
+#endif
+
+GPURUNTIMETESSELLATION_API DECLARE_LOG_CATEGORY_EXTERN(LogGPUTessellation, Log, GPUTESSELLATION_LOG_COMPILED_VERBOSITY);
@@ -9,9 +9,13 @@
 #include "RHI.h"
 #include "RHIResources.h"
 #include "RenderResource.h"
+#include "Async/Future.h"
 #include "GPUTessellationComponent.h"
+#include "GPUTessellationStats.h"
+#include "GPUTessellationTrace.h"
 
 class UTexture2D;
+class FRHIGPUBufferReadback;
 
 /**
  * Mesh data generated by compute shaders (CPU copy)
@@ -42,6 +46,63 @@ struct FGPUTessellatedMeshData
 	}
 };
 
+/** Called on the game thread once an asynchronous mesh extraction has been read back */
+DECLARE_DELEGATE_OneParam(FOnGPUTessellationMeshExtracted, const FGPUTessellatedMeshData& /*MeshData*/);
+
+/**
+ * What a mesh readback copies back to the CPU
+ */
+enum class EGPUTessellationReadbackContent : uint8
+{
+	/** Positions, normals, UVs and indices */
+	Full,
+	
+	/** Positions only - the grid topology follows from the resolution (collision, height queries) */
+	PositionsOnly
+};
+
+/**
+ * Staging copies of a generated mesh, read back without blocking
+ * Render thread only: poll IsReady() on later frames, then Read() once
+ * Staging buffers come from a shared pool (r.GPUTessellation.ReadbackPoolSize) and return to it after Read()
+ */
+struct GPURUNTIMETESSELLATION_API FGPUTessellationMeshReadback
+{
+	/** Interleaved attributes (GPUReadbackPack.usf) when bInterleaved, otherwise positions */
+	FRHIGPUBufferReadback* Vertices = nullptr;
+
+	/** Separately copied attributes (Full content without interleaving) */
+	FRHIGPUBufferReadback* Normals = nullptr;
+	FRHIGPUBufferReadback* UVs = nullptr;
+
+	/** Triangle indices (Full content only) */
+	FRHIGPUBufferReadback* Indices = nullptr;
+
+	EGPUTessellationReadbackContent Content = EGPUTessellationReadbackContent::Full;
+	bool bInterleaved = false;
+
+	int32 ResolutionX = 0;
+	int32 ResolutionY = 0;
+
+	/** When the copies were enqueued, for the latency stat */
+	uint64 EnqueueCycles = 0;
+
+	FGPUTessellationMeshReadback();
+	~FGPUTessellationMeshReadback();
+
+	/** Have all copies landed? */
+	bool IsReady() const;
+
+	/** Bytes the copies transfer */
+	uint32 GetNumBytes() const;
+
+	/** Copy the staged data into OutMeshData and return the staging buffers to the pool (once IsReady() or the GPU is idle) */
+	void Read(FGPUTessellatedMeshData& OutMeshData);
+
+	/** Return the staging buffers to the pool without reading them */
+	void Release();
+};
+
 /**
  * GPU-only mesh buffers (no CPU copy) for pure GPU rendering
  * Used by scene proxy to render directly from GPU buffers
@@ -80,6 +141,12 @@ struct FGPUTessellationBuffers : public FRenderResource
 	
 	FGPUIndexBuffer IndexBuffer;
 	
+	// Pooled buffers behind the RHI references - re-registered with RDG for in-place refreshes
+	TRefCountPtr<FRDGPooledBuffer> PooledPositionBuffer;
+	TRefCountPtr<FRDGPooledBuffer> PooledNormalBuffer;
+	TRefCountPtr<FRDGPooledBuffer> PooledUVBuffer;
+	TRefCountPtr<FRDGPooledBuffer> PooledIndexBuffer;
+	
 	// Metadata
 	int32 VertexCount = 0;
 	int32 IndexCount = 0;
@@ -97,6 +164,18 @@ struct FGPUTessellationBuffers : public FRenderResource
 		// Note: TangentBuffer is optional - not required for basic rendering
 	}
 	
+	/** GPU memory of the buffers currently held */
+	FGPUTessellationBufferMemory GetMemory() const
+	{
+		FGPUTessellationBufferMemory Memory;
+		Memory.PositionBytes = PositionBuffer.IsValid() ? PositionBuffer->GetSize() : 0;
+		Memory.NormalBytes = NormalBuffer.IsValid() ? NormalBuffer->GetSize() : 0;
+		Memory.UVBytes = UVBuffer.IsValid() ? UVBuffer->GetSize() : 0;
+		Memory.TangentBytes = TangentBuffer.IsValid() ? TangentBuffer->GetSize() : 0;
+		Memory.IndexBytes = IndexBufferRHI.IsValid() ? IndexBufferRHI->GetSize() : 0;
+		return Memory;
+	}
+	
 	void Reset()
 	{
 		// Release the index buffer render resource if it was initialized
@@ -114,6 +193,10 @@ struct FGPUTessellationBuffers : public FRenderResource
 		NormalSRV.SafeRelease();
 		UVSRV.SafeRelease();
 		TangentSRV.SafeRelease();
+		PooledPositionBuffer.SafeRelease();
+		PooledNormalBuffer.SafeRelease();
+		PooledUVBuffer.SafeRelease();
+		PooledIndexBuffer.SafeRelease();
 		VertexCount = 0;
 		IndexCount = 0;
 		ResolutionX = 0;
@@ -140,6 +223,10 @@ struct FGPUTessellationPatchInfo
 	int32 ResolutionX;             // Cached resolution X for this patch (after tessellation factor to grid conversion)
 	int32 ResolutionY;             // Cached resolution Y for this patch
 	FIntVector4 EdgeCollapseFactors; // West, East, South, North collapse ratios (1 = none)
+	int32 FirstVertex;             // First vertex in the shared batch buffers (batched mode)
+	int32 NumVertices;             // Vertex count in the shared batch buffers (0 = not generated)
+	int32 FirstIndex;              // First index in the shared batch index buffer (batched mode)
+	int32 NumIndices;              // Index count in the shared batch index buffer (0 = not generated)
 	
 	FGPUTessellationPatchInfo()
 		: PatchOffset(0, 0)
@@ -153,17 +240,134 @@ struct FGPUTessellationPatchInfo
 		, ResolutionX(0)
 		, ResolutionY(0)
 		, EdgeCollapseFactors(1, 1, 1, 1)
+		, FirstVertex(0)
+		, NumVertices(0)
+		, FirstIndex(0)
+		, NumIndices(0)
 	{}
 };
 
+/**
+ * GPU-side patch description for batched patch dispatches
+ * Layout must match FPatchDescriptor in GPUTessellationPatchCommon.ush
+ */
+struct FGPUTessellationPatchDescriptor
+{
+	FVector2f UVOffset;              // Patch start in plane UV space
+	FVector2f UVScale;               // Patch extent in plane UV space
+	uint32 ResolutionX;
+	uint32 ResolutionY;
+	uint32 VertexBase;               // First vertex in the shared vertex buffers
+	uint32 IndexBase;                // First index in the shared index buffer
+	FUintVector4 EdgeCollapseFactors; // West, East, South, North collapse ratios (1 = none)
+};
+static_assert(sizeof(FGPUTessellationPatchDescriptor) == 48, "FGPUTessellationPatchDescriptor must match FPatchDescriptor in GPUTessellationPatchCommon.ush");
+
+/**
+ * Batched dispatch state shared by the pipeline stages
+ * When batching, the Resolution passed to the Dispatch functions is the largest patch resolution
+ */
+struct FGPUTessellationPatchBatch
+{
+	FRDGBufferSRVRef PatchDescriptors = nullptr;
+	int32 PatchCount = 0;
+	int32 TotalVertexCount = 0;
+	int32 TotalIndexCount = 0;
+};
+
+/**
+ * Per-patch input to the indirect argument pass
+ * Layout must match FPatchCullData in GPUPatchIndirectArgs.usf
+ */
+struct FGPUTessellationPatchCullData
+{
+	FVector3f BoundsCenter;          // World space bounds center
+	uint32 LODIndex;                 // Index into the LOD grid table
+	FVector3f BoundsExtent;          // World space bounds half size
+	uint32 Padding = 0;
+};
+static_assert(sizeof(FGPUTessellationPatchCullData) == 32, "FGPUTessellationPatchCullData must match FPatchCullData in GPUPatchIndirectArgs.usf");
+
+/**
+ * Persistent buffers for GPU-driven indirect patch draws
+ * The shared index buffer holds one plain grid per LOD level; each LOD level is drawn
+ * with one indexed indirect draw instanced over its visible patches
+ * The arguments built with the buffers list every patch; the scene proxy culls the patches
+ * for each view it renders from PatchCullDataBuffer into per view arguments
+ */
+struct FGPUTessellationIndirectDrawBuffers
+{
+	// FRHIDrawIndexedIndirectParameters per LOD level, every patch visible
+	FBufferRHIRef IndirectArgsBuffer;
+	
+	// Visible patch indices, PatchListCapacity entries per LOD level
+	FBufferRHIRef VisiblePatchListBuffer;
+	FShaderResourceViewRHIRef VisiblePatchListSRV;
+	
+	// Patch descriptors read by the indirect vertex factory
+	FBufferRHIRef PatchDescriptorBuffer;
+	FShaderResourceViewRHIRef PatchDescriptorSRV;
+	
+	// FGPUTessellationPatchCullData per patch, and the LOD index ranges they are culled with
+	TRefCountPtr<FRDGPooledBuffer> PatchCullDataBuffer;
+	TArray<FUintVector4> LODIndexRanges;
+	int32 NumPatches = 0;
+	
+	int32 NumLODs = 0;
+	int32 PatchListCapacity = 0;
+	
+	bool IsValid() const
+	{
+		return IndirectArgsBuffer.IsValid() &&
+		       VisiblePatchListSRV.IsValid() &&
+		       PatchDescriptorSRV.IsValid() &&
+		       NumLODs > 0;
+	}
+	
+	/** GPU memory of the buffers currently held */
+	uint64 GetMemoryBytes() const
+	{
+		return (IndirectArgsBuffer.IsValid() ? IndirectArgsBuffer->GetSize() : 0) +
+		       (VisiblePatchListBuffer.IsValid() ? VisiblePatchListBuffer->GetSize() : 0) +
+		       (PatchDescriptorBuffer.IsValid() ? PatchDescriptorBuffer->GetSize() : 0) +
+		       (PatchCullDataBuffer.IsValid() ? PatchCullDataBuffer->GetSize() : 0);
+	}
+	
+	void Reset()
+	{
+		IndirectArgsBuffer.SafeRelease();
+		VisiblePatchListBuffer.SafeRelease();
+		VisiblePatchListSRV.SafeRelease();
+		PatchDescriptorBuffer.SafeRelease();
+		PatchDescriptorSRV.SafeRelease();
+		PatchCullDataBuffer.SafeRelease();
+		LODIndexRanges.Reset();
+		NumPatches = 0;
+		NumLODs = 0;
+		PatchListCapacity = 0;
+	}
+};
+
 /**
  * Collection of patch buffers for spatial patch rendering
  */
 struct FGPUTessellationPatchBuffers : public FRenderResource
 {
-	// Array of buffers, one per patch
+	// Array of buffers, one per patch (per-patch mode)
 	TArray<FGPUTessellationBuffers> PatchBuffers;
 	
+	// Every generated patch packed into one set of buffers (batched mode)
+	// Each patch's range is stored in its PatchInfo entry
+	FGPUTessellationBuffers SharedBuffers;
+	
+	// Were the patches generated with the batched dispatch?
+	bool bBatched = false;
+	
+	// Are the batched patches drawn with GPU-built indirect arguments?
+	// SharedBuffers' index buffer then holds the per-LOD grids instead of per-patch indices
+	bool bIndirect = false;
+	FGPUTessellationIndirectDrawBuffers IndirectDraw;
+	
 	// Patch metadata
 	TArray<FGPUTessellationPatchInfo> PatchInfo;
 	
@@ -171,10 +375,46 @@ struct FGPUTessellationPatchBuffers : public FRenderResource
 	int32 PatchCountX = 1;
 	int32 PatchCountY = 1;
 	
+	// First patch not yet generated (generation can span several steps, see GeneratePendingPatches)
+	int32 NextPatchToGenerate = 0;
+	
 	int32 GetTotalPatchCount() const { return PatchCountX * PatchCountY; }
 	
+	bool IsGenerationComplete() const { return PatchInfo.Num() > 0 && NextPatchToGenerate >= PatchInfo.Num(); }
+	
+	/** GPU memory of every patch buffer; indirect draw buffers count as index memory */
+	FGPUTessellationBufferMemory GetMemory() const
+	{
+		FGPUTessellationBufferMemory Memory = SharedBuffers.GetMemory();
+		for (const FGPUTessellationBuffers& Patch : PatchBuffers)
+		{
+			Memory += Patch.GetMemory();
+		}
+		Memory.IndexBytes += IndirectDraw.GetMemoryBytes();
+		return Memory;
+	}
+	
+	/** Vertices in every patch buffer */
+	int64 GetVertexCount() const
+	{
+		int64 Count = SharedBuffers.VertexCount;
+		for (const FGPUTessellationBuffers& Patch : PatchBuffers)
+		{
+			Count += Patch.VertexCount;
+		}
+		return Count;
+	}
+	
 	bool IsValid() const
 	{
+		if (bIndirect)
+		{
+			return SharedBuffers.IsValid() && IndirectDraw.IsValid() && PatchInfo.Num() == GetTotalPatchCount();
+		}
+		if (bBatched)
+		{
+			return SharedBuffers.IsValid() && PatchInfo.Num() == GetTotalPatchCount();
+		}
 		return PatchBuffers.Num() > 0 && PatchBuffers.Num() == GetTotalPatchCount();
 	}
 	
@@ -185,9 +425,14 @@ struct FGPUTessellationPatchBuffers : public FRenderResource
 			Patch.Reset();
 		}
 		PatchBuffers.Empty();
+		SharedBuffers.Reset();
+		bBatched = false;
+		bIndirect = false;
+		IndirectDraw.Reset();
 		PatchInfo.Empty();
 		PatchCountX = 1;
 		PatchCountY = 1;
+		NextPatchToGenerate = 0;
 	}
 	
 	virtual void InitRHI(FRHICommandListBase& RHICmdList) override {}
@@ -251,6 +496,52 @@ public:
 		UTexture* NormalMapTexture,
 		FGPUTessellationBuffers& OutGPUBuffers);
 
+	/**
+	 * Upload CPU mesh data into persistent GPU buffers instead of running the generation passes (on-disk mesh cache)
+	 * Only the index pass runs; the grid topology follows from the resolution
+	 * 
+	 * @param MeshData - Vertices, normals and UVs of a single mesh; indices are ignored
+	 * @param OutGPUBuffers - Same buffers ExecuteTessellationPipeline creates, so they can be refreshed in place later
+	 */
+	void UploadMeshData(
+		FRDGBuilder& GraphBuilder,
+		const FGPUTessellatedMeshData& MeshData,
+		FGPUTessellationBuffers& OutGPUBuffers);
+
+	/**
+	 * Copy the buffers of a generated single mesh back to the CPU without blocking
+	 * The buffers may have been created earlier in the same graph
+	 */
+	void EnqueueMeshReadback(
+		FRDGBuilder& GraphBuilder,
+		const FGPUTessellationBuffers& GPUBuffers,
+		FGPUTessellationMeshReadback& OutReadback);
+
+	/**
+	 * Rerun vertex generation, displacement and normals into buffers created by ExecuteTessellationPipeline
+	 * Indices and SRVs are kept, so the vertex factory needs no update
+	 * 
+	 * @param Settings - Tessellation settings; must give the resolution InOutGPUBuffers was created with
+	 * @param InOutGPUBuffers - Buffers to overwrite
+	 * @param DirtyUVRegions - Texture UV rectangles whose displacement changed; empty refreshes the whole grid
+	 * @return false (and no passes added) if the buffers are missing or the resolution differs
+	 */
+	bool RefreshTessellationPipeline(
+		FRDGBuilder& GraphBuilder,
+		const FGPUTessellationSettings& Settings,
+		const FMatrix& LocalToWorld,
+		UTexture* DisplacementTexture,
+		UTexture* SubtractTexture,
+		UTexture* NormalMapTexture,
+		FGPUTessellationBuffers& InOutGPUBuffers,
+		TConstArrayView<FBox2f> DirtyUVRegions = {});
+
+	/**
+	 * Grid vertices whose displacement depends on texels inside a texture UV rectangle
+	 * Includes the one-vertex bilinear footprint; empty if the rectangle misses the grid
+	 */
+	static FIntRect CalculateDirtyVertexRegion(const FGPUTessellationSettings& Settings, FIntPoint Resolution, const FBox2f& UVRegion);
+
 	/**
 	 * Execute spatial patch tessellation pipeline (Pure GPU, multiple patches)
 	 * Generates multiple independent patches with per-patch LOD
@@ -280,9 +571,84 @@ public:
 		UTexture* NormalMapTexture,
 		FGPUTessellationPatchBuffers& OutPatchBuffers);
 
+	/**
+	 * First half of ExecutePatchTessellationPipeline: compute patch LOD, bounds and culling
+	 * Releases OutPatchBuffers' previous contents; no GPU work is added
+	 */
+	void PreparePatchGeneration(
+		const FGPUTessellationSettings& Settings,
+		const FMatrix& LocalToWorld,
+		const FVector& CameraPosition,
+		const FConvexVolume* ViewFrustum,
+		int32 PatchCountX,
+		int32 PatchCountY,
+		FGPUTessellationPatchBuffers& OutPatchBuffers);
+
+	/**
+	 * Second half of ExecutePatchTessellationPipeline: generate patches not generated yet
+	 * Batched patches are always generated in one step
+	 *
+	 * @param MaxPatches - Most patches to generate in this step (0 = all remaining)
+	 * @return true once every patch has been generated
+	 */
+	bool GeneratePendingPatches(
+		FRDGBuilder& GraphBuilder,
+		const FGPUTessellationSettings& Settings,
+		const FMatrix& LocalToWorld,
+		const FConvexVolume* ViewFrustum,
+		UTexture* DisplacementTexture,
+		UTexture* SubtractTexture,
+		UTexture* NormalMapTexture,
+		int32 MaxPatches,
+		FGPUTessellationPatchBuffers& OutPatchBuffers);
+
+	/**
+	 * Execute the full tessellation pipeline and copy the results into staging buffers (non-blocking readback version)
+	 * 
+	 * @param OutReadback - Staging buffers, filled once the GPU reaches the copies (see FGPUTessellationMeshReadback)
+	 * @param Content - Attributes to copy back
+	 */
+	void ExecuteTessellationPipeline(
+		FRDGBuilder& GraphBuilder,
+		const FGPUTessellationSettings& Settings,
+		const FMatrix& LocalToWorld,
+		const FVector& CameraPosition,
+		UTexture* DisplacementTexture,
+		UTexture* SubtractTexture,
+		UTexture* NormalMapTexture,
+		FGPUTessellationMeshReadback& OutReadback,
+		EGPUTessellationReadbackContent Content = EGPUTessellationReadbackContent::Full);
+
+	/**
+	 * Generate mesh data on the GPU and read it back to the CPU without stalling (game thread)
+	 * The readback is polled once per frame; the future is fulfilled on the game thread.
+	 * Runs on the CPU backend instead when FGPUTessellationCPUBackend::IsActive() (no rendering, or forced).
+	 */
+	static TFuture<FGPUTessellatedMeshData> GenerateMeshAsync(
+		const FGPUTessellationSettings& Settings,
+		const FMatrix& LocalToWorld,
+		UTexture* DisplacementTexture,
+		UTexture* SubtractTexture,
+		UTexture* NormalMapTexture,
+		EGPUTessellationReadbackContent Content = EGPUTessellationReadbackContent::Full);
+
+	/**
+	 * GenerateMeshAsync with a completion delegate, executed on the game thread
+	 */
+	static void GenerateMeshAsync(
+		const FGPUTessellationSettings& Settings,
+		const FMatrix& LocalToWorld,
+		UTexture* DisplacementTexture,
+		UTexture* SubtractTexture,
+		UTexture* NormalMapTexture,
+		FOnGPUTessellationMeshExtracted OnComplete,
+		EGPUTessellationReadbackContent Content = EGPUTessellationReadbackContent::Full);
+
 	/**
 	 * Synchronous mesh generation (simpler version for testing)
 	 * Generates mesh data on GPU and immediately reads back to CPU
+	 * Flushes rendering commands and waits for the GPU - prefer GenerateMeshAsync at runtime
+	 * Runs on the CPU backend instead when FGPUTessellationCPUBackend::IsActive()
 	 */
 	void GenerateMeshSync(
 		const FGPUTessellationSettings& Settings,
@@ -292,14 +658,73 @@ public:
 		UTexture* RVTMaskTexture,
 		FGPUTessellatedMeshData& OutMeshData);
 
-private:
+	/**
+	 * Local-space distance between adjacent grid vertices (finite difference normal step)
+	 * Patches cover Settings.UVScale of the full plane
+	 */
+	static FVector2f CalculateGridStep(const FGPUTessellationSettings& Settings, FIntPoint Resolution);
+
 	/**
 	 * Calculate grid resolution from tessellation factor
 	 */
-	FIntPoint CalculateResolution(float TessellationFactor) const;
+	static FIntPoint CalculateResolution(float TessellationFactor);
+
+	/**
+	 * Cull patches against the frustum and build per-LOD indexed indirect draw arguments
+	 * CPU reference: FGPUTessellationCPUReference::BuildIndirectDrawArgs
+	 *
+	 * @param PatchCullData - FGPUTessellationPatchCullData per patch
+	 * @param NumPatches - Number of entries in PatchCullData
+	 * @param LODIndexRanges - Per LOD level: x = index count per instance, y = first index
+	 * @param FrustumPlanes - Culling planes (FConvexVolume convention); empty disables culling
+	 * @param PatchListCapacity - Visible list entries reserved per LOD level
+	 * @param OutIndirectArgs - FRHIDrawIndexedIndirectParameters per LOD level (cleared here)
+	 * @param OutVisiblePatchList - uint32 x LODIndexRanges.Num() * PatchListCapacity
+	 */
+	static void AddBuildIndirectArgsPass(
+		FRDGBuilder& GraphBuilder,
+		FRDGBufferSRVRef PatchCullData,
+		int32 NumPatches,
+		TConstArrayView<FUintVector4> LODIndexRanges,
+		TConstArrayView<FPlane> FrustumPlanes,
+		int32 PatchListCapacity,
+		FRDGBufferRef OutIndirectArgs,
+		FRDGBufferRef OutVisiblePatchList);
+
+	/**
+	 * Distance based tessellation factor per triangle (GPUTessellationFactor.usf)
+	 * CPU reference: FGPUTessellationCPUReference::CalculateTessellationFactors
+	 *
+	 * @param VertexBuffer - Local space positions (float3)
+	 * @param IndexBuffer - Triangle list (uint32, read through a typed R32_UINT view)
+	 * @param LocalToWorld - Transform applied to the vertices before measuring the distance
+	 * @param OutTessFactorBuffer - Created here, one float per triangle
+	 */
+	static void AddTessellationFactorPass(
+		FRDGBuilder& GraphBuilder,
+		FRDGBufferRef VertexBuffer,
+		FRDGBufferRef IndexBuffer,
+		int32 TriangleCount,
+		const FMatrix& LocalToWorld,
+		const FVector& CameraPosition,
+		float MaxTessellationDistance,
+		float MinTessellationFactor,
+		float MaxTessellationFactor,
+		FRDGBufferRef& OutTessFactorBuffer);
+
+	/**
+	 * Passes, patches and vertices this builder has set up so far (for regeneration traces)
+	 */
+	const FGPUTessellationBuildStats& GetBuildStats() const { return BuildStats; }
+
+private:
+	/** Parity tests drive the individual pipeline stages, the benchmark times the patch setup */
+	friend class FGPUTessellationCPUReference;
+	friend class FGPUTessellationBenchmark;
 
 	/**
 	 * Dispatch vertex generation compute shader
+	 * Creates the output buffers unless they are passed in (in-place refresh)
 	 */
 	void DispatchVertexGeneration(
 		FRDGBuilder& GraphBuilder,
@@ -309,7 +734,9 @@ private:
 		const FVector& PatchLocalOffset,
 		FRDGBufferRef& OutVertexBuffer,
 		FRDGBufferRef& OutNormalBuffer,
-		FRDGBufferRef& OutUVBuffer);
+		FRDGBufferRef& OutUVBuffer,
+		const FGPUTessellationPatchBatch* Batch = nullptr,
+		const FIntRect* VertexRegion = nullptr);
 
 	/**
 	 * Dispatch displacement compute shader
@@ -322,7 +749,9 @@ private:
 		UTexture* SubtractTexture,
 		FRDGBufferRef VertexBuffer,
 		FRDGBufferRef NormalBuffer,
-		FRDGBufferRef UVBuffer);
+		FRDGBufferRef UVBuffer,
+		const FGPUTessellationPatchBatch* Batch = nullptr,
+		const FIntRect* VertexRegion = nullptr);
 
 	/**
 	 * Dispatch normal calculation compute shader
@@ -336,10 +765,13 @@ private:
 		UTexture* NormalMapTexture,
 		FRDGBufferRef VertexBuffer,
 		FRDGBufferRef NormalBuffer,
-		FRDGBufferRef UVBuffer);
+		FRDGBufferRef UVBuffer,
+		const FGPUTessellationPatchBatch* Batch = nullptr,
+		const FIntRect* VertexRegion = nullptr);
 
 	/**
 	 * Dispatch tangent calculation compute shader
+	 * Single mesh layout only; creates OutTangentBuffer (float4: xyz = tangent, w = binormal sign)
 	 */
 	void DispatchTangentCalculation(
 		FRDGBuilder& GraphBuilder,
@@ -356,10 +788,25 @@ private:
 		FRDGBuilder& GraphBuilder,
 		FIntPoint Resolution,
 		const FIntVector4& EdgeCollapseFactors,
-		FRDGBufferRef& OutIndexBuffer);
+		FRDGBufferRef& OutIndexBuffer,
+		const FGPUTessellationPatchBatch* Batch = nullptr);
 
 	/**
-	 * Extract mesh data from GPU buffers to CPU
+	 * Copy generated buffers into pooled staging buffers
+	 * Full content interleaves the vertex attributes into one copy unless r.GPUTessellation.InterleavedReadback is 0
+	 */
+	void EnqueueMeshReadback(
+		FRDGBuilder& GraphBuilder,
+		FIntPoint Resolution,
+		FRDGBufferRef VertexBuffer,
+		FRDGBufferRef NormalBuffer,
+		FRDGBufferRef UVBuffer,
+		FRDGBufferRef IndexBuffer,
+		EGPUTessellationReadbackContent Content,
+		FGPUTessellationMeshReadback& OutReadback);
+
+	/**
+	 * Extract mesh data from GPU buffers to CPU (blocks until the GPU is idle)
 	 */
 	void ExtractMeshData(
 		FRDGBuilder& GraphBuilder,
@@ -396,6 +843,33 @@ private:
 		UTexture* NormalMapTexture,
 		FGPUTessellationBuffers& OutPatchBuffers);
 
+	/**
+	 * Generate every visible patch with one dispatch per pipeline stage
+	 * Patches are packed into OutPatchBuffers.SharedBuffers; ranges are written to OutPatchBuffers.PatchInfo
+	 * With r.GPUTessellation.IndirectPatches, culling moves to the GPU and draws use indirect arguments;
+	 * ViewFrustum is then ignored, since the scene proxy culls every patch for each view it draws in
+	 */
+	void GenerateBatchedPatches(
+		FRDGBuilder& GraphBuilder,
+		const FGPUTessellationSettings& Settings,
+		const FMatrix& LocalToWorld,
+		const FConvexVolume* ViewFrustum,
+		UTexture* DisplacementTexture,
+		UTexture* SubtractTexture,
+		UTexture* NormalMapTexture,
+		FGPUTessellationPatchBuffers& OutPatchBuffers);
+
+	/**
+	 * Keep the generated RDG buffers alive past graph execution and create the rendering SRVs
+	 */
+	void ConvertToPersistentBuffers(
+		FRDGBuilder& GraphBuilder,
+		FRDGBufferRef VertexBuffer,
+		FRDGBufferRef NormalBuffer,
+		FRDGBufferRef UVBuffer,
+		FRDGBufferRef IndexBuffer,
+		FGPUTessellationBuffers& OutBuffers);
+
 	/**
 	 * Analyze neighboring patches and compute per-edge collapse ratios so high-detail edges stitch to coarser neighbors.
 	 */
@@ -427,4 +901,7 @@ private:
 	 * Convert patch level enum to actual tessellation factor
 	 */
 	int32 ConvertPatchLevelToTessellation(EGPUTessellationPatchLevel Level) const;
+
+	/** Work recorded by the dispatch and generation functions */
+	FGPUTessellationBuildStats BuildStats;
 };
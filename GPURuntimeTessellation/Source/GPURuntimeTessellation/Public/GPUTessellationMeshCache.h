@@ -0,0 +1,155 @@
+// Licensed under the MIT License. See LICENSE file in the project root.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RHIResources.h"
+#include "HAL/CriticalSection.h"
+#include "GPUTessellationMeshBuilder.h"
+#include "GPUTessellationVertexFactory.h"
+
+class UTexture;
+class FSceneView;
+class FSceneViewFamily;
+struct FConvexVolume;
+class FGPUTessellationSceneProxy;
+struct FMeshBatchElement;
+
+/**
+ * Everything a generated single mesh depends on
+ *
+ * Single meshes are generated in local space, so the transform is not part of the key. Textures are
+ * identified by the RHI texture the pipeline samples, which changes when a texture is reimported or streamed.
+ */
+struct FGPUTessellationMeshKey
+{
+	/** Settings the single mesh pipeline reads; TessellationFactor is the effective (LOD and budget) factor */
+	int32 TessellationFactor = 0;
+	float PlaneSizeX = 0.0f;
+	float PlaneSizeY = 0.0f;
+	float DisplacementIntensity = 0.0f;
+	float DisplacementOffset = 0.0f;
+	bool bUseSineWaveDisplacement = false;
+	EGPUTessellationNormalMethod NormalCalculationMethod = EGPUTessellationNormalMethod::Disabled;
+	bool bInvertNormals = false;
+	float NormalSmoothingFactor = 0.0f;
+	FVector2f UVOffset = FVector2f::ZeroVector;
+	FVector2f UVScale = FVector2f::UnitVector;
+
+	/** Sampled textures; referenced so their addresses cannot be reused while the key exists */
+	FTextureRHIRef DisplacementTexture;
+	FTextureRHIRef SubtractTexture;
+	FTextureRHIRef NormalMapTexture;
+
+	/** Hash of every member above */
+	uint32 Hash = 0;
+
+	bool operator==(const FGPUTessellationMeshKey& Other) const;
+
+	friend uint32 GetTypeHash(const FGPUTessellationMeshKey& Key) { return Key.Hash; }
+};
+
+/**
+ * One instanced draw of a cached mesh: the proxy that issued it for a view, and every proxy that joined it
+ *
+ * The draw's mesh batch stays open while the view is gathered; proxies gathered later append their transforms
+ * and raise its instance count. The collector keeps a pointer to the batch and mesh passes are built once
+ * gathering finished, so the batch is complete by the time anything reads it.
+ */
+struct FGPUTessellationInstancedDraw
+{
+	const FSceneViewFamily* ViewFamily = nullptr;
+	const FSceneView* View = nullptr;
+
+	/** Shadow frustum the elements were gathered for; null for the view itself */
+	const FConvexVolume* ShadowFrustum = nullptr;
+	uint32 FrameNumber = 0;
+
+	const FGPUTessellationSceneProxy* DrawingProxy = nullptr;
+	TArray<const FGPUTessellationSceneProxy*> Proxies;
+
+	/** Batch element whose NumInstances counts the proxies written so far */
+	FMeshBatchElement* BatchElement = nullptr;
+
+	/** Instance transforms allocated for the draw (FGPUTessellationInstancedUserData layout), room for Capacity proxies */
+	float* Transforms = nullptr;
+	int32 Capacity = 0;
+
+	/** Inverse current and previous transforms of the drawing proxy, which instances are placed relative to */
+	FMatrix WorldToLocal = FMatrix::Identity;
+	FMatrix PreviousWorldToLocal = FMatrix::Identity;
+};
+
+/**
+ * Single mesh buffers of one or more scene proxies (render thread)
+ * Registered meshes are shared through FGPUTessellationMeshCache; private ones belong to one proxy.
+ */
+struct FGPUTessellationCachedMesh
+{
+	explicit FGPUTessellationCachedMesh(ERHIFeatureLevel::Type FeatureLevel);
+	~FGPUTessellationCachedMesh();
+
+	FGPUTessellationBuffers Buffers;
+
+	/** Draws the buffers once for every proxy using them; initialized with the buffers */
+	FGPUTessellationInstancedVertexFactory InstancedVertexFactory;
+
+	/** Key the mesh is registered under, if it is */
+	TOptional<FGPUTessellationMeshKey> Key;
+
+	/** Proxies drawing the mesh; changed on the render thread outside of mesh gathering */
+	TArray<const FGPUTessellationSceneProxy*> Users;
+
+	/** Instanced draws of the current frame, so every proxy is drawn once per view (guarded by InstancedDrawLock) */
+	TArray<FGPUTessellationInstancedDraw> InstancedDraws;
+	FCriticalSection InstancedDrawLock;
+};
+
+/**
+ * Refcounted cache of generated single meshes, shared by every scene proxy with the same key (render thread)
+ *
+ * Proxies hold their mesh through a shared pointer; the cache only keeps weak references, so a mesh is
+ * released with its last proxy. A proxy whose mesh is shared never refreshes it in place: it looks up or
+ * generates the mesh for its new key instead. Spatial patch sets are not cached; their patch levels follow
+ * each component's own camera distance and they carry per-component world bounds.
+ */
+class GPURUNTIMETESSELLATION_API FGPUTessellationMeshCache
+{
+public:
+	static FGPUTessellationMeshCache& Get();
+
+	/**
+	 * Key for a single mesh generation
+	 * @return false if caching is disabled (r.GPUTessellation.MeshCache) or a texture is a render target
+	 */
+	static bool MakeKey(const FGPUTessellationSettings& EffectiveSettings, UTexture* DisplacementTexture, UTexture* SubtractTexture,
+		UTexture* NormalMapTexture, FGPUTessellationMeshKey& OutKey);
+
+	/** The mesh registered under a key, counted as a hit or miss */
+	TSharedPtr<FGPUTessellationCachedMesh> Find(const FGPUTessellationMeshKey& Key);
+
+	/** Share a mesh under a key, unless another mesh already is */
+	void Register(const TSharedPtr<FGPUTessellationCachedMesh>& Mesh, const FGPUTessellationMeshKey& Key);
+
+	/** Stop sharing a mesh whose contents are about to change; its users keep it */
+	void Unregister(FGPUTessellationCachedMesh& Mesh);
+
+	/** Stop sharing whatever mesh is registered under a key (its texture contents changed) */
+	void Evict(const FGPUTessellationMeshKey& Key);
+
+	/** Recount shared memory after meshes were generated, adopted or released */
+	void UpdateStats();
+
+	/** Log every cached mesh with its users and size */
+	void LogReport() const;
+
+	/** Bytes held by more than one proxy, counted once per extra user (any thread) */
+	static uint64 GetSharedBytes();
+
+private:
+	TMap<FGPUTessellationMeshKey, TWeakPtr<FGPUTessellationCachedMesh>> Meshes;
+
+	/** Lookups since startup */
+	uint64 NumHits = 0;
+	uint64 NumMisses = 0;
+};
@@ -0,0 +1,98 @@
+// Licensed under the MIT License. See LICENSE file in the project root.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GPUTessellationRegenerationSubsystem.generated.h"
+
+class FGPUTessellationSceneProxy;
+class FGPUTessellationRegenerationViewExtension;
+class FRHICommandListImmediate;
+class FRDGBuilder;
+class FSceneView;
+
+/**
+ * Regenerations of every scene proxy in a world, recorded into one render graph per frame (render thread)
+ *
+ * Proxies queue themselves instead of building their own graph. The flush adds every queued proxy's passes
+ * to a single FRDGBuilder, executes it once and then lets each proxy finish (vertex factories, patch set swap,
+ * memory stats), so many components regenerating in the same frame cost one graph compile and one set of
+ * barrier batches instead of one per component.
+ *
+ * Proxies drawing indirect patches also register here, so every view of the world culls their patches
+ * against its own frustum before it gathers mesh elements.
+ */
+class GPURUNTIMETESSELLATION_API FGPUTessellationRegenerationBatch
+{
+public:
+	/** Regenerate a proxy at the next flush; queueing it again before then is free */
+	void Add_RenderThread(FGPUTessellationSceneProxy* Proxy);
+
+	/** Drop a proxy that is being destroyed */
+	void Remove_RenderThread(FGPUTessellationSceneProxy* Proxy);
+
+	/** Record every queued proxy into one graph and execute it */
+	void Flush_RenderThread(FRHICommandListImmediate& RHICmdList);
+
+	/** Record the given proxies into one graph and execute it (also used when batching is disabled) */
+	static void Execute_RenderThread(FRHICommandListImmediate& RHICmdList, TConstArrayView<FGPUTessellationSceneProxy*> Proxies);
+
+	/** Is r.GPUTessellation.BatchRegeneration enabled? */
+	static bool IsEnabled_RenderThread();
+	static bool IsEnabled_GameThread();
+
+	/** Cull a proxy's indirect patches for every view of the world until it is removed */
+	void AddIndirectPatchProxy_RenderThread(FGPUTessellationSceneProxy* Proxy);
+	void RemoveIndirectPatchProxy_RenderThread(FGPUTessellationSceneProxy* Proxy);
+
+	/** Cull the indirect patches of every registered proxy for a view about to gather mesh elements */
+	void CullIndirectPatches_RenderThread(FRDGBuilder& GraphBuilder, const FSceneView& View);
+
+private:
+	TArray<FGPUTessellationSceneProxy*> PendingProxies;
+
+	/** Proxies whose indirect patches are culled per view */
+	TArray<FGPUTessellationSceneProxy*> IndirectPatchProxies;
+};
+
+/**
+ * Flushes the world's FGPUTessellationRegenerationBatch once per frame
+ *
+ * The flush is enqueued when the first view family of the world begins rendering, after the end of frame
+ * updates (new proxies, camera driven patch updates) and before the scene renders, so batched regenerations
+ * show up in the same frame they were requested in. Worlds that were not rendered last frame flush from Tick.
+ * The same view extension culls the batch's indirect patches for every view of the world.
+ */
+UCLASS()
+class GPURUNTIMETESSELLATION_API UGPUTessellationRegenerationSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//~ Begin USubsystem Interface
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	//~ End USubsystem Interface
+
+	//~ Begin FTickableGameObject Interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual bool IsTickableInEditor() const override { return true; }
+	//~ End FTickableGameObject Interface
+
+	/** Batch the world's scene proxies queue their regenerations into; shared with the render thread */
+	TSharedPtr<FGPUTessellationRegenerationBatch, ESPMode::ThreadSafe> GetRegenerationBatch() const { return RegenerationBatch; }
+
+	/** Enqueue the batch flush unless it already was this frame (game thread) */
+	void FlushRegenerations();
+
+private:
+	TSharedPtr<FGPUTessellationRegenerationBatch, ESPMode::ThreadSafe> RegenerationBatch;
+
+	/** Triggers the flush when the world begins rendering */
+	TSharedPtr<FGPUTessellationRegenerationViewExtension, ESPMode::ThreadSafe> ViewExtension;
+
+	/** GFrameCounter of the last flush */
+	uint64 LastFlushFrame = 0;
+};
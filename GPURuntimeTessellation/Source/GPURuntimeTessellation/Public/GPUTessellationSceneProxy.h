@@ -4,11 +4,19 @@
 
 #include "CoreMinimal.h"
 #include "PrimitiveSceneProxy.h"
+#include "HAL/CriticalSection.h"
 #include "GPUTessellationMeshBuilder.h"
 #include "GPUTessellationVertexFactory.h"
 #include "GPUTessellationComponent.h"
 
+#include <atomic>
+
 class FMaterialRenderProxy;
+struct FConvexVolume;
+struct FGPUTessellationCachedMesh;
+class FGPUTessellationRegenerationBatch;
+class FGPUTessellationDiskCacheLoad;
+class FRHIGPUBufferReadback;
 
 /**
  * Dynamic data for patch updates (camera position)
@@ -24,6 +32,98 @@ struct FGPUTessellationDynamicData
 	{}
 };
 
+/**
+ * Buffer layout a scene proxy was created with
+ * Changes that keep the layout refresh the proxy's buffers in place instead of recreating it
+ */
+struct FGPUTessellationProxyLayout
+{
+	bool bPatchMode = false;
+	
+	/** Single mesh grid resolution (unused in patch mode) */
+	FIntPoint Resolution = FIntPoint::ZeroValue;
+	
+	/** Spatial patch grid (unused in single mesh mode) */
+	FIntPoint PatchCount = FIntPoint::ZeroValue;
+	
+	/**
+	 * @param Settings - Component tessellation settings
+	 * @param LODTessellationFactor - Factor chosen by the component's LOD (used unless LOD is disabled)
+	 */
+	static FGPUTessellationProxyLayout Make(const FGPUTessellationSettings& Settings, int32 LODTessellationFactor);
+	
+	bool operator==(const FGPUTessellationProxyLayout& Other) const
+	{
+		return bPatchMode == Other.bPatchMode && Resolution == Other.Resolution && PatchCount == Other.PatchCount;
+	}
+	bool operator!=(const FGPUTessellationProxyLayout& Other) const { return !(*this == Other); }
+};
+
+/**
+ * One complete set of patch buffers and the vertex factories that draw them
+ * The scene proxy keeps two: the front set is rendered while the back set regenerates
+ */
+struct FGPUTessellationPatchRenderSet
+{
+	/** GPU patch buffers */
+	FGPUTessellationPatchBuffers Buffers;
+
+	/** Vertex factories for per-patch rendering - one per patch (array of pointers since vertex factory requires constructor args) */
+	TArray<FGPUTessellationVertexFactory*> PatchVertexFactories;
+
+	/** Vertex factory over the shared buffers of batched patches - every patch draws its own index range */
+	FGPUTessellationVertexFactory BatchedVertexFactory;
+
+	/** Vertex factory for indirect patch draws - instances the LOD grids over the visible patches */
+	FGPUTessellationIndirectVertexFactory IndirectVertexFactory;
+
+	FGPUTessellationPatchRenderSet(ERHIFeatureLevel::Type InFeatureLevel);
+	~FGPUTessellationPatchRenderSet();
+
+	/** Create the vertex factories for the generated buffers */
+	void InitVertexFactories(FRHICommandListImmediate& RHICmdList);
+
+	/** Release vertex factories and buffers */
+	void Reset();
+
+	/** Returns true the first time a render error is reported for a patch of this set (render thread) */
+	bool MarkPatchErrorReported(int32 PatchIndex) const;
+
+private:
+	ERHIFeatureLevel::Type FeatureLevel;
+
+	/** Patches whose render errors were already logged; cleared with the set */
+	mutable TBitArray<> ReportedPatchErrors;
+};
+
+/**
+ * Indirect patch arguments culled for one view of one frame (render thread)
+ */
+struct FGPUTessellationViewIndirectDraw
+{
+	const FSceneView* View = nullptr;
+	uint32 FrameNumber = 0;
+	
+	/** FRHIDrawIndexedIndirectParameters per LOD level, and the patches visible in the view */
+	TRefCountPtr<FRDGPooledBuffer> IndirectArgs;
+	TRefCountPtr<FRDGPooledBuffer> VisiblePatchList;
+	FShaderResourceViewRHIRef VisiblePatchListSRV;
+};
+
+/**
+ * Per view indirect arguments being read back for the patch stats
+ */
+struct FGPUTessellationIndirectStatsReadback
+{
+	TUniquePtr<FRHIGPUBufferReadback> Readback;
+	int32 NumLODs = 0;
+	int32 NumPatches = 0;
+	
+	FGPUTessellationIndirectStatsReadback();
+	FGPUTessellationIndirectStatsReadback(FGPUTessellationIndirectStatsReadback&&);
+	~FGPUTessellationIndirectStatsReadback();
+};
+
 /**
  * GPU Tessellation Scene Proxy
  * 
@@ -41,7 +141,8 @@ public:
 	virtual void GetDynamicMeshElements(const TArray<const FSceneView*>& Views, const FSceneViewFamily& ViewFamily, uint32 VisibilityMap, FMeshElementCollector& Collector) const override;
 	virtual FPrimitiveViewRelevance GetViewRelevance(const FSceneView* View) const override;
 	virtual uint32 GetMemoryFootprint() const override { return sizeof(*this) + GetAllocatedSize(); }
-	uint32 GetAllocatedSize() const { return FPrimitiveSceneProxy::GetAllocatedSize(); }
+	virtual void OnTransformChanged(FRHICommandListBase& RHICmdList) override;
+	uint32 GetAllocatedSize() const;
 	//~ End FPrimitiveSceneProxy Interface
 
 	/**
@@ -49,10 +150,77 @@ public:
 	 */
 	void UpdateMeshBuffers_RenderThread(const FGPUTessellationBuffers& Buffers);
 
+	/**
+	 * Rerun the compute pipeline with new settings and textures, keeping buffers, vertex factories and registration
+	 * The caller guarantees the settings keep GetLayout(); patch mode regenerates through the back patch set
+	 * Non-empty DirtyUVRegions limit a single mesh refresh to the vertices they affect (patch mode ignores them)
+	 * The passes are recorded at the next regeneration batch flush
+	 * @param Trigger - Why the component regenerated, recorded on the trace channel
+	 */
+	void RefreshMeshBuffers_RenderThread(
+		FRHICommandListImmediate& RHICmdList,
+		const FGPUTessellationSettings& NewSettings,
+		int32 LODTessellationFactor,
+		const FMatrix& LocalToWorld,
+		const FVector& CameraPosition,
+		UTexture* DisplacementTexture,
+		UTexture* SubtractTexture,
+		UTexture* NormalMapTexture,
+		EGPUTessellationRegenerationTrigger Trigger,
+		TConstArrayView<FBox2f> DirtyUVRegions = {});
+
+	/**
+	 * Buffer layout fixed at creation (safe to call from the game thread)
+	 */
+	const FGPUTessellationProxyLayout& GetLayout() const { return Layout; }
+
 	/**
 	 * Update dynamic data (camera position for patch LOD)
 	 */
-	void UpdateDynamicData_RenderThread(FGPUTessellationDynamicData* DynamicData);
+	void UpdateDynamicData_RenderThread(FRHICommandListImmediate& RHICmdList, FGPUTessellationDynamicData* DynamicData);
+
+	/**
+	 * Queue the next step of filling the back patch set; swaps it to the front once complete
+	 * Starts the most recently requested regeneration when no fill is in progress
+	 * Steps run at the regeneration batch flush, at most one per proxy and flush
+	 */
+	void AdvancePatchRegeneration_RenderThread(FRHICommandListImmediate& RHICmdList);
+
+	/**
+	 * Is a patch regeneration queued or partially generated? (safe to call from the game thread)
+	 */
+	bool IsPatchRegenerationPending() const { return bPatchRegenerationPending.load(std::memory_order_relaxed); }
+
+	/**
+	 * Cull the rendered indirect patch set against a view's frustum into arguments the view's draws use this frame
+	 * Called for every view of the proxy's world before it gathers mesh elements; shadow passes keep every patch
+	 */
+	void CullIndirectPatches_RenderThread(FRDGBuilder& GraphBuilder, const FSceneView& View);
+
+	/**
+	 * GPU memory of the single mesh buffers and both patch sets (safe to call from the game thread)
+	 */
+	FGPUTessellationBufferMemory GetBufferMemory() const;
+
+	/**
+	 * Vertices of the single mesh buffers and the rendered patch set (safe to call from the game thread)
+	 */
+	int64 GetRenderedVertexCount() const;
+
+	/**
+	 * Cached single mesh included in GetBufferMemory and its bytes, or nullptr (safe to call from the game thread)
+	 * Only identifies the mesh so proxies sharing it can be counted once; never dereferenced off the render thread
+	 */
+	const FGPUTessellationCachedMesh* GetSingleMeshMemory(uint64& OutBytes) const;
+
+	/**
+	 * World and local bounds for a patch's dynamic primitive uniform buffer (per patch CPU work of RenderPatches)
+	 */
+	static void GetPatchPrimitiveBounds(
+		const FGPUTessellationPatchInfo& PatchInfo,
+		const FMatrix& LocalToWorld,
+		FBoxSphereBounds& OutWorldBounds,
+		FBoxSphereBounds& OutLocalBounds);
 
 private:
 	/** Render single mesh (original mode) */
@@ -63,6 +231,35 @@ private:
 		FMeshElementCollector& Collector,
 		FMaterialRenderProxy* WireframeMaterialInstance) const;
 
+	/**
+	 * Join the instanced draw another proxy of the mesh already emitted for a view
+	 * Only proxies the renderer gathers join, so its visibility and occlusion culling decide what is drawn
+	 * @return true if the draw now covers this proxy and it emits nothing for the view
+	 */
+	bool JoinInstancedDraw(const FSceneView* View, const FSceneViewFamily& ViewFamily) const;
+
+	/**
+	 * Emit a single mesh draw the proxies of the mesh gathered after this one can join
+	 * @return false if no other proxy can join; the caller draws the proxy alone
+	 */
+	bool BeginInstancedDraw(
+		const FSceneView* View,
+		const FSceneViewFamily& ViewFamily,
+		FMeshElementCollector& Collector,
+		FMeshBatch& Mesh) const;
+
+	/** Can this proxy's draw include another proxy of its mesh (same scene, material and primitive state, neither moving)? */
+	bool CanShareInstancedDraw(const FGPUTessellationSceneProxy& Other) const;
+
+	/** Did the transform change this frame or the last one? Moving proxies draw alone to keep their own motion vectors */
+	bool HasMovedRecently() const;
+
+	/** Transform of the previous frame, for the motion vectors of instanced draws */
+	const FMatrix& GetPreviousLocalToWorld() const;
+
+	/** Switch to another single mesh, keeping the users of both meshes current */
+	void SetSingleMesh_RenderThread(TSharedPtr<FGPUTessellationCachedMesh> Mesh);
+
 	/** Render all patches (spatial patch mode) */
 	void RenderPatches(
 		const TArray<const FSceneView*>& Views,
@@ -71,8 +268,56 @@ private:
 		FMeshElementCollector& Collector,
 		FMaterialRenderProxy* WireframeMaterialInstance) const;
 
-	/** Initialize vertex factories for all patches */
-	void InitializePatchVertexFactories(FRHICommandListImmediate& RHICmdList);
+	/** Render batched patches with GPU-built indirect arguments - one draw per LOD level */
+	void RenderIndirectPatches(
+		const TArray<const FSceneView*>& Views,
+		const FSceneViewFamily& ViewFamily,
+		uint32 VisibilityMap,
+		FMeshElementCollector& Collector,
+		FMaterialRenderProxy* WireframeMaterialInstance) const;
+
+	/** Indirect arguments and visible patch list CullIndirectPatches_RenderThread built for a view this frame, if any */
+	const FGPUTessellationViewIndirectDraw* FindViewIndirectDraw(const FSceneView* View, uint32 FrameNumber) const;
+
+	/** Add the visible and culled counts of per view arguments read back since the last call to the patch stats */
+	void PollIndirectPatchStats_RenderThread();
+
+	/** Patch set currently rendered */
+	const FGPUTessellationPatchRenderSet& GetFrontPatchSet() const { return *PatchSets[FrontPatchSetIndex.load(std::memory_order_acquire)]; }
+
+	/** Queue a patch regeneration; replaces any request that has not started yet */
+	void RequestPatchRegeneration_RenderThread(const FVector& CameraPosition, const FMatrix& LocalToWorld, EGPUTessellationRegenerationTrigger Trigger);
+
+	/**
+	 * Queue a single mesh regeneration, merged with one still waiting for the flush
+	 * @param bFullGeneration - Run the whole pipeline into new buffers instead of refreshing the existing ones
+	 */
+	void RequestMeshRegeneration_RenderThread(
+		FRHICommandListImmediate& RHICmdList,
+		const FGPUTessellationSettings& EffectiveSettings,
+		const FMatrix& LocalToWorld,
+		const FVector& CameraPosition,
+		EGPUTessellationRegenerationTrigger Trigger,
+		bool bFullGeneration,
+		TConstArrayView<FBox2f> DirtyUVRegions);
+
+	/** Hand the proxy to the world's regeneration batch, or regenerate right away without one */
+	void QueueRegeneration_RenderThread(FRHICommandListImmediate& RHICmdList);
+
+	/** Record the queued regeneration's passes into the batch's graph */
+	void AddRegenerationPasses_RenderThread(FRDGBuilder& GraphBuilder);
+
+	/** After the batch's graph executed: vertex factories, patch set swap and memory stats */
+	void FinishRegeneration_RenderThread(FRHICommandListImmediate& RHICmdList);
+
+	/** Start the queued patch regeneration if no fill is in progress and record the next patches of the back set */
+	void AddPatchRegenerationPasses_RenderThread(FRDGBuilder& GraphBuilder);
+
+	/** Swap the back patch set to the front once its last patches were generated */
+	void FinishPatchRegeneration_RenderThread(FRHICommandListImmediate& RHICmdList);
+
+	/** Recount buffer memory after buffers were created or released and update the global memory stats */
+	void UpdateBufferMemoryStats_RenderThread();
 
 private:
 	/** Material render proxy */
@@ -87,17 +332,74 @@ private:
 	TObjectPtr<UTexture> CachedSubtractTexture;
 	TObjectPtr<UTexture> CachedNormalMapTexture;
 
-	/** GPU buffers (persistent, no CPU copy) - for single mesh mode */
-	mutable FGPUTessellationBuffers GPUBuffers;
+	/** GPU buffers (persistent, no CPU copy) - for single mesh mode; shared with identical proxies through the mesh cache */
+	TSharedPtr<FGPUTessellationCachedMesh> SingleMesh;
 
-	/** GPU patch buffers - for spatial patch mode */
-	mutable FGPUTessellationPatchBuffers GPUPatchBuffers;
+	/** Mesh a recorded full generation writes or adopted; replaces SingleMesh once the graph has executed */
+	TSharedPtr<FGPUTessellationCachedMesh> PendingSingleMesh;
 
 	/** Vertex factory for GPU buffer rendering - single mesh */
 	mutable FGPUTessellationVertexFactory VertexFactory;
 
-	/** Vertex factories for patch rendering - one per patch (array of pointers since vertex factory requires constructor args) */
-	mutable TArray<FGPUTessellationVertexFactory*> PatchVertexFactories;
+	/** Front and back patch sets - for spatial patch mode */
+	TUniquePtr<FGPUTessellationPatchRenderSet> PatchSets[2];
+
+	/** Index of the rendered patch set; flipped once the other set is completely generated */
+	std::atomic<int32> FrontPatchSetIndex;
+
+	/** Patch regeneration waiting for the back set; camera, transform and trigger are shared with the single mesh request */
+	bool bHasQueuedRegeneration;
+	FVector QueuedCameraPosition;
+	FMatrix QueuedLocalToWorld;
+	EGPUTessellationRegenerationTrigger QueuedTrigger;
+
+	/** Single mesh regeneration waiting for the batch flush; empty QueuedDirtyUVRegions refresh every vertex */
+	bool bHasQueuedMeshRegeneration;
+	bool bQueuedFullGeneration;
+
+	/** A merged request reported new texture contents (render target or displacement region), so cached meshes are stale */
+	bool bQueuedContentChanged;
+	FGPUTessellationSettings QueuedMeshSettings;
+	TArray<FBox2f> QueuedDirtyUVRegions;
+
+	/** Texture contents were changed at runtime and no longer match the on-disk cache (for the rest of the proxy's life) */
+	bool bTextureContentsModified;
+
+	/** Disk cache entry of the last full generation, read on a worker thread; the queued request waits for it in the batch */
+	TSharedPtr<FGPUTessellationDiskCacheLoad, ESPMode::ThreadSafe> DiskCacheLoad;
+	bool bWaitingForDiskCache;
+
+	/** What the last AddRegenerationPasses_RenderThread recorded, for FinishRegeneration_RenderThread */
+	bool bMeshGenerationRecorded;
+	bool bPatchStepRecorded;
+	bool bPatchStepCompletesBackSet;
+
+	/** Regeneration batch of the component's world; null outside a world */
+	TSharedPtr<FGPUTessellationRegenerationBatch, ESPMode::ThreadSafe> RegenerationBatch;
+
+	/** Views culled by CullIndirectPatches_RenderThread, written before the views gather and read while they do */
+	TArray<FGPUTessellationViewIndirectDraw> ViewIndirectDraws;
+
+	/** Per view arguments being read back for the indirect patch stats (r.GPUTessellation.IndirectPatchStats) */
+	TArray<FGPUTessellationIndirectStatsReadback> IndirectStatsReadbacks;
+
+	/** Queued in RegenerationBatch */
+	bool bRegenerationBatched;
+
+	/** Is the back set partially generated? LocalToWorld and trigger it is being generated with */
+	bool bBackSetInProgress;
+	FMatrix BackSetLocalToWorld;
+	EGPUTessellationRegenerationTrigger BackSetTrigger;
+
+	/** Mirrors bHasQueuedRegeneration || bBackSetInProgress for the game thread */
+	std::atomic<bool> bPatchRegenerationPending;
+
+	/** Buffer memory last reported to the memory stats; written on the render thread */
+	FGPUTessellationBufferMemory TrackedBufferMemory;
+	int64 TrackedVertexCount;
+	const FGPUTessellationCachedMesh* TrackedSingleMesh;
+	uint64 TrackedSingleMeshBytes;
+	mutable FCriticalSection TrackedBufferMemoryLock;
 
 	/** Is mesh data valid and ready to render */
 	mutable bool bMeshValid;
@@ -105,6 +407,9 @@ private:
 	/** Are we using spatial patch mode? */
 	bool bUsePatchMode;
 
+	/** Buffer layout - never changes after construction */
+	const FGPUTessellationProxyLayout Layout;
+
 	/** Material relevance */
 	FMaterialRelevance MaterialRelevance;
 
@@ -120,5 +425,18 @@ private:
 	/** Last camera position used for patch generation (to detect movement) */
 	mutable FVector LastCameraPosition;
 
+	/** Patches drawn by the last RenderPatches call, so the verbose log only reports changes */
+	mutable int32 LastRenderedPatchCount;
+
+	/** View relevance is logged once per proxy */
+	mutable bool bLoggedViewRelevance;
+
+	/** Transform seen by the last OnTransformChanged, the one before it, and the render thread frame it changed in */
+	FMatrix TrackedLocalToWorld;
+	FMatrix PreviousLocalToWorld;
+	uint64 LastTransformChangeFrame;
+	bool bTransformTracked;
+
 	friend class UGPUTessellationComponent;
+	friend class FGPUTessellationRegenerationBatch;
 };
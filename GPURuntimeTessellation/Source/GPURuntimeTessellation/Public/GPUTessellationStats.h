@@ -0,0 +1,131 @@
+// Licensed under the MIT License. See LICENSE file in the project root.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+/**
+ * Stat group for the tessellation pipeline ("stat GPUTessellation")
+ */
+DECLARE_STATS_GROUP(TEXT("GPU Tessellation"), STATGROUP_GPUTessellation, STATCAT_Advanced);
+
+/** CSV profiler category; timings and counters below are recorded under it as well */
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(GPURUNTIMETESSELLATION_API, GPUTessellation);
+
+/**
+ * Time a scope in both the stat system and the CSV profiler
+ * @param StatId - Cycle stat declared below
+ * @param CsvStat - Name of the CSV timing stat
+ */
+#define GPUTESSELLATION_SCOPE_CYCLE_COUNTER(StatId, CsvStat) \
+	SCOPE_CYCLE_COUNTER(StatId); \
+	CSV_SCOPED_TIMING_STAT(GPUTessellation, CsvStat)
+
+/**
+ * Add to a per frame counter in both the stat system and the CSV profiler
+ */
+#define GPUTESSELLATION_INC_COUNTER(StatId, CsvStat, Amount) \
+	INC_DWORD_STAT_BY(StatId, Amount); \
+	CSV_CUSTOM_STAT(GPUTessellation, CsvStat, (int32)(Amount), ECsvCustomStatOp::Accumulate)
+
+// CPU cost
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Tick LOD Evaluation"), STAT_GPUTessellation_TickLOD, STATGROUP_GPUTessellation, GPURUNTIMETESSELLATION_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Patch Info Calculation"), STAT_GPUTessellation_PatchInfo, STATGROUP_GPUTessellation, GPURUNTIMETESSELLATION_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("RDG Setup"), STAT_GPUTessellation_RDGSetup, STATGROUP_GPUTessellation, GPURUNTIMETESSELLATION_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Regeneration Batch"), STAT_GPUTessellation_RegenerationBatch, STATGROUP_GPUTessellation, GPURUNTIMETESSELLATION_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Sleeping Component Wake Check"), STAT_GPUTessellation_WakeCheck, STATGROUP_GPUTessellation, GPURUNTIMETESSELLATION_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Vertex Factory Init"), STAT_GPUTessellation_VertexFactoryInit, STATGROUP_GPUTessellation, GPURUNTIMETESSELLATION_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("GetDynamicMeshElements"), STAT_GPUTessellation_GetDynamicMeshElements, STATGROUP_GPUTessellation, GPURUNTIMETESSELLATION_API);
+
+// Patches (per frame; indirect patches are culled on the GPU and not counted as drawn or culled)
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Patches Generated"), STAT_GPUTessellation_PatchesGenerated, STATGROUP_GPUTessellation, GPURUNTIMETESSELLATION_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Patches Culled"), STAT_GPUTessellation_PatchesCulled, STATGROUP_GPUTessellation, GPURUNTIMETESSELLATION_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Patches Drawn"), STAT_GPUTessellation_PatchesDrawn, STATGROUP_GPUTessellation, GPURUNTIMETESSELLATION_API);
+
+// Indirect patches visible and culled per view, read back from the GPU a few frames late (r.GPUTessellation.IndirectPatchStats)
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Indirect Patches Visible"), STAT_GPUTessellation_IndirectPatchesVisible, STATGROUP_GPUTessellation, GPURUNTIMETESSELLATION_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Indirect Patches Culled"), STAT_GPUTessellation_IndirectPatchesCulled, STATGROUP_GPUTessellation, GPURUNTIMETESSELLATION_API);
+
+// Regeneration graphs executed per frame and the components recorded into them
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Regeneration Graphs"), STAT_GPUTessellation_RegenerationGraphs, STATGROUP_GPUTessellation, GPURUNTIMETESSELLATION_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Batched Regenerations"), STAT_GPUTessellation_BatchedRegenerations, STATGROUP_GPUTessellation, GPURUNTIMETESSELLATION_API);
+
+// Components sleeping on a view (UGPUTessellationTickSubsystem) and those woken per frame
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Sleeping Components"), STAT_GPUTessellation_SleepingComponents, STATGROUP_GPUTessellation, GPURUNTIMETESSELLATION_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Woken Components"), STAT_GPUTessellation_WokenComponents, STATGROUP_GPUTessellation, GPURUNTIMETESSELLATION_API);
+
+// Single meshes shared through FGPUTessellationMeshCache: lookups per frame, live entries and memory held by more than one proxy
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Mesh Cache Hits"), STAT_GPUTessellation_MeshCacheHits, STATGROUP_GPUTessellation, GPURUNTIMETESSELLATION_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Mesh Cache Misses"), STAT_GPUTessellation_MeshCacheMisses, STATGROUP_GPUTessellation, GPURUNTIMETESSELLATION_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Cached Meshes"), STAT_GPUTessellation_CachedMeshes, STATGROUP_GPUTessellation, GPURUNTIMETESSELLATION_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Shared Buffer Memory"), STAT_GPUTessellation_SharedMemory, STATGROUP_GPUTessellation, GPURUNTIMETESSELLATION_API);
+
+// On-disk mesh cache (FGPUTessellationDiskCache): entry reads, lookups and entries written per frame
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Disk Cache Load"), STAT_GPUTessellation_DiskCacheLoad, STATGROUP_GPUTessellation, GPURUNTIMETESSELLATION_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Disk Cache Hits"), STAT_GPUTessellation_DiskCacheHits, STATGROUP_GPUTessellation, GPURUNTIMETESSELLATION_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Disk Cache Misses"), STAT_GPUTessellation_DiskCacheMisses, STATGROUP_GPUTessellation, GPURUNTIMETESSELLATION_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Disk Cache Stores"), STAT_GPUTessellation_DiskCacheStores, STATGROUP_GPUTessellation, GPURUNTIMETESSELLATION_API);
+
+// Single mesh draws covering several proxies of a shared mesh, and the proxies they drew, per frame
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Instanced Draws"), STAT_GPUTessellation_InstancedDraws, STATGROUP_GPUTessellation, GPURUNTIMETESSELLATION_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Instanced Proxies"), STAT_GPUTessellation_InstancedProxies, STATGROUP_GPUTessellation, GPURUNTIMETESSELLATION_API);
+
+// GPU buffer memory of every scene proxy
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Position Buffers"), STAT_GPUTessellation_PositionMemory, STATGROUP_GPUTessellation, GPURUNTIMETESSELLATION_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Normal Buffers"), STAT_GPUTessellation_NormalMemory, STATGROUP_GPUTessellation, GPURUNTIMETESSELLATION_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("UV Buffers"), STAT_GPUTessellation_UVMemory, STATGROUP_GPUTessellation, GPURUNTIMETESSELLATION_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Tangent Buffers"), STAT_GPUTessellation_TangentMemory, STATGROUP_GPUTessellation, GPURUNTIMETESSELLATION_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Index Buffers"), STAT_GPUTessellation_IndexMemory, STATGROUP_GPUTessellation, GPURUNTIMETESSELLATION_API);
+
+// Global budget (UGPUTessellationBudgetSubsystem), sampled every frame
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Budget Vertices"), STAT_GPUTessellation_BudgetVertices, STATGROUP_GPUTessellation, GPURUNTIMETESSELLATION_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Budget Vertex Limit"), STAT_GPUTessellation_BudgetVertexLimit, STATGROUP_GPUTessellation, GPURUNTIMETESSELLATION_API);
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Budget Memory (MB)"), STAT_GPUTessellation_BudgetMemory, STATGROUP_GPUTessellation, GPURUNTIMETESSELLATION_API);
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Budget Memory Limit (MB)"), STAT_GPUTessellation_BudgetMemoryLimit, STATGROUP_GPUTessellation, GPURUNTIMETESSELLATION_API);
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Budget Pressure"), STAT_GPUTessellation_BudgetPressure, STATGROUP_GPUTessellation, GPURUNTIMETESSELLATION_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Budget Biased Components"), STAT_GPUTessellation_BudgetBiasedComponents, STATGROUP_GPUTessellation, GPURUNTIMETESSELLATION_API);
+
+// Mesh readback
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Readback Bytes"), STAT_GPUTessellation_ReadbackBytes, STATGROUP_GPUTessellation, GPURUNTIMETESSELLATION_API);
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Readback Latency (ms)"), STAT_GPUTessellation_ReadbackLatency, STATGROUP_GPUTessellation, GPURUNTIMETESSELLATION_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Readbacks In Flight"), STAT_GPUTessellation_ReadbacksInFlight, STATGROUP_GPUTessellation, GPURUNTIMETESSELLATION_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Pooled Readback Buffers"), STAT_GPUTessellation_PooledReadbacks, STATGROUP_GPUTessellation, GPURUNTIMETESSELLATION_API);
+
+/**
+ * GPU memory held by one set of tessellation buffers, by stream
+ */
+struct FGPUTessellationBufferMemory
+{
+	uint64 PositionBytes = 0;
+	uint64 NormalBytes = 0;
+	uint64 UVBytes = 0;
+	uint64 TangentBytes = 0;
+	
+	/** Index buffers, plus the indirect argument, visible patch and descriptor buffers of indirect patches */
+	uint64 IndexBytes = 0;
+	
+	uint64 GetTotalBytes() const { return PositionBytes + NormalBytes + UVBytes + TangentBytes + IndexBytes; }
+	
+	FGPUTessellationBufferMemory& operator+=(const FGPUTessellationBufferMemory& Other)
+	{
+		PositionBytes += Other.PositionBytes;
+		NormalBytes += Other.NormalBytes;
+		UVBytes += Other.UVBytes;
+		TangentBytes += Other.TangentBytes;
+		IndexBytes += Other.IndexBytes;
+		return *this;
+	}
+};
+
+namespace GPUTessellationStats
+{
+	/**
+	 * Move the global memory stats from one owner's previous buffer memory to its current one (any thread)
+	 */
+	GPURUNTIMETESSELLATION_API void UpdateBufferMemory(const FGPUTessellationBufferMemory& OldMemory, const FGPUTessellationBufferMemory& NewMemory);
+	
+	/** Buffer memory of every scene proxy */
+	GPURUNTIMETESSELLATION_API FGPUTessellationBufferMemory GetTotalBufferMemory();
+}
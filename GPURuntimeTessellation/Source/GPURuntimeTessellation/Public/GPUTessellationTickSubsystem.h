@@ -0,0 +1,66 @@
+// Licensed under the MIT License. See LICENSE file in the project root.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GPUTessellationTickSubsystem.generated.h"
+
+class UGPUTessellationComponent;
+
+/**
+ * Wakes sleeping tessellation components of a world once a view moves far enough to change their LOD
+ *
+ * A component whose LOD has settled and that has nothing else to do disables its tick. If its LOD follows the
+ * view, it sleeps here with a wake sphere: where its nearest view was and how far that view may move before
+ * the LOD could change (the distance to the next LOD band, or the patch update threshold). Once per frame the
+ * subsystem tests every sleeper's nearest view against its sphere and re-enables the tick of those that left it.
+ * Components without view dependent LOD are not kept here at all; setters, notifications and transform
+ * changes wake them directly.
+ */
+UCLASS()
+class GPURUNTIMETESSELLATION_API UGPUTessellationTickSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//~ Begin USubsystem Interface
+	virtual void Deinitialize() override;
+	//~ End USubsystem Interface
+
+	//~ Begin FTickableGameObject Interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual bool IsTickableInEditor() const override { return true; }
+	//~ End FTickableGameObject Interface
+
+	/**
+	 * Wake the component once its nearest view is further than WakeRadius from WakeLocation (game thread)
+	 * @param bHasView - False if the component found no view; it wakes as soon as the world has one
+	 */
+	void AddSleepingComponent(UGPUTessellationComponent* Component, const FVector& WakeLocation, float WakeRadius, bool bHasView);
+
+	/** Stop watching a component that woke up or is unregistered (game thread) */
+	void RemoveSleepingComponent(UGPUTessellationComponent* Component);
+
+	/** Components currently sleeping on a view */
+	int32 GetSleepingComponentCount() const { return SleepingComponents.Num(); }
+
+	/** Is r.GPUTessellation.SleepWhenIdle enabled? */
+	static bool IsSleepEnabled();
+
+private:
+	/** A component waiting for its nearest view to leave a sphere */
+	struct FSleepingComponent
+	{
+		TWeakObjectPtr<UGPUTessellationComponent> Component;
+		FVector WakeLocation = FVector::ZeroVector;
+		double WakeRadiusSquared = 0.0;
+		bool bHasView = true;
+	};
+
+	/** Re-enable the tick of every sleeping component */
+	void WakeAll();
+
+	TArray<FSleepingComponent> SleepingComponents;
+};
@@ -0,0 +1,175 @@
+// Licensed under the MIT License. See LICENSE file in the project root.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+class FPrimitiveSceneProxy;
+class FGPUTessellationMeshBuilder;
+
+/** Regeneration events are traced in every build but shipping */
+#define GPUTESSELLATION_TRACE_ENABLED (UE_TRACE_ENABLED && !UE_BUILD_SHIPPING)
+
+/** The last regenerations are kept in memory in every build but shipping */
+#define GPUTESSELLATION_REGENERATION_HISTORY (!UE_BUILD_SHIPPING)
+
+#if GPUTESSELLATION_TRACE_ENABLED
+/** Insights channel for regeneration events ("-trace=default,GPUTessellation") */
+UE_TRACE_CHANNEL_EXTERN(GPUTessellationChannel, GPURUNTIMETESSELLATION_API);
+#endif
+
+/**
+ * Why a component's mesh was regenerated
+ */
+enum class EGPUTessellationRegenerationTrigger : uint8
+{
+	/** The engine recreated the render state (registration, visibility, streaming, transform) */
+	ProxyRecreated,
+	/** UpdateTessellatedMesh was called directly */
+	Explicit,
+	/** Settings or textures were replaced through the component's setters */
+	SettingsChanged,
+	/** A property was edited in the editor */
+	PropertyEdit,
+	/** The material was replaced */
+	MaterialChanged,
+	/** Distance based LOD picked a new tessellation factor */
+	LODChanged,
+	/** Patch LOD followed the camera */
+	CameraMoved,
+	/** A render target texture changed (checksum, continuous update or notification) */
+	RenderTarget,
+	/** Displacement regions were marked dirty */
+	DisplacementRegion,
+	/** The global budget changed the LOD bias */
+	Budget,
+};
+
+GPURUNTIMETESSELLATION_API const TCHAR* LexToString(EGPUTessellationRegenerationTrigger Trigger);
+
+/**
+ * Work recorded by a mesh builder while it sets up a regeneration
+ */
+struct FGPUTessellationBuildStats
+{
+	/** RDG passes added per pipeline stage */
+	uint16 VertexGenerationPasses = 0;
+	uint16 DisplacementPasses = 0;
+	uint16 NormalPasses = 0;
+	uint16 TangentPasses = 0;
+	uint16 IndexPasses = 0;
+	uint16 CullingPasses = 0;
+	/** Buffer extraction and SRV creation */
+	uint16 OtherPasses = 0;
+
+	/** Patches generated and skipped by culling (patch mode) */
+	uint32 GeneratedPatches = 0;
+	uint32 CulledPatches = 0;
+
+	/** Vertices and indices written */
+	uint32 VertexCount = 0;
+	uint32 IndexCount = 0;
+
+	uint32 GetTotalPasses() const
+	{
+		return VertexGenerationPasses + DisplacementPasses + NormalPasses + TangentPasses + IndexPasses + CullingPasses + OtherPasses;
+	}
+};
+
+/**
+ * One regeneration, as kept by FGPUTessellationRegenerationHistory
+ */
+struct FGPUTessellationRegenerationSummary
+{
+	/** Render thread frame the regeneration ran in */
+	uint64 FrameNumber = 0;
+	/** FPlatformTime::Seconds() when it finished */
+	double Time = 0.0;
+	/** CPU time of the regeneration scope */
+	double Milliseconds = 0.0;
+
+	/** Owner and resource name of the component; names, so recording never formats strings */
+	FName OwnerName;
+	FName ResourceName;
+	EGPUTessellationRegenerationTrigger Trigger = EGPUTessellationRegenerationTrigger::ProxyRecreated;
+
+	/** Patch grid size, 0 outside patch mode */
+	int32 TotalPatches = 0;
+	FGPUTessellationBuildStats BuildStats;
+};
+
+#if GPUTESSELLATION_REGENERATION_HISTORY
+/**
+ * Ring buffer of the last regeneration summaries (r.GPUTessellation.RegenerationHistory entries)
+ *
+ * Filled from FGPUTessellationRegenerationTrace, so it needs neither a trace session nor verbose
+ * logging; GPUTessellation.DumpRegenerations prints it. Compiled out in shipping builds.
+ */
+class GPURUNTIMETESSELLATION_API FGPUTessellationRegenerationHistory
+{
+public:
+	/** Add a summary, replacing the oldest one once the history is full (any thread) */
+	static void Record(const FGPUTessellationRegenerationSummary& Summary);
+
+	/** Recorded summaries, oldest first (any thread) */
+	static TArray<FGPUTessellationRegenerationSummary> GetSummaries();
+
+	/** Forget every recorded summary (any thread) */
+	static void Reset();
+};
+#endif // GPUTESSELLATION_REGENERATION_HISTORY
+
+/**
+ * Records one regeneration when the scope ends (render thread)
+ *
+ * Captures the trigger, the proxy's component, patch counts, per stage pass counts, vertex totals
+ * and the CPU time of the scope into FGPUTessellationRegenerationHistory, and onto the trace
+ * channel when it is enabled. Compiled out in shipping builds.
+ */
+class GPURUNTIMETESSELLATION_API FGPUTessellationRegenerationTrace
+{
+public:
+#if GPUTESSELLATION_REGENERATION_HISTORY
+	FGPUTessellationRegenerationTrace(const FPrimitiveSceneProxy& InProxy, EGPUTessellationRegenerationTrigger InTrigger, const FGPUTessellationMeshBuilder& InMeshBuilder)
+		: Proxy(InProxy)
+		, MeshBuilder(InMeshBuilder)
+		, Trigger(InTrigger)
+		, StartCycle(FPlatformTime::Cycles64())
+	{
+	}
+
+	~FGPUTessellationRegenerationTrace()
+	{
+		Finish();
+	}
+
+	/** Patch grid size, for patch mode regenerations */
+	void SetTotalPatches(int32 InTotalPatches) { TotalPatches = InTotalPatches; }
+
+private:
+	void Finish() const;
+
+	const FPrimitiveSceneProxy& Proxy;
+	const FGPUTessellationMeshBuilder& MeshBuilder;
+	EGPUTessellationRegenerationTrigger Trigger;
+	uint64 StartCycle;
+	int32 TotalPatches = 0;
+#else
+	FGPUTessellationRegenerationTrace(const FPrimitiveSceneProxy&, EGPUTessellationRegenerationTrigger, const FGPUTessellationMeshBuilder&) {}
+	void SetTotalPatches(int32) {}
+#endif
+};
+
+/**
+ * Trace a regeneration done in the current scope, with a CPU timing scope on the same channel
+ */
+#if GPUTESSELLATION_TRACE_ENABLED
+#define GPUTESSELLATION_TRACE_REGENERATION(Name, Proxy, Trigger, MeshBuilder) \
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(GPUTessellation_Regeneration, GPUTessellationChannel); \
+	FGPUTessellationRegenerationTrace Name(Proxy, Trigger, MeshBuilder)
+#else
+#define GPUTESSELLATION_TRACE_REGENERATION(Name, Proxy, Trigger, MeshBuilder) \
+	FGPUTessellationRegenerationTrace Name(Proxy, Trigger, MeshBuilder)
+#endif
@@ -54,3 +54,79 @@ public:
 	FShaderResourceViewRHIRef NormalSRV;
 	FShaderResourceViewRHIRef UVSRV;
 };
+
+/**
+ * Vertex Factory for GPU-driven indirect patch draws
+ * Draws a plain per-LOD grid instanced over the visible patches of that LOD;
+ * the vertex shader resolves each instance's patch from the visible patch list
+ */
+class FGPUTessellationIndirectVertexFactory : public FGPUTessellationVertexFactory
+{
+	DECLARE_VERTEX_FACTORY_TYPE(FGPUTessellationIndirectVertexFactory);
+
+public:
+	FGPUTessellationIndirectVertexFactory(ERHIFeatureLevel::Type InFeatureLevel);
+
+	/**
+	 * Set patch descriptor and visible patch list SRVs
+	 */
+	void SetPatchBuffers(FShaderResourceViewRHIRef InPatchDescriptorSRV, FShaderResourceViewRHIRef InVisiblePatchListSRV);
+
+	/**
+	 * Release RHI resources
+	 */
+	virtual void ReleaseRHI() override;
+
+	/**
+	 * Modify compile environment for this vertex factory
+	 */
+	static void ModifyCompilationEnvironment(const FVertexFactoryShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment);
+
+	/** Patch SRVs (public for shader parameter binding) */
+	FShaderResourceViewRHIRef PatchDescriptorSRV;
+	FShaderResourceViewRHIRef VisiblePatchListSRV;
+};
+
+/**
+ * Per draw data of an indirect patch draw, referenced by the mesh batch element's UserData
+ */
+struct FGPUTessellationIndirectUserData
+{
+	/** Visible patches of the view the draw is for; the vertex factory's list (every patch) if null */
+	FRHIShaderResourceView* VisiblePatchListSRV = nullptr;
+
+	/** Start of the draw's LOD level in the visible patch list */
+	uint32 PatchListOffset = 0;
+};
+
+/**
+ * Per draw data of an instanced single mesh draw, referenced by the mesh batch element's UserData
+ */
+struct FGPUTessellationInstancedUserData
+{
+	/**
+	 * Float buffer with two 4x3 transforms per instance (rows: X, Y, Z, origin): into the drawing proxy's local
+	 * space, then the previous frame's transform into its previous local space for motion vectors
+	 */
+	FRHIShaderResourceView* InstanceTransformSRV = nullptr;
+
+	/** Floats per instance in InstanceTransformSRV */
+	static constexpr int32 FloatsPerInstance = 24;
+};
+
+/**
+ * Vertex Factory drawing one single mesh for several scene proxies in one instanced call
+ * Each instance moves the shared local space mesh into the local space of the proxy that draws it
+ */
+class FGPUTessellationInstancedVertexFactory : public FGPUTessellationVertexFactory
+{
+	DECLARE_VERTEX_FACTORY_TYPE(FGPUTessellationInstancedVertexFactory);
+
+public:
+	FGPUTessellationInstancedVertexFactory(ERHIFeatureLevel::Type InFeatureLevel);
+
+	/**
+	 * Modify compile environment for this vertex factory
+	 */
+	static void ModifyCompilationEnvironment(const FVertexFactoryShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment);
+};
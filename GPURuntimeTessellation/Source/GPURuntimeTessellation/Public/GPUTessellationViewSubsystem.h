@@ -0,0 +1,59 @@
+// Licensed under the MIT License. See LICENSE file in the project root.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ConvexVolume.h"
+#include "GPUTessellationViewSubsystem.generated.h"
+
+/**
+ * One view point tessellation LOD is evaluated against
+ */
+struct FGPUTessellationView
+{
+	FVector Location = FVector::ZeroVector;
+	FRotator Rotation = FRotator::ZeroRotator;
+
+	/** Horizontal field of view in degrees */
+	float FOV = 90.0f;
+
+	/** World space frustum (FConvexVolume convention); empty for orthographic editor viewports */
+	FConvexVolume Frustum;
+	bool bHasFrustum = false;
+};
+
+/**
+ * View points of a world, resolved once per frame for every tessellation component
+ *
+ * Covers every local player (split screen included) or, in editor worlds without players, every visible
+ * editor viewport of the world. The first query of a frame resolves the views; every other query that frame
+ * reads the cache, so LOD evaluation of many components does no player controller or viewport lookups.
+ */
+UCLASS()
+class GPURUNTIMETESSELLATION_API UGPUTessellationViewSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Views of the current frame (game thread) */
+	const TArray<FGPUTessellationView>& GetViews() const;
+
+	/** The view closest to a world location, or null if the world has no view this frame (game thread) */
+	const FGPUTessellationView* FindNearestView(const FVector& WorldLocation) const;
+
+	/** Do the bounds intersect any view frustum? True when a view has no frustum (game thread) */
+	bool IsInAnyView(const FBoxSphereBounds& Bounds) const;
+
+	/** FindNearestView for a world, if it has the subsystem */
+	static const FGPUTessellationView* FindNearestView(const UWorld* World, const FVector& WorldLocation);
+
+private:
+	/** Resolve the views if the cache is from an earlier frame */
+	void UpdateViews() const;
+
+	mutable TArray<FGPUTessellationView> Views;
+
+	/** GFrameCounter the cache was resolved in */
+	mutable uint64 CachedFrame = MAX_uint64;
+};